@@ -44,6 +44,21 @@ sourceSets {
             setSrcDirs(listOf("src/test/java"))
         }
     }
+    // JMH benchmarks, run with: ./gradlew jmh -PjmhArgs="Checksum"
+    create("jmh") {
+        java {
+            setSrcDirs(listOf("src/jmh/java"))
+        }
+        compileClasspath += sourceSets["main"].output
+        runtimeClasspath += sourceSets["main"].output
+    }
+}
+
+val jmhVersion = "1.37"
+
+dependencies {
+    "jmhImplementation"("org.openjdk.jmh:jmh-core:${jmhVersion}")
+    "jmhAnnotationProcessor"("org.openjdk.jmh:jmh-generator-annprocess:${jmhVersion}")
 }
 
 java {
@@ -87,6 +102,15 @@ tasks.compileTestJava {
     dependsOn(tasks.compileJava)
 }
 
+tasks.register<JavaExec>("jmh") {
+    description = "Runs the JMH benchmarks in src/jmh/java, pass JMH options via -PjmhArgs"
+    group = "verification"
+    classpath = sourceSets["jmh"].runtimeClasspath
+    mainClass.set("org.openjdk.jmh.Main")
+    val jmhArgs = project.findProperty("jmhArgs")?.toString() ?: ""
+    args = listOf("-rf", "json", "-rff", "${buildDir}/jmh-result.json") + jmhArgs.split(" ").filter { it.isNotBlank() }
+}
+
 publishing {
 
     repositories {
@@ -0,0 +1,92 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.jmh;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import software.amazon.awssdk.crt.checksums.CRC32;
+import software.amazon.awssdk.crt.checksums.CRC32C;
+import software.amazon.awssdk.crt.checksums.CRC64NVME;
+import software.amazon.awssdk.crt.checksums.XXHash;
+
+/**
+ * Checksums and hashes over heap arrays of various sizes. The JDK's CRC32 is included as a baseline, since it
+ * shows how much of the cost at small sizes is the JNI crossing rather than the checksum itself.
+ */
+@State(Scope.Thread)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class ChecksumBenchmark {
+
+    @Param({"16", "256", "4096", "65536", "1048576"})
+    public int size;
+
+    private byte[] data;
+
+    @Setup
+    public void setup() {
+        data = new byte[size];
+        new Random(42).nextBytes(data);
+    }
+
+    @Benchmark
+    public long jdkCrc32() {
+        java.util.zip.CRC32 checksum = new java.util.zip.CRC32();
+        checksum.update(data, 0, data.length);
+        return checksum.getValue();
+    }
+
+    @Benchmark
+    public long crc32() {
+        CRC32 checksum = new CRC32();
+        checksum.update(data, 0, data.length);
+        return checksum.getValue();
+    }
+
+    @Benchmark
+    public long crc32c() {
+        CRC32C checksum = new CRC32C();
+        checksum.update(data, 0, data.length);
+        return checksum.getValue();
+    }
+
+    @Benchmark
+    public long crc64nvme() {
+        CRC64NVME checksum = new CRC64NVME();
+        checksum.update(data, 0, data.length);
+        return checksum.getValue();
+    }
+
+    @Benchmark
+    public byte[] xxHash64() {
+        return XXHash.computeXXHash64(data);
+    }
+
+    @Benchmark
+    public byte[] xxHash3_64() {
+        return XXHash.computeXXHash3_64(data);
+    }
+
+    @Benchmark
+    public byte[] xxHash3_128() {
+        return XXHash.computeXXHash3_128(data);
+    }
+}
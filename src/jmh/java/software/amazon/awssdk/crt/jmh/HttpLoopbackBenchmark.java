@@ -0,0 +1,173 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.jmh;
+
+import java.net.URI;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+import software.amazon.awssdk.crt.CRT;
+import software.amazon.awssdk.crt.CrtResource;
+import software.amazon.awssdk.crt.http.Http2Request;
+import software.amazon.awssdk.crt.http.Http2StreamManager;
+import software.amazon.awssdk.crt.http.Http2StreamManagerOptions;
+import software.amazon.awssdk.crt.http.HttpClientConnection;
+import software.amazon.awssdk.crt.http.HttpClientConnectionManager;
+import software.amazon.awssdk.crt.http.HttpClientConnectionManagerOptions;
+import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpRequest;
+import software.amazon.awssdk.crt.http.HttpStreamBase;
+import software.amazon.awssdk.crt.http.HttpStreamBaseResponseHandler;
+import software.amazon.awssdk.crt.http.HttpVersion;
+import software.amazon.awssdk.crt.io.ClientBootstrap;
+import software.amazon.awssdk.crt.io.EventLoopGroup;
+import software.amazon.awssdk.crt.io.HostResolver;
+import software.amazon.awssdk.crt.io.SocketOptions;
+
+/**
+ * Request throughput of the HTTP/1.1 connection manager and the HTTP/2 stream manager against an in-process server
+ * on the loopback interface. Each operation is one complete GET. Concurrency follows the number of JMH threads,
+ * e.g. {@code -t 8}.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Warmup(iterations = 3, time = 2)
+@Measurement(iterations = 5, time = 2)
+@Fork(1)
+@Threads(4)
+public class HttpLoopbackBenchmark {
+
+    @Param({"HTTP_1_1", "HTTP_2"})
+    public HttpVersion protocol;
+
+    @Param({"0", "16384"})
+    public int responseBodySize;
+
+    @Param({"8"})
+    public int maxConnections;
+
+    private LoopbackHttp1Server http1Server;
+    private LoopbackHttp2Server http2Server;
+
+    private EventLoopGroup eventLoopGroup;
+    private HostResolver hostResolver;
+    private ClientBootstrap bootstrap;
+    private SocketOptions socketOptions;
+    private HttpClientConnectionManager connectionManager;
+    private Http2StreamManager streamManager;
+
+    private HttpRequest http1Request;
+    private Http2Request http2Request;
+
+    @Setup(Level.Trial)
+    public void setup() throws Exception {
+        eventLoopGroup = new EventLoopGroup(0);
+        hostResolver = new HostResolver(eventLoopGroup);
+        bootstrap = new ClientBootstrap(eventLoopGroup, hostResolver);
+        socketOptions = new SocketOptions();
+
+        HttpClientConnectionManagerOptions connectionManagerOptions = new HttpClientConnectionManagerOptions()
+                .withClientBootstrap(bootstrap)
+                .withSocketOptions(socketOptions)
+                .withMaxConnections(maxConnections);
+
+        if (protocol == HttpVersion.HTTP_2) {
+            http2Server = new LoopbackHttp2Server(responseBodySize);
+            String authority = "127.0.0.1:" + http2Server.getPort();
+            connectionManagerOptions.withUri(new URI("http://" + authority));
+
+            streamManager = Http2StreamManager.create(new Http2StreamManagerOptions()
+                    .withConnectionManagerOptions(connectionManagerOptions)
+                    .withPriorKnowledge(true));
+            http2Request = new Http2Request(new HttpHeader[] {
+                    new HttpHeader(":method", "GET"),
+                    new HttpHeader(":path", "/"),
+                    new HttpHeader(":scheme", "http"),
+                    new HttpHeader(":authority", authority),
+            }, null);
+        } else {
+            http1Server = new LoopbackHttp1Server(responseBodySize, maxConnections);
+            String authority = "127.0.0.1:" + http1Server.getPort();
+            connectionManagerOptions.withUri(new URI("http://" + authority));
+
+            connectionManager = HttpClientConnectionManager.create(connectionManagerOptions);
+            http1Request = new HttpRequest("GET", "/", new HttpHeader[] {
+                    new HttpHeader("Host", authority),
+            }, null);
+        }
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws Exception {
+        if (streamManager != null) {
+            streamManager.close();
+        }
+        if (connectionManager != null) {
+            connectionManager.close();
+        }
+        socketOptions.close();
+        bootstrap.close();
+        hostResolver.close();
+        eventLoopGroup.close();
+        CrtResource.waitForNoResources();
+
+        if (http1Server != null) {
+            http1Server.close();
+        }
+        if (http2Server != null) {
+            http2Server.close();
+        }
+    }
+
+    @Benchmark
+    public int request() throws Exception {
+        CompletableFuture<Integer> responseStatus = new CompletableFuture<>();
+        HttpStreamBaseResponseHandler handler = new HttpStreamBaseResponseHandler() {
+            private int status;
+
+            @Override
+            public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                    HttpHeader[] nextHeaders) {
+                status = responseStatusCode;
+            }
+
+            @Override
+            public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                stream.close();
+                if (errorCode != CRT.AWS_CRT_SUCCESS) {
+                    responseStatus.completeExceptionally(new RuntimeException(CRT.awsErrorName(errorCode)));
+                } else {
+                    responseStatus.complete(status);
+                }
+            }
+        };
+
+        if (streamManager != null) {
+            streamManager.acquireStream(http2Request, handler).get(30, TimeUnit.SECONDS);
+            return responseStatus.get(30, TimeUnit.SECONDS);
+        }
+
+        try (HttpClientConnection connection = connectionManager.acquireConnection().get(30, TimeUnit.SECONDS)) {
+            connection.makeRequest(http1Request, handler).activate();
+            return responseStatus.get(30, TimeUnit.SECONDS);
+        }
+    }
+}
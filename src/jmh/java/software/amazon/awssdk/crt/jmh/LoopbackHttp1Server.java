@@ -0,0 +1,70 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.jmh;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.util.Arrays;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+import com.sun.net.httpserver.HttpServer;
+
+/**
+ * An HTTP/1.1 server on an ephemeral loopback port, built on the JDK's built-in server. It drains any request body
+ * and answers every request with a 200 and a fixed size body.
+ */
+public final class LoopbackHttp1Server implements AutoCloseable {
+
+    private final HttpServer server;
+    private final ExecutorService executor;
+
+    /**
+     * Starts the server
+     * @param responseBodySize number of body bytes sent with every response
+     * @param threads number of threads serving requests
+     * @throws IOException if the listening socket can't be opened
+     */
+    public LoopbackHttp1Server(int responseBodySize, int threads) throws IOException {
+        final byte[] responseBody = new byte[responseBodySize];
+        Arrays.fill(responseBody, (byte) 'x');
+
+        server = HttpServer.create(new InetSocketAddress(InetAddress.getLoopbackAddress(), 0), 128);
+        server.createContext("/", exchange -> {
+            byte[] drain = new byte[8192];
+            try (InputStream requestBody = exchange.getRequestBody()) {
+                while (requestBody.read(drain) >= 0) {
+                }
+            }
+            exchange.sendResponseHeaders(200, responseBody.length == 0 ? -1 : responseBody.length);
+            try (OutputStream out = exchange.getResponseBody()) {
+                out.write(responseBody);
+            }
+        });
+        executor = Executors.newFixedThreadPool(threads, runnable -> {
+            Thread thread = new Thread(runnable, "loopback-h1");
+            thread.setDaemon(true);
+            return thread;
+        });
+        server.setExecutor(executor);
+        server.start();
+    }
+
+    /**
+     * @return the port the server is listening on
+     */
+    public int getPort() {
+        return server.getAddress().getPort();
+    }
+
+    @Override
+    public void close() {
+        server.stop(0);
+        executor.shutdownNow();
+    }
+}
@@ -0,0 +1,318 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.jmh;
+
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Set;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.LinkedBlockingQueue;
+
+/**
+ * A minimal cleartext HTTP/2 server (prior knowledge, no TLS) that answers every request with a 200 and a fixed
+ * size body. It only implements what the CRT client needs to complete requests: the preface, SETTINGS, PING and
+ * connection level flow control. Request headers are never decoded, and responses only use the static HPACK table,
+ * so no HPACK state is kept.
+ */
+public final class LoopbackHttp2Server implements AutoCloseable {
+
+    private static final byte[] PREFACE = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n".getBytes(StandardCharsets.US_ASCII);
+
+    private static final int FRAME_HEADER_SIZE = 9;
+    private static final int MAX_FRAME_SIZE = 16384;
+    private static final int DEFAULT_WINDOW_SIZE = 65535;
+
+    private static final int TYPE_DATA = 0x0;
+    private static final int TYPE_HEADERS = 0x1;
+    private static final int TYPE_SETTINGS = 0x4;
+    private static final int TYPE_PING = 0x6;
+    private static final int TYPE_GOAWAY = 0x7;
+    private static final int TYPE_WINDOW_UPDATE = 0x8;
+    private static final int TYPE_CONTINUATION = 0x9;
+
+    private static final int FLAG_END_STREAM = 0x1;
+    private static final int FLAG_ACK = 0x1;
+    private static final int FLAG_END_HEADERS = 0x4;
+
+    private static final int SETTINGS_INITIAL_WINDOW_SIZE = 0x4;
+
+    /* HPACK indexed header field 8 of the static table, ":status: 200" */
+    private static final byte[] RESPONSE_HEADER_BLOCK = new byte[] {(byte) 0x88};
+
+    private final ServerSocket serverSocket;
+    private final byte[] responseBody;
+    private final List<Connection> connections = new CopyOnWriteArrayList<>();
+    private final Thread acceptThread;
+    private volatile boolean closed;
+
+    /**
+     * Starts the server on an ephemeral loopback port
+     * @param responseBodySize number of body bytes sent with every response
+     * @throws IOException if the listening socket can't be opened
+     */
+    public LoopbackHttp2Server(int responseBodySize) throws IOException {
+        this.responseBody = new byte[responseBodySize];
+        Arrays.fill(this.responseBody, (byte) 'x');
+        this.serverSocket = new ServerSocket(0, 128, InetAddress.getLoopbackAddress());
+        this.acceptThread = new Thread(this::acceptLoop, "loopback-h2-accept");
+        this.acceptThread.setDaemon(true);
+        this.acceptThread.start();
+    }
+
+    /**
+     * @return the port the server is listening on
+     */
+    public int getPort() {
+        return serverSocket.getLocalPort();
+    }
+
+    @Override
+    public void close() throws IOException {
+        closed = true;
+        serverSocket.close();
+        for (Connection connection : connections) {
+            connection.close();
+        }
+    }
+
+    private void acceptLoop() {
+        while (!closed) {
+            try {
+                Socket socket = serverSocket.accept();
+                socket.setTcpNoDelay(true);
+                Connection connection = new Connection(socket);
+                connections.add(connection);
+                connection.start();
+            } catch (IOException ex) {
+                if (!closed) {
+                    ex.printStackTrace();
+                }
+            }
+        }
+    }
+
+    private final class Connection {
+        private final Socket socket;
+        private final DataInputStream input;
+        private final OutputStream output;
+        private final LinkedBlockingQueue<Integer> pendingResponses = new LinkedBlockingQueue<>();
+        private final Set<Integer> streamsAwaitingEndHeaders = new HashSet<>();
+
+        /* Protected by this */
+        private long connectionWindow = DEFAULT_WINDOW_SIZE;
+        private long initialStreamWindow = DEFAULT_WINDOW_SIZE;
+        private boolean done;
+
+        Connection(Socket socket) throws IOException {
+            this.socket = socket;
+            this.input = new DataInputStream(socket.getInputStream());
+            this.output = new BufferedOutputStream(socket.getOutputStream(), 64 * 1024);
+        }
+
+        void start() {
+            Thread reader = new Thread(this::readLoop, "loopback-h2-read");
+            reader.setDaemon(true);
+            reader.start();
+            Thread writer = new Thread(this::writeLoop, "loopback-h2-write");
+            writer.setDaemon(true);
+            writer.start();
+        }
+
+        void close() {
+            synchronized (this) {
+                done = true;
+                notifyAll();
+            }
+            pendingResponses.offer(0);
+            try {
+                socket.close();
+            } catch (IOException ex) {
+                /* closing anyway */
+            }
+        }
+
+        private void readLoop() {
+            try {
+                byte[] preface = new byte[PREFACE.length];
+                input.readFully(preface);
+                if (!Arrays.equals(preface, PREFACE)) {
+                    throw new IOException("Connection did not start with the HTTP/2 preface");
+                }
+                writeFrame(TYPE_SETTINGS, 0, 0, new byte[0], 0, 0, true);
+
+                byte[] header = new byte[FRAME_HEADER_SIZE];
+                byte[] payload = new byte[MAX_FRAME_SIZE];
+                while (true) {
+                    input.readFully(header);
+                    int length = ((header[0] & 0xFF) << 16) | ((header[1] & 0xFF) << 8) | (header[2] & 0xFF);
+                    int type = header[3] & 0xFF;
+                    int flags = header[4] & 0xFF;
+                    int streamId = readInt(header, 5) & 0x7FFFFFFF;
+                    if (length > payload.length) {
+                        payload = new byte[length];
+                    }
+                    input.readFully(payload, 0, length);
+
+                    switch (type) {
+                        case TYPE_HEADERS:
+                            if ((flags & FLAG_END_STREAM) != 0) {
+                                if ((flags & FLAG_END_HEADERS) != 0) {
+                                    pendingResponses.offer(streamId);
+                                } else {
+                                    streamsAwaitingEndHeaders.add(streamId);
+                                }
+                            }
+                            break;
+                        case TYPE_CONTINUATION:
+                            if ((flags & FLAG_END_HEADERS) != 0 && streamsAwaitingEndHeaders.remove(streamId)) {
+                                pendingResponses.offer(streamId);
+                            }
+                            break;
+                        case TYPE_DATA:
+                            if (length > 0) {
+                                /* Give back what the request body used, so uploads never stall */
+                                writeWindowUpdate(0, length);
+                                writeWindowUpdate(streamId, length);
+                            }
+                            if ((flags & FLAG_END_STREAM) != 0) {
+                                pendingResponses.offer(streamId);
+                            }
+                            break;
+                        case TYPE_SETTINGS:
+                            if ((flags & FLAG_ACK) == 0) {
+                                applySettings(payload, length);
+                                writeFrame(TYPE_SETTINGS, FLAG_ACK, 0, new byte[0], 0, 0, true);
+                            }
+                            break;
+                        case TYPE_PING:
+                            if ((flags & FLAG_ACK) == 0) {
+                                writeFrame(TYPE_PING, FLAG_ACK, 0, payload, 0, length, true);
+                            }
+                            break;
+                        case TYPE_WINDOW_UPDATE:
+                            if (streamId == 0) {
+                                synchronized (this) {
+                                    connectionWindow += readInt(payload, 0) & 0x7FFFFFFF;
+                                    notifyAll();
+                                }
+                            }
+                            break;
+                        case TYPE_GOAWAY:
+                            close();
+                            return;
+                        default:
+                            /* PRIORITY, RST_STREAM and anything unknown are ignored */
+                            break;
+                    }
+                }
+            } catch (IOException ex) {
+                /* peer went away */
+            } finally {
+                close();
+                connections.remove(this);
+            }
+        }
+
+        private void writeLoop() {
+            try {
+                while (true) {
+                    int streamId = pendingResponses.take();
+                    if (streamId == 0) {
+                        return;
+                    }
+
+                    boolean hasBody = responseBody.length > 0;
+                    int headersFlags = FLAG_END_HEADERS | (hasBody ? 0 : FLAG_END_STREAM);
+                    writeFrame(TYPE_HEADERS, headersFlags, streamId, RESPONSE_HEADER_BLOCK, 0,
+                            RESPONSE_HEADER_BLOCK.length, !hasBody && pendingResponses.isEmpty());
+
+                    int offset = 0;
+                    while (offset < responseBody.length) {
+                        int chunk = Math.min(MAX_FRAME_SIZE, responseBody.length - offset);
+                        if (!reserveWindow(chunk)) {
+                            return;
+                        }
+                        boolean last = offset + chunk == responseBody.length;
+                        writeFrame(TYPE_DATA, last ? FLAG_END_STREAM : 0, streamId, responseBody, offset, chunk,
+                                last && pendingResponses.isEmpty());
+                        offset += chunk;
+                    }
+                }
+            } catch (IOException | InterruptedException ex) {
+                /* connection is going away */
+            }
+        }
+
+        /*
+         * Waits until the client's connection window has room. Stream windows are never tracked, every response
+         * must fit in the initial stream window the client advertised.
+         */
+        private synchronized boolean reserveWindow(int size) throws InterruptedException, IOException {
+            if (responseBody.length > initialStreamWindow) {
+                throw new IllegalStateException("Response body is larger than the client's initial stream window");
+            }
+            while (!done && connectionWindow < size) {
+                output.flush();
+                wait();
+            }
+            connectionWindow -= size;
+            return !done;
+        }
+
+        private synchronized void applySettings(byte[] payload, int length) {
+            for (int offset = 0; offset + 6 <= length; offset += 6) {
+                int id = ((payload[offset] & 0xFF) << 8) | (payload[offset + 1] & 0xFF);
+                if (id == SETTINGS_INITIAL_WINDOW_SIZE) {
+                    initialStreamWindow = readInt(payload, offset + 2) & 0xFFFFFFFFL;
+                }
+            }
+        }
+
+        private void writeWindowUpdate(int streamId, int increment) throws IOException {
+            byte[] payload = new byte[4];
+            writeInt(payload, 0, increment);
+            writeFrame(TYPE_WINDOW_UPDATE, 0, streamId, payload, 0, payload.length, true);
+        }
+
+        private void writeFrame(int type, int flags, int streamId, byte[] payload, int offset, int length,
+                boolean flush) throws IOException {
+            byte[] header = new byte[FRAME_HEADER_SIZE];
+            header[0] = (byte) (length >>> 16);
+            header[1] = (byte) (length >>> 8);
+            header[2] = (byte) length;
+            header[3] = (byte) type;
+            header[4] = (byte) flags;
+            writeInt(header, 5, streamId);
+            synchronized (output) {
+                output.write(header);
+                output.write(payload, offset, length);
+                if (flush) {
+                    output.flush();
+                }
+            }
+        }
+    }
+
+    private static int readInt(byte[] buffer, int offset) {
+        return ((buffer[offset] & 0xFF) << 24) | ((buffer[offset + 1] & 0xFF) << 16)
+                | ((buffer[offset + 2] & 0xFF) << 8) | (buffer[offset + 3] & 0xFF);
+    }
+
+    private static void writeInt(byte[] buffer, int offset, int value) {
+        buffer[offset] = (byte) (value >>> 24);
+        buffer[offset + 1] = (byte) (value >>> 16);
+        buffer[offset + 2] = (byte) (value >>> 8);
+        buffer[offset + 3] = (byte) value;
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.jmh;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.UUID;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import software.amazon.awssdk.crt.eventstream.Header;
+import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpRequest;
+
+/**
+ * The Java side of moving HTTP and event-stream headers across the JNI boundary. These run entirely in Java,
+ * so they measure the encoding work and allocations done before and after every native call.
+ */
+@State(Scope.Thread)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class MarshallingBenchmark {
+
+    @Param({"4", "16", "64"})
+    public int headerCount;
+
+    private List<HttpHeader> httpHeaders;
+    private ByteBuffer marshalledHttpHeaders;
+    private HttpRequest request;
+    private List<Header> eventStreamHeaders;
+
+    @Setup
+    public void setup() {
+        httpHeaders = new ArrayList<>(headerCount);
+        eventStreamHeaders = new ArrayList<>(headerCount);
+        for (int i = 0; i < headerCount; ++i) {
+            httpHeaders.add(new HttpHeader("x-amz-benchmark-header-" + i, "value-" + UUID.randomUUID()));
+
+            switch (i % 4) {
+                case 0:
+                    eventStreamHeaders.add(Header.createHeader(":header-" + i, "value-" + UUID.randomUUID()));
+                    break;
+                case 1:
+                    eventStreamHeaders.add(Header.createHeader(":header-" + i, (long) i));
+                    break;
+                case 2:
+                    eventStreamHeaders.add(Header.createHeader(":header-" + i, UUID.randomUUID()));
+                    break;
+                default:
+                    eventStreamHeaders.add(Header.createHeader(":header-" + i, true));
+                    break;
+            }
+        }
+
+        marshalledHttpHeaders = ByteBuffer.wrap(HttpHeader.marshalHeadersForJni(httpHeaders));
+        request = new HttpRequest("GET", "/benchmark/object?versionId=1",
+                httpHeaders.toArray(new HttpHeader[0]), null);
+    }
+
+    @Benchmark
+    public byte[] marshalHttpHeaders() {
+        return HttpHeader.marshalHeadersForJni(httpHeaders);
+    }
+
+    @Benchmark
+    public HttpHeader[] loadHttpHeaders() {
+        return HttpHeader.loadHeadersFromMarshalledHeadersBlob(marshalledHttpHeaders.duplicate());
+    }
+
+    @Benchmark
+    public byte[] marshalHttpRequest() {
+        return request.marshalForJni();
+    }
+
+    @Benchmark
+    public byte[] marshalEventStreamHeaders() {
+        return Header.marshallHeadersForJNI(eventStreamHeaders);
+    }
+}
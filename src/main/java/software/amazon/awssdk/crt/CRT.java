@@ -532,10 +532,40 @@ public final class CRT {
         nativeCheckJniExceptionContract(clearException);
     }
 
+    /* Test-only: runs inside testCallbackDispatch(), on the dispatching native thread */
+    static volatile Runnable callbackDispatchHook;
+
+    static void testCallbackDispatch() {
+        Runnable hook = callbackDispatchHook;
+        if (hook != null) {
+            hook.run();
+        }
+    }
+
+    /*
+     * Test-only hook: threadCount native threads each call testCallbackDispatch() callbacksPerThread times, the way
+     * event loop threads deliver callbacks. Returns the nanoseconds spent dispatching, summed across threads.
+     */
+    static long measureCallbackDispatch(int threadCount, int callbacksPerThread) {
+        return nativeMeasureCallbackDispatch(threadCount, callbacksPerThread);
+    }
+
+    /*
+     * Test-only hook: invalidates every thread's cached JNIEnv the way the JVM shutdown hook does, waiting for the
+     * callbacks in flight on them, but leaves the JVM registered.
+     */
+    static void invalidateThreadEnvCaches() {
+        nativeInvalidateThreadEnvCaches();
+    }
+
     public static native boolean isFIPS();
 
     private static native void nativeCheckJniExceptionContract(boolean clearException);
 
+    private static native long nativeMeasureCallbackDispatch(int threadCount, int callbacksPerThread);
+
+    private static native void nativeInvalidateThreadEnvCaches();
+
     private static native void onJvmShutdown();
 
 };
@@ -5,12 +5,35 @@
 
 package software.amazon.awssdk.crt.auth.credentials;
 
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.atomic.AtomicLong;
+
 /**
  * A credentials provider that adds caching to another credentials provider via decoration
  */
 public class CachedCredentialsProvider extends CredentialsProvider {
 
+    /* How often getCredentialsNow() asks again while a refresh is due, e.g. after one failed */
+    private static final long REFRESH_REQUEST_INTERVAL_MILLIS = 1000;
+
+    /* Credentials along with when this provider stops using them, replaced as a whole so reads need no lock */
+    private static class CredentialsSnapshot {
+        final Credentials credentials;
+        final long expiresAtMillis;
+        /* When getCredentialsNow() next starts a refresh, pushed forward by whichever caller starts one */
+        final AtomicLong nextRefreshRequestMillis;
+
+        CredentialsSnapshot(Credentials credentials, long expiresAtMillis, long refreshAtMillis) {
+            this.credentials = credentials;
+            this.expiresAtMillis = expiresAtMillis;
+            this.nextRefreshRequestMillis = new AtomicLong(refreshAtMillis);
+        }
+    }
+
     private CredentialsProvider cachedProvider;
+    private final int cachingDurationInSeconds;
+    private final boolean refreshesAhead;
+    private volatile CredentialsSnapshot snapshot;
 
     /**
      * A simple builder class for a cached credentials provider and its options
@@ -18,6 +41,8 @@ public class CachedCredentialsProvider extends CredentialsProvider {
     static public class CachedCredentialsProviderBuilder {
 
         private int cachingDurationInSeconds;
+        private int refreshBeforeExpiryInSeconds;
+        private int refreshJitterInSeconds;
         private CredentialsProvider cachedProvider;
 
         /**
@@ -39,6 +64,41 @@ public class CachedCredentialsProvider extends CredentialsProvider {
 
         int getCachingDurationInSeconds() { return cachingDurationInSeconds; }
 
+        /**
+         * Sets how long before the cached credentials expire to start sourcing new ones.  The refresh is started by
+         * the first request for credentials in that window and runs in the background: until it completes, requests
+         * are still served the current credentials, so only requests made once there are no valid credentials at all
+         * wait on the wrapped provider.  A failed refresh is retried later on, as long as the current credentials
+         * remain valid.
+         * <p>
+         * With either this or {@link #withRefreshJitterInSeconds} set, a caching duration of zero means credentials
+         * are cached until they expire.  By default credentials are only refreshed once they have expired.
+         * </p>
+         * @param refreshBeforeExpiryInSeconds how long before expiry to refresh credentials, in seconds
+         * @return the provider builder
+         */
+        public CachedCredentialsProviderBuilder withRefreshBeforeExpiryInSeconds(int refreshBeforeExpiryInSeconds) {
+            this.refreshBeforeExpiryInSeconds = refreshBeforeExpiryInSeconds;
+
+            return this;
+        }
+
+        int getRefreshBeforeExpiryInSeconds() { return refreshBeforeExpiryInSeconds; }
+
+        /**
+         * Sets a random amount of time, up to this many seconds, to add to the refresh lead time each time credentials
+         * are sourced.  Spreads out the refreshes of many processes that started sourcing credentials together.
+         * @param refreshJitterInSeconds maximum extra refresh lead time, in seconds
+         * @return the provider builder
+         */
+        public CachedCredentialsProviderBuilder withRefreshJitterInSeconds(int refreshJitterInSeconds) {
+            this.refreshJitterInSeconds = refreshJitterInSeconds;
+
+            return this;
+        }
+
+        int getRefreshJitterInSeconds() { return refreshJitterInSeconds; }
+
         /**
          * Sets the credentials provider to cache results from
          * @param cachedProvider credentials provider to cache results from
@@ -65,15 +125,88 @@ public class CachedCredentialsProvider extends CredentialsProvider {
         super();
 
         cachedProvider = builder.getCachedProvider();
+        cachingDurationInSeconds = builder.getCachingDurationInSeconds();
+        refreshesAhead = builder.getRefreshBeforeExpiryInSeconds() > 0 || builder.getRefreshJitterInSeconds() > 0;
         addReferenceTo(cachedProvider);
 
-        long nativeHandle = cachedCredentialsProviderNew(this, builder.getCachingDurationInSeconds(), cachedProvider.getNativeHandle());
+        long nativeHandle = cachedCredentialsProviderNew(this, cachingDurationInSeconds,
+                builder.getRefreshBeforeExpiryInSeconds(), builder.getRefreshJitterInSeconds(),
+                cachedProvider.getNativeHandle());
         acquireNativeHandle(nativeHandle);
     }
 
+    /**
+     * Request credentials from the provider
+     * @return A Future for Credentials that will be completed when they are acquired.
+     */
+    @Override
+    public CompletableFuture<Credentials> getCredentials() {
+        CompletableFuture<Credentials> future = super.getCredentials();
+        if (!refreshesAhead) {
+            /* Without refresh ahead the native cache doesn't report what it sources, so note what comes back */
+            future.thenAccept(credentials -> {
+                long expiresAtMillis = Long.MAX_VALUE;
+                if (cachingDurationInSeconds > 0) {
+                    expiresAtMillis = System.currentTimeMillis() + cachingDurationInSeconds * 1000L;
+                }
+                long expirationSecs = credentials.getExpirationTimePointSecs();
+                if (expirationSecs > 0) {
+                    expiresAtMillis = Math.min(expiresAtMillis, expirationSecs * 1000L);
+                }
+                snapshot = new CredentialsSnapshot(credentials, expiresAtMillis, expiresAtMillis);
+            });
+        }
+        return future;
+    }
+
+    /**
+     * Returns the most recently sourced credentials without waiting and without any locking, for hot paths such as
+     * signing that can't wait on {@link #getCredentials()}.  With refresh ahead configured, the snapshot is replaced
+     * as soon as a background refresh completes; otherwise it is updated whenever {@link #getCredentials()}
+     * completes.
+     * <p>
+     * Once the snapshot is due for a refresh (inside the refresh window, or expired without refresh ahead), one
+     * caller starts it in the background without waiting on it, so a hot path that only uses this method keeps
+     * getting fresh credentials.
+     * </p>
+     * @return the current credentials, or null if none have been sourced yet or they have expired, in which case
+     * use {@link #getCredentials()}
+     */
+    public Credentials getCredentialsNow() {
+        CredentialsSnapshot current = snapshot;
+        if (current == null) {
+            return null;
+        }
+
+        long nowMillis = System.currentTimeMillis();
+        long nextRefreshRequestMillis = current.nextRefreshRequestMillis.get();
+        if (nowMillis >= nextRefreshRequestMillis && current.nextRefreshRequestMillis.compareAndSet(
+                nextRefreshRequestMillis, nowMillis + REFRESH_REQUEST_INTERVAL_MILLIS)) {
+            /* The result lands in a new snapshot, this call only has to get it started */
+            getCredentials();
+        }
+
+        if (nowMillis >= current.expiresAtMillis) {
+            return null;
+        }
+
+        return current.credentials;
+    }
+
+    /**
+     * Called from native when refresh ahead has sourced new credentials
+     * @param credentials the new credentials
+     * @param expiresAtMillis when this provider stops using them, as milliseconds since epoch
+     * @param refreshAtMillis when this provider starts sourcing their replacement, as milliseconds since epoch
+     */
+    private void onCredentialsRefreshed(Credentials credentials, long expiresAtMillis, long refreshAtMillis) {
+        snapshot = new CredentialsSnapshot(credentials, expiresAtMillis, refreshAtMillis);
+    }
+
     /*******************************************************************************
      * Native methods
      ******************************************************************************/
 
-    private static native long cachedCredentialsProviderNew(CachedCredentialsProvider thisObj, int cachingDurationInSeconds, long cachedProvider);
+    private static native long cachedCredentialsProviderNew(CachedCredentialsProvider thisObj, int cachingDurationInSeconds,
+            int refreshBeforeExpiryInSeconds, int refreshJitterInSeconds, long cachedProvider);
 }
@@ -6,6 +6,12 @@ package software.amazon.awssdk.crt.auth.credentials;
 
 /**
  * A class representing a set of AWS credentials.
+ * <p>
+ * Credentials are treated as immutable once handed to the CRT. A credentials provider hands the same instance to
+ * every caller while its credentials are unchanged, and the getters return the stored arrays rather than copies, so
+ * don't modify the arrays passed to the constructor or returned by the getters: that would change the credentials
+ * of every other user of a shared instance. Copy them first if they need to be scrubbed after use.
+ * </p>
  */
 public class Credentials {
 
@@ -59,17 +65,17 @@ public class Credentials {
     }
 
     /**
-     * @return the access key id of the credentials
+     * @return the access key id of the credentials, not to be modified
      */
     public byte[] getAccessKeyId() { return accessKeyId; }
 
     /**
-     * @return the secret access key of the credentials
+     * @return the secret access key of the credentials, not to be modified
      */
     public byte[] getSecretAccessKey() { return secretAccessKey; }
 
     /**
-     * @return the session token of the credentials
+     * @return the session token of the credentials, not to be modified
      */
     public byte[] getSessionToken() { return sessionToken; }
 
@@ -4,6 +4,8 @@
  */
 package software.amazon.awssdk.crt.auth.signing;
 
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
 import java.util.concurrent.CompletableFuture;
 import java.util.List;
 
@@ -16,6 +18,7 @@ import software.amazon.awssdk.crt.http.HttpRequestBodyStream;
  * Static class for a variety of AWS signing APIs.
  */
 public class AwsSigner {
+    private static final int BUFFER_INT_SIZE = 4;
 
     /**
      * Signs an http request according to the supplied signing configuration
@@ -125,6 +128,114 @@ public class AwsSigner {
         return future;
     }
 
+    /**
+     * Signs an http request with SigV4 synchronously, on the calling thread, and returns the headers that signing
+     * adds (X-Amz-Date, Authorization and, depending on the config, X-Amz-Security-Token and
+     * X-Amz-Content-Sha256). The request itself is not modified, add the headers to it before sending.
+     * <p>
+     * Unlike {@link #sign(HttpRequest, AwsSigningConfig)} there is no event loop hop, no future and no copy of the
+     * request body. The derived signing key is cached per (secret, date, region, service), so signing many requests
+     * with the same credentials on the same day only costs a couple of hashes each.
+     * </p>
+     * <p>
+     * Only SigV4 is supported, and the config must carry static credentials set via
+     * {@link AwsSigningConfig#setCredentials}; a credentials provider can't be resolved synchronously. The request
+     * body is never read: requests with a body stream must set a signed body value, such as
+     * {@link AwsSigningConfig.AwsSignedBodyValue#UNSIGNED_PAYLOAD} or a precomputed payload hash.
+     * </p>
+     * @param request http request to sign
+     * @param config signing configuration, with a signature type of HTTP_REQUEST_VIA_HEADERS
+     * @return the headers added by signing
+     * @throws IllegalArgumentException if the config or request can't be signed synchronously
+     */
+    static public HttpHeader[] signNow(HttpRequest request, AwsSigningConfig config) {
+        validateSignNowConfig(config, AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_HEADERS);
+
+        byte[] addedHeaders = awsSignerSignNow(request.marshalForJni(), request.getBodyStream() != null, config);
+        return HttpHeader.loadHeadersFromMarshalledHeadersBlob(ByteBuffer.wrap(addedHeaders));
+    }
+
+    /**
+     * Presigns an http request with SigV4 synchronously, on the calling thread, and returns the query params that
+     * signing adds, already encoded and joined with '&amp;' (X-Amz-Algorithm, X-Amz-Credential, X-Amz-Date,
+     * X-Amz-SignedHeaders, X-Amz-Expires, X-Amz-Signature and, with session credentials, X-Amz-Security-Token).
+     * Append them to the request's path, after a '?' or '&amp;' as appropriate, to build the presigned URL.
+     * <p>
+     * The same restrictions as {@link #signNow(HttpRequest, AwsSigningConfig)} apply. S3 presigned URLs should use
+     * {@link AwsSigningConfig.AwsSignedBodyValue#UNSIGNED_PAYLOAD} as the signed body value.
+     * </p>
+     * @param request http request to presign
+     * @param config signing configuration, with a signature type of HTTP_REQUEST_VIA_QUERY_PARAMS
+     * @return the encoded query params added by signing
+     * @throws IllegalArgumentException if the config or request can't be signed synchronously
+     */
+    static public String presignNow(HttpRequest request, AwsSigningConfig config) {
+        validateSignNowConfig(config, AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS);
+
+        byte[] addedParams = awsSignerSignNow(request.marshalForJni(), request.getBodyStream() != null, config);
+        return new String(addedParams, StandardCharsets.UTF_8);
+    }
+
+    /**
+     * Presigns a batch of requests that only differ by path, in one native call, and returns the presigned path and
+     * query of each. All of the requests share the method, the headers and the signing config, so the scope,
+     * credentials and signing key are only worked out once.
+     * <p>
+     * The same restrictions as {@link #presignNow(HttpRequest, AwsSigningConfig)} apply.
+     * </p>
+     * @param config signing configuration, with a signature type of HTTP_REQUEST_VIA_QUERY_PARAMS
+     * @param method http method of every request, e.g. "GET"
+     * @param paths encoded paths to presign, optionally with a query
+     * @param headers headers sent with every request, which must include Host
+     * @return for each path, in order, the path followed by the query params added by signing
+     * @throws IllegalArgumentException if the config or requests can't be signed synchronously
+     */
+    static public String[] presignBatch(AwsSigningConfig config, String method, List<String> paths,
+            HttpHeader[] headers) {
+        validateSignNowConfig(config, AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS);
+
+        byte[][] encodedPaths = new byte[paths.size()][];
+        int marshalledLength = 0;
+        for (int i = 0; i < encodedPaths.length; ++i) {
+            String path = paths.get(i);
+            if (path == null || path.isEmpty()) {
+                throw new IllegalArgumentException("presignBatch paths must not be null or empty");
+            }
+            encodedPaths[i] = path.getBytes(StandardCharsets.UTF_8);
+            marshalledLength += BUFFER_INT_SIZE + encodedPaths[i].length;
+        }
+
+        ByteBuffer marshalledPaths = ByteBuffer.allocate(marshalledLength);
+        for (byte[] path : encodedPaths) {
+            marshalledPaths.putInt(path.length);
+            marshalledPaths.put(path);
+        }
+
+        HttpRequest template = new HttpRequest(method, "", headers, null);
+        byte[] results = awsSignerPresignBatch(template.marshalForJni(), marshalledPaths.array(), config);
+
+        String[] presignedPaths = new String[encodedPaths.length];
+        ByteBuffer resultBuffer = ByteBuffer.wrap(results);
+        for (int i = 0; i < presignedPaths.length; ++i) {
+            int length = resultBuffer.getInt();
+            presignedPaths[i] = new String(results, resultBuffer.position(), length, StandardCharsets.UTF_8);
+            resultBuffer.position(resultBuffer.position() + length);
+        }
+        return presignedPaths;
+    }
+
+    private static void validateSignNowConfig(AwsSigningConfig config, AwsSigningConfig.AwsSignatureType type) {
+        if (config.getAlgorithm() != AwsSigningConfig.AwsSigningAlgorithm.SIGV4) {
+            throw new IllegalArgumentException("Synchronous signing only supports SIGV4");
+        }
+        if (config.getSignatureType() != type) {
+            throw new IllegalArgumentException("Synchronous signing requires a signature type of " + type);
+        }
+        if (config.getCredentials() == null) {
+            throw new IllegalArgumentException("Synchronous signing requires static credentials on the config");
+        }
+    }
+
     /*******************************************************************************
      * native methods
      ******************************************************************************/
@@ -145,4 +256,14 @@ public class AwsSigner {
         byte[] previousSignature,
         AwsSigningConfig config,
         CompletableFuture<AwsSigningResult> future) throws CrtRuntimeException;
+
+    private static native byte[] awsSignerSignNow(
+        byte[] marshalledRequest,
+        boolean hasBody,
+        AwsSigningConfig config) throws CrtRuntimeException;
+
+    private static native byte[] awsSignerPresignBatch(
+        byte[] marshalledRequest,
+        byte[] marshalledPaths,
+        AwsSigningConfig config) throws CrtRuntimeException;
 }
@@ -0,0 +1,235 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.auth.signing;
+
+import java.nio.ByteBuffer;
+import java.util.List;
+
+import software.amazon.awssdk.crt.CrtResource;
+import software.amazon.awssdk.crt.http.HttpHeader;
+
+/**
+ * Signs an aws-chunked request body with SigV4 one chunk at a time, synchronously on the calling thread.
+ * <p>
+ * Where {@link AwsSigner#signChunk} needs a body stream, a future and a JNI round trip per chunk, a ChunkSigner keeps
+ * the rolling signature natively and reads each chunk in place: direct buffers are never copied. It can also frame
+ * chunks, the final chunk and a signed trailer directly into a direct output buffer, ready to be sent as the body.
+ * </p>
+ * <p>
+ * The signing config must use SIGV4 with static credentials (see {@link AwsSigningConfig#setCredentials}), and the
+ * same region, service and time as the request that was signed. The seed signature is that request's signature.
+ * A ChunkSigner is not thread safe, chunks must be signed one at a time and in order.
+ * </p>
+ */
+public final class ChunkSigner extends CrtResource {
+
+    /* SigV4 signatures are hex encoded SHA-256 HMACs */
+    private static final int SIGNATURE_LENGTH = 64;
+    /* ";chunk-signature=<signature>\r\n" after the hex length, and "\r\n" after the data */
+    private static final int CHUNK_FRAMING_LENGTH = ";chunk-signature=".length() + SIGNATURE_LENGTH + 2 + 2;
+    /* "x-amz-trailer-signature:<signature>\r\n" */
+    private static final int TRAILER_SIGNATURE_LENGTH = "x-amz-trailer-signature:".length() + SIGNATURE_LENGTH + 2;
+
+    /**
+     * Creates a new chunk signer
+     * @param config signing configuration, for SIGV4 with static credentials
+     * @param seedSignature signature of the request the chunks belong to
+     * @throws IllegalArgumentException if the config or seed signature is not supported
+     */
+    public ChunkSigner(AwsSigningConfig config, byte[] seedSignature) {
+        if (config.getAlgorithm() != AwsSigningConfig.AwsSigningAlgorithm.SIGV4) {
+            throw new IllegalArgumentException("ChunkSigner only supports SIGV4");
+        }
+        if (config.getCredentials() == null) {
+            throw new IllegalArgumentException("ChunkSigner requires static credentials on the config");
+        }
+        if (seedSignature == null || seedSignature.length != SIGNATURE_LENGTH) {
+            throw new IllegalArgumentException("Seed signature must be a 64 character hex SigV4 signature");
+        }
+
+        acquireNativeHandle(chunkSignerNew(config, seedSignature));
+    }
+
+    /**
+     * Determines whether a resource releases its dependencies at the same time the native handle is released or if it waits.
+     * Resources that wait are responsible for calling releaseReferences() manually.
+     */
+    @Override
+    protected boolean canReleaseReferencesImmediately() { return true; }
+
+    /**
+     * Releases the instance's reference to the underlying native chunk signer
+     */
+    @Override
+    protected void releaseNativeHandle() {
+        if (!isNull()) {
+            chunkSignerDestroy(getNativeHandle());
+        }
+    }
+
+    /**
+     * Signs the remaining bytes of a chunk, which become the previous signature for the next one. The chunk's
+     * position is moved to its limit. An empty chunk is the final chunk of the body.
+     * @param chunk chunk data, direct buffers are read in place
+     * @return the chunk's signature, as hex
+     */
+    public byte[] signChunk(ByteBuffer chunk) {
+        int length = chunk.remaining();
+        byte[] signature = chunkSignerSignChunk(getNativeHandle(), directOrNull(chunk), arrayOrNull(chunk),
+                arrayOffset(chunk), length);
+        chunk.position(chunk.limit());
+        return signature;
+    }
+
+    /**
+     * Signs the final, empty, chunk of the body
+     * @return the final chunk's signature, as hex
+     */
+    public byte[] signFinalChunk() {
+        return chunkSignerSignChunk(getNativeHandle(), null, null, 0, 0);
+    }
+
+    /**
+     * Signs the trailing headers sent after the final chunk
+     * @param headers trailing headers
+     * @return the trailer's signature, as hex
+     */
+    public byte[] signTrailingHeaders(List<HttpHeader> headers) {
+        return chunkSignerSignTrailingHeaders(getNativeHandle(), HttpHeader.marshalHeadersForJni(headers));
+    }
+
+    /**
+     * @return the signature of whatever was signed last, or the seed signature if nothing has been signed yet
+     */
+    public byte[] getPreviousSignature() {
+        return chunkSignerGetPreviousSignature(getNativeHandle());
+    }
+
+    /**
+     * @param dataLength length of the chunk data
+     * @return number of bytes {@link #writeChunk} writes for a chunk of this length
+     */
+    public static int getFramedChunkLength(int dataLength) {
+        return Integer.toHexString(dataLength).length() + CHUNK_FRAMING_LENGTH + dataLength;
+    }
+
+    /**
+     * @param trailingHeaders trailing headers, or null for none
+     * @return number of bytes {@link #writeFinalChunk} writes for these trailing headers
+     */
+    public static int getFinalChunkLength(List<HttpHeader> trailingHeaders) {
+        int trailerLength = 0;
+        if (trailingHeaders != null) {
+            for (HttpHeader header : trailingHeaders) {
+                if (header.getNameBytes().length > 0) {
+                    trailerLength += header.getNameBytes().length + 1 + header.getValueBytes().length + 2;
+                }
+            }
+        }
+        if (trailerLength > 0) {
+            trailerLength += TRAILER_SIGNATURE_LENGTH;
+        }
+        return getFramedChunkLength(0) + trailerLength;
+    }
+
+    /**
+     * Signs the remaining bytes of a chunk and writes the framed chunk, header, data and CRLF, to output. The
+     * chunk's position is moved to its limit and output's position past what was written.
+     * @param chunk chunk data, must not be empty; use {@link #writeFinalChunk} to end the body
+     * @param output direct buffer with at least {@link #getFramedChunkLength} bytes remaining
+     * @return number of bytes written
+     */
+    public int writeChunk(ByteBuffer chunk, ByteBuffer output) {
+        int length = chunk.remaining();
+        if (length == 0) {
+            throw new IllegalArgumentException("ChunkSigner.writeChunk: chunk is empty, use writeFinalChunk");
+        }
+        checkOutput(output, getFramedChunkLength(length));
+
+        int written = chunkSignerWriteChunk(getNativeHandle(), directOrNull(chunk), arrayOrNull(chunk),
+                arrayOffset(chunk), length, output, output.position(), output.remaining());
+        chunk.position(chunk.limit());
+        output.position(output.position() + written);
+        return written;
+    }
+
+    /**
+     * Signs and writes the end of the body to output: the final, empty, chunk and, if there are trailing headers,
+     * the trailer and its signature. Trailing header names are written lowercased, as they are signed, and headers
+     * with an empty name are skipped. Output's position is moved past what was written.
+     * @param trailingHeaders trailing headers, or null for none
+     * @param output direct buffer with at least {@link #getFinalChunkLength} bytes remaining
+     * @return number of bytes written
+     */
+    public int writeFinalChunk(List<HttpHeader> trailingHeaders, ByteBuffer output) {
+        checkOutput(output, getFinalChunkLength(trailingHeaders));
+
+        byte[] marshalledTrailer = null;
+        if (trailingHeaders != null && !trailingHeaders.isEmpty()) {
+            marshalledTrailer = HttpHeader.marshalHeadersForJni(trailingHeaders);
+            if (marshalledTrailer.length == 0) {
+                marshalledTrailer = null;
+            }
+        }
+
+        int written = chunkSignerWriteFinalChunk(getNativeHandle(), marshalledTrailer, output, output.position(),
+                output.remaining());
+        output.position(output.position() + written);
+        return written;
+    }
+
+    private static void checkOutput(ByteBuffer output, int length) {
+        if (!output.isDirect()) {
+            throw new IllegalArgumentException("ChunkSigner output must be a direct ByteBuffer");
+        }
+        if (output.remaining() < length) {
+            throw new IllegalArgumentException("ChunkSigner output needs " + length + " bytes remaining");
+        }
+    }
+
+    /* Chunk data goes down either as a direct buffer or as an array, heap buffers without one are copied */
+    private static ByteBuffer directOrNull(ByteBuffer chunk) {
+        return chunk.isDirect() ? chunk : null;
+    }
+
+    private static byte[] arrayOrNull(ByteBuffer chunk) {
+        if (chunk.isDirect()) {
+            return null;
+        }
+        if (chunk.hasArray()) {
+            return chunk.array();
+        }
+        byte[] copy = new byte[chunk.remaining()];
+        chunk.duplicate().get(copy);
+        return copy;
+    }
+
+    private static int arrayOffset(ByteBuffer chunk) {
+        if (chunk.isDirect()) {
+            return chunk.position();
+        }
+        return chunk.hasArray() ? chunk.arrayOffset() + chunk.position() : 0;
+    }
+
+    /*******************************************************************************
+     * native methods
+     ******************************************************************************/
+    private static native long chunkSignerNew(AwsSigningConfig config, byte[] seedSignature);
+
+    private static native void chunkSignerDestroy(long signer);
+
+    private static native byte[] chunkSignerSignChunk(long signer, ByteBuffer chunkBuffer, byte[] chunkArray,
+            int offset, int length);
+
+    private static native int chunkSignerWriteChunk(long signer, ByteBuffer chunkBuffer, byte[] chunkArray,
+            int offset, int length, ByteBuffer output, int outputOffset, int outputLength);
+
+    private static native byte[] chunkSignerSignTrailingHeaders(long signer, byte[] marshalledHeaders);
+
+    private static native int chunkSignerWriteFinalChunk(long signer, byte[] marshalledTrailer, ByteBuffer output,
+            int outputOffset, int outputLength);
+
+    private static native byte[] chunkSignerGetPreviousSignature(long signer);
+}
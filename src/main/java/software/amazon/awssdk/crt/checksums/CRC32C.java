@@ -5,6 +5,8 @@
 package software.amazon.awssdk.crt.checksums;
 
 import software.amazon.awssdk.crt.CRT;
+
+import java.nio.ByteBuffer;
 import java.util.zip.Checksum;
 
 /**
@@ -80,8 +82,74 @@ public class CRC32C implements Checksum, Cloneable {
         this.update(buf);
     }
 
+    /**
+     * Updates the current checksum with the bytes from the buffer's position to its limit, then moves the position
+     * to the limit. Direct buffers are checksummed in place, without copying their contents.
+     *
+     * @param buffer the ByteBuffer to update the checksum with
+     */
+    public void update(ByteBuffer buffer) {
+        int position = buffer.position();
+        int length = buffer.remaining();
+        if (length == 0) {
+            return;
+        }
+
+        if (buffer.isDirect()) {
+            value = crc32cDirect(buffer, value, position, length);
+        } else if (buffer.hasArray()) {
+            value = crc32c(buffer.array(), value, buffer.arrayOffset() + position, length);
+        } else {
+            ChecksumByteBuffers.updateByCopy(this, buffer);
+            return;
+        }
+        buffer.position(position + length);
+    }
+
+    /**
+     * Updates the current checksum with the remaining bytes of each buffer in turn, the same as calling
+     * {@link #update(ByteBuffer)} on each of them. When every buffer is direct, they are all checksummed
+     * in a single native call.
+     *
+     * @param buffers the ByteBuffers to update the checksum with
+     */
+    public void update(ByteBuffer[] buffers) {
+        if (ChecksumByteBuffers.allDirect(buffers)) {
+            value = crc32cDirectArray(buffers, ChecksumByteBuffers.positions(buffers),
+                    ChecksumByteBuffers.lengths(buffers), value);
+            ChecksumByteBuffers.consume(buffers);
+        } else {
+            for (ByteBuffer buffer : buffers) {
+                update(buffer);
+            }
+        }
+    }
+
+    /**
+     * Combines the checksums of two consecutive blocks of data into the checksum of their concatenation, without
+     * needing the data itself. This lets pieces of a large object be checksummed independently, e.g. in parallel,
+     * and then joined in order.
+     *
+     * @param crcA the checksum of the first block, as returned by {@link #getValue()}
+     * @param crcB the checksum of the second block, as returned by {@link #getValue()}
+     * @param lengthB the length of the second block in bytes
+     * @return the checksum of the first block followed by the second
+     */
+    public static long combine(long crcA, long crcB, long lengthB) {
+        if (lengthB < 0) {
+            throw new IllegalArgumentException("lengthB must not be negative");
+        }
+        return (long) crc32cCombine((int) crcA, (int) crcB, lengthB) & 0xffffffffL;
+    }
+
     /*******************************************************************************
      * native methods
      ******************************************************************************/
     private static native int crc32c(byte[] input, int previous, int offset, int length);
+
+    private static native int crc32cDirect(ByteBuffer input, int previous, int position, int length);
+
+    private static native int crc32cDirectArray(ByteBuffer[] inputs, int[] positions, int[] lengths, int previous);
+
+    private static native int crc32cCombine(int crcA, int crcB, long lengthB);
 }
@@ -0,0 +1,59 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.checksums;
+
+import java.nio.ByteBuffer;
+import java.util.zip.Checksum;
+
+/**
+ * ByteBuffer handling shared by the CRC implementations
+ */
+final class ChecksumByteBuffers {
+    /* Heap buffers that don't expose their array (read-only ones) are copied through a scratch array this big */
+    private static final int COPY_CHUNK_SIZE = 8192;
+
+    private ChecksumByteBuffers() {}
+
+    static boolean allDirect(ByteBuffer[] buffers) {
+        for (ByteBuffer buffer : buffers) {
+            if (!buffer.isDirect()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static int[] positions(ByteBuffer[] buffers) {
+        int[] positions = new int[buffers.length];
+        for (int i = 0; i < buffers.length; ++i) {
+            positions[i] = buffers[i].position();
+        }
+        return positions;
+    }
+
+    static int[] lengths(ByteBuffer[] buffers) {
+        int[] lengths = new int[buffers.length];
+        for (int i = 0; i < buffers.length; ++i) {
+            lengths[i] = buffers[i].remaining();
+        }
+        return lengths;
+    }
+
+    /* Moves every buffer's position to its limit, once its contents have been checksummed */
+    static void consume(ByteBuffer[] buffers) {
+        for (ByteBuffer buffer : buffers) {
+            buffer.position(buffer.limit());
+        }
+    }
+
+    static void updateByCopy(Checksum checksum, ByteBuffer buffer) {
+        byte[] chunk = new byte[Math.min(buffer.remaining(), COPY_CHUNK_SIZE)];
+        while (buffer.hasRemaining()) {
+            int length = Math.min(buffer.remaining(), chunk.length);
+            buffer.get(chunk, 0, length);
+            checksum.update(chunk, 0, length);
+        }
+    }
+}
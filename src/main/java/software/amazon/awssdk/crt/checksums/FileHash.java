@@ -0,0 +1,164 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.checksums;
+
+import software.amazon.awssdk.crt.CRT;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.Executor;
+
+/**
+ * Hashes and checksums of local files, computed natively. The file is read a chunk at a time into a native buffer,
+ * so none of its contents pass through the Java heap. A file that can't be opened or read, or that shrinks while it
+ * is hashed, fails the call with an IOException.
+ */
+public final class FileHash {
+    static {
+        new CRT();
+    };
+
+    /* Passed as the length to hash from the offset to the end of the file */
+    private static final long TO_END_OF_FILE = -1;
+
+    /**
+     * Supported algorithms. Digests are returned big endian, as XXHash.digest() returns them and as S3 expects
+     * checksums to be encoded.
+     */
+    public enum Algorithm {
+        CRC32(0),
+        CRC32C(1),
+        CRC64NVME(2),
+        XXHASH64(3),
+        XXHASH3_64(4),
+        XXHASH3_128(5);
+
+        Algorithm(int nativeValue) {
+            this.nativeValue = nativeValue;
+        }
+
+        int getNativeValue() {
+            return nativeValue;
+        }
+
+        private final int nativeValue;
+    }
+
+    private FileHash() {}
+
+    /**
+     * Hashes a whole file.
+     *
+     * @param algorithm the hash to compute
+     * @param path the file to hash
+     * @return the digest, big endian
+     * @throws IOException if the file doesn't exist or can't be read
+     */
+    public static byte[] hashFile(Algorithm algorithm, Path path) throws IOException {
+        return hashFile(algorithm, path, 0, TO_END_OF_FILE, 0);
+    }
+
+    /**
+     * Hashes a range of a file.
+     *
+     * @param algorithm the hash to compute
+     * @param path the file to hash
+     * @param offset offset of the first byte to hash
+     * @param length number of bytes to hash, the range must lie within the file
+     * @return the digest, big endian
+     * @throws IOException if the file doesn't exist or can't be read
+     */
+    public static byte[] hashFile(Algorithm algorithm, Path path, long offset, long length) throws IOException {
+        return hashFile(algorithm, path, offset, length, 0);
+    }
+
+    /**
+     * Hashes a range of a file, with a seed for the XXHash algorithms.
+     *
+     * @param algorithm the hash to compute
+     * @param path the file to hash
+     * @param offset offset of the first byte to hash
+     * @param length number of bytes to hash, the range must lie within the file
+     * @param seed seed for XXHash, ignored by the CRCs
+     * @return the digest, big endian
+     * @throws IOException if the file doesn't exist or can't be read
+     */
+    public static byte[] hashFile(Algorithm algorithm, Path path, long offset, long length, long seed)
+            throws IOException {
+        if (offset < 0 || (length < 0 && length != TO_END_OF_FILE)) {
+            throw new IllegalArgumentException("offset and length must not be negative");
+        }
+        if (!Files.isRegularFile(path)) {
+            throw new NoSuchFileException(path.toString());
+        }
+        return fileHashCompute(path.toString(), algorithm.getNativeValue(), offset, length, seed);
+    }
+
+    /**
+     * Hashes a file as consecutive segments of segmentSize bytes, each segment on its own task, and returns one
+     * digest per segment. This is meant for XXHASH3_128 fixed-size chunk dedup, where every segment's hash is wanted
+     * and the segments are independent. The last segment may be shorter than segmentSize.
+     *
+     * @param algorithm the hash to compute for each segment
+     * @param path the file to hash
+     * @param segmentSize number of bytes in each segment
+     * @param executor where the segments are hashed; pass a multi-threaded executor to hash them concurrently
+     * @return the digest of each segment in file order, empty for an empty file
+     * @throws IOException if the file doesn't exist, its size can't be read or a segment can't be read
+     */
+    public static byte[][] hashFileSegments(Algorithm algorithm, Path path, long segmentSize, Executor executor)
+            throws IOException {
+        if (segmentSize <= 0) {
+            throw new IllegalArgumentException("segmentSize must be positive");
+        }
+        if (!Files.isRegularFile(path)) {
+            throw new NoSuchFileException(path.toString());
+        }
+
+        String nativePath = path.toString();
+        long size = Files.size(path);
+        List<CompletableFuture<byte[]>> segments = new ArrayList<>();
+        for (long offset = 0; offset < size; offset += segmentSize) {
+            final long segmentOffset = offset;
+            final long segmentLength = Math.min(segmentSize, size - offset);
+            segments.add(CompletableFuture.supplyAsync(() -> {
+                try {
+                    return fileHashCompute(nativePath, algorithm.getNativeValue(), segmentOffset, segmentLength, 0);
+                } catch (IOException ex) {
+                    throw new UncheckedIOException(ex);
+                }
+            }, executor));
+        }
+
+        byte[][] digests = new byte[segments.size()][];
+        for (int i = 0; i < digests.length; ++i) {
+            try {
+                digests[i] = segments.get(i).join();
+            } catch (CompletionException ex) {
+                if (ex.getCause() instanceof UncheckedIOException) {
+                    throw ((UncheckedIOException) ex.getCause()).getCause();
+                }
+                if (ex.getCause() instanceof RuntimeException) {
+                    throw (RuntimeException) ex.getCause();
+                }
+                throw ex;
+            }
+        }
+        return digests;
+    }
+
+    /*******************************************************************************
+     * native methods
+     ******************************************************************************/
+    private static native byte[] fileHashCompute(String path, int algorithm, long offset, long length, long seed)
+            throws IOException;
+}
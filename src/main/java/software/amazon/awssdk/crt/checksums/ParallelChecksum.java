@@ -0,0 +1,186 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.checksums;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executor;
+import java.util.concurrent.ForkJoinPool;
+
+/**
+ * Computes a full object CRC by splitting the data into parts, checksumming the parts concurrently on an Executor,
+ * then joining the part checksums in order with the algorithm's combine(). The result is identical to a single
+ * serial update() over the whole object.
+ */
+public final class ParallelChecksum {
+
+    /**
+     * Default size of the parts the data is split into
+     */
+    public static final int DEFAULT_PART_SIZE = 8 * 1024 * 1024;
+
+    /**
+     * The CRC algorithms that support combining
+     */
+    public enum Algorithm {
+        CRC32 {
+            @Override
+            long checksum(ByteBuffer part) {
+                software.amazon.awssdk.crt.checksums.CRC32 checksum =
+                        new software.amazon.awssdk.crt.checksums.CRC32();
+                checksum.update(part);
+                return checksum.getValue();
+            }
+
+            @Override
+            long combine(long crcA, long crcB, long lengthB) {
+                return software.amazon.awssdk.crt.checksums.CRC32.combine(crcA, crcB, lengthB);
+            }
+        },
+
+        CRC32C {
+            @Override
+            long checksum(ByteBuffer part) {
+                software.amazon.awssdk.crt.checksums.CRC32C checksum =
+                        new software.amazon.awssdk.crt.checksums.CRC32C();
+                checksum.update(part);
+                return checksum.getValue();
+            }
+
+            @Override
+            long combine(long crcA, long crcB, long lengthB) {
+                return software.amazon.awssdk.crt.checksums.CRC32C.combine(crcA, crcB, lengthB);
+            }
+        },
+
+        CRC64NVME {
+            @Override
+            long checksum(ByteBuffer part) {
+                software.amazon.awssdk.crt.checksums.CRC64NVME checksum =
+                        new software.amazon.awssdk.crt.checksums.CRC64NVME();
+                checksum.update(part);
+                return checksum.getValue();
+            }
+
+            @Override
+            long combine(long crcA, long crcB, long lengthB) {
+                return software.amazon.awssdk.crt.checksums.CRC64NVME.combine(crcA, crcB, lengthB);
+            }
+        };
+
+        abstract long checksum(ByteBuffer part);
+
+        abstract long combine(long crcA, long crcB, long lengthB);
+    }
+
+    private ParallelChecksum() {}
+
+    /**
+     * Checksums the remaining bytes of a buffer in parts of DEFAULT_PART_SIZE on the common ForkJoinPool, then moves
+     * the buffer's position to its limit.
+     *
+     * @param algorithm the CRC to compute
+     * @param buffer the data to checksum, direct buffers are read in place
+     * @return the checksum of the buffer's remaining bytes, as getValue() would return it
+     */
+    public static long checksum(Algorithm algorithm, ByteBuffer buffer) {
+        return checksum(algorithm, buffer, DEFAULT_PART_SIZE, ForkJoinPool.commonPool());
+    }
+
+    /**
+     * Checksums the remaining bytes of a buffer in parts, concurrently, then moves the buffer's position to its
+     * limit. The buffer must not be modified until this returns.
+     *
+     * @param algorithm the CRC to compute
+     * @param buffer the data to checksum, direct buffers are read in place
+     * @param partSize number of bytes checksummed by each task
+     * @param executor where the parts are checksummed
+     * @return the checksum of the buffer's remaining bytes, as getValue() would return it
+     */
+    public static long checksum(Algorithm algorithm, ByteBuffer buffer, int partSize, Executor executor) {
+        validatePartSize(partSize);
+
+        List<CompletableFuture<Long>> parts = new ArrayList<>();
+        List<Integer> lengths = new ArrayList<>();
+        for (int offset = buffer.position(); offset < buffer.limit(); ) {
+            int length = Math.min(partSize, buffer.limit() - offset);
+            ByteBuffer part = buffer.duplicate();
+            part.limit(offset + length);
+            part.position(offset);
+            lengths.add(length);
+            parts.add(CompletableFuture.supplyAsync(() -> algorithm.checksum(part), executor));
+            offset += length;
+        }
+
+        long result = join(algorithm, parts, lengths);
+        buffer.position(buffer.limit());
+        return result;
+    }
+
+    /**
+     * Checksums a whole file in parts of DEFAULT_PART_SIZE on the common ForkJoinPool
+     *
+     * @param algorithm the CRC to compute
+     * @param file the file to checksum
+     * @return the checksum of the file's contents, as getValue() would return it
+     * @throws IOException if the file can't be opened or mapped
+     */
+    public static long checksum(Algorithm algorithm, Path file) throws IOException {
+        return checksum(algorithm, file, DEFAULT_PART_SIZE, ForkJoinPool.commonPool());
+    }
+
+    /**
+     * Checksums a whole file in parts, concurrently. Each part is memory mapped and checksummed in place, so the
+     * file's contents are never copied onto the Java heap.
+     *
+     * @param algorithm the CRC to compute
+     * @param file the file to checksum
+     * @param partSize number of bytes checksummed by each task
+     * @param executor where the parts are checksummed
+     * @return the checksum of the file's contents, as getValue() would return it
+     * @throws IOException if the file can't be opened or mapped
+     */
+    public static long checksum(Algorithm algorithm, Path file, int partSize, Executor executor)
+            throws IOException {
+        validatePartSize(partSize);
+
+        try (FileChannel channel = FileChannel.open(file, StandardOpenOption.READ)) {
+            long size = channel.size();
+            List<CompletableFuture<Long>> parts = new ArrayList<>();
+            List<Integer> lengths = new ArrayList<>();
+            for (long offset = 0; offset < size; offset += partSize) {
+                int length = (int) Math.min(partSize, size - offset);
+                MappedByteBuffer part = channel.map(FileChannel.MapMode.READ_ONLY, offset, length);
+                lengths.add(length);
+                parts.add(CompletableFuture.supplyAsync(() -> algorithm.checksum(part), executor));
+            }
+
+            return join(algorithm, parts, lengths);
+        }
+    }
+
+    private static void validatePartSize(int partSize) {
+        if (partSize <= 0) {
+            throw new IllegalArgumentException("partSize must be positive");
+        }
+    }
+
+    /* Waits for every part and combines them in order. An empty input has the checksum of no data, which is 0. */
+    private static long join(Algorithm algorithm, List<CompletableFuture<Long>> parts, List<Integer> lengths) {
+        long result = 0;
+        for (int i = 0; i < parts.size(); ++i) {
+            long partChecksum = parts.get(i).join();
+            result = i == 0 ? partChecksum : algorithm.combine(result, partChecksum, lengths.get(i));
+        }
+        return result;
+    }
+}
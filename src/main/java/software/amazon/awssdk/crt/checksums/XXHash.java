@@ -5,10 +5,24 @@
 package software.amazon.awssdk.crt.checksums;
 import software.amazon.awssdk.crt.CrtResource;
 
+import java.nio.ByteBuffer;
+
 public class XXHash extends CrtResource {
-    
-    private XXHash(long nativeHandle) {
+
+    /* Must match the hash types in xxhash.c */
+    private static final int TYPE_XXHASH64 = 0;
+    private static final int TYPE_XXHASH3_64 = 1;
+    private static final int TYPE_XXHASH3_128 = 2;
+
+    private final int type;
+    private final long seed;
+    /* Digests land here before being handed out as longs or copied into a ByteBuffer */
+    private final byte[] scratch = new byte[16];
+
+    private XXHash(long nativeHandle, int type, long seed) {
         acquireNativeHandle(nativeHandle);
+        this.type = type;
+        this.seed = seed;
     }
 
     /**
@@ -35,7 +49,7 @@ public class XXHash extends CrtResource {
      */
     static public XXHash newXXHash64(long seed) {
         long nativeHandle = xxHash64Create(seed);
-        return new XXHash(nativeHandle);
+        return new XXHash(nativeHandle, TYPE_XXHASH64, seed);
     }
 
 
@@ -45,7 +59,7 @@ public class XXHash extends CrtResource {
      */
     static public XXHash newXXHash64() {
         long nativeHandle = xxHash64Create(0);
-        return new XXHash(nativeHandle);
+        return new XXHash(nativeHandle, TYPE_XXHASH64, 0);
     }
 
     /**
@@ -55,7 +69,7 @@ public class XXHash extends CrtResource {
      */
     static public XXHash newXXHash3_64(long seed) {
         long nativeHandle = xxHash364Create(seed);
-        return new XXHash(nativeHandle);
+        return new XXHash(nativeHandle, TYPE_XXHASH3_64, seed);
     }
 
     /**
@@ -65,7 +79,7 @@ public class XXHash extends CrtResource {
     static public XXHash newXXHash3_64() {
         long nativeHandle = xxHash364Create(0);
         if (nativeHandle != 0) {
-            return new XXHash(nativeHandle);
+            return new XXHash(nativeHandle, TYPE_XXHASH3_64, 0);
         }
 
         return null;
@@ -79,7 +93,7 @@ public class XXHash extends CrtResource {
     static public XXHash newXXHash3_128(long seed) {
         long nativeHandle = xxHash3128Create(seed);
         if (nativeHandle != 0) {
-            return new XXHash(nativeHandle);
+            return new XXHash(nativeHandle, TYPE_XXHASH3_128, seed);
         }
 
         return null;
@@ -92,7 +106,7 @@ public class XXHash extends CrtResource {
     static public XXHash newXXHash3_128() {
         long nativeHandle = xxHash3128Create(0);
         if (nativeHandle != 0) {
-            return new XXHash(nativeHandle);
+            return new XXHash(nativeHandle, TYPE_XXHASH3_128, 0);
         }
 
         return null;
@@ -143,6 +157,216 @@ public class XXHash extends CrtResource {
         return xxHashFinalize(getNativeHandle());
     }
 
+    /**
+     * Resets the hash to its initial state, with the seed it was created with, so the instance can be reused.
+     */
+    public void reset() {
+        reset(seed);
+    }
+
+    /**
+     * Resets the hash to its initial state with a new seed, so the instance can be reused.
+     * @param seed seed to use for the hash
+     */
+    public void reset(long seed) {
+        xxHashReset(getNativeHandle(), seed);
+    }
+
+    /**
+     * @return the size of this hash's digest in bytes
+     */
+    public int getDigestSize() {
+        return type == TYPE_XXHASH3_128 ? 16 : 8;
+    }
+
+    /**
+     * Writes the digest for the current state of hash into an existing array, rather than allocating a new one.
+     * @param out array to write the digest to, big endian
+     * @param offset where in out to write the digest
+     * @return number of bytes written, the same as getDigestSize()
+     */
+    public int digest(byte[] out, int offset) {
+        if (out == null) {
+            throw new NullPointerException();
+        }
+        if (offset < 0 || offset > out.length - getDigestSize()) {
+            throw new ArrayIndexOutOfBoundsException();
+        }
+        return xxHashFinalizeInto(getNativeHandle(), out, offset);
+    }
+
+    /**
+     * Writes the digest for the current state of hash at the buffer's position, and advances the position past it.
+     * @param out buffer to write the digest to, big endian
+     * @return number of bytes written, the same as getDigestSize()
+     */
+    public int digest(ByteBuffer out) {
+        int size = getDigestSize();
+        if (out.remaining() < size) {
+            throw new java.nio.BufferOverflowException();
+        }
+        if (out.hasArray()) {
+            digest(out.array(), out.arrayOffset() + out.position());
+            out.position(out.position() + size);
+        } else {
+            digest(scratch, 0);
+            out.put(scratch, 0, size);
+        }
+        return size;
+    }
+
+    /**
+     * Returns the digest for the current state of an XXHash64 or XXHash3_64 hash as a long, without allocating.
+     * @return the 64-bit hash
+     */
+    public long digestLong() {
+        if (type == TYPE_XXHASH3_128) {
+            throw new IllegalStateException("XXHash3_128 digests don't fit in a long, use digest128()");
+        }
+        digest(scratch, 0);
+        return readLong(scratch, 0);
+    }
+
+    /**
+     * Writes the digest for the current state of an XXHash3_128 hash as two longs, without allocating.
+     * @param out array to write the high 64 bits then the low 64 bits to
+     * @param offset where in out to write the high 64 bits
+     */
+    public void digest128(long[] out, int offset) {
+        if (type != TYPE_XXHASH3_128) {
+            throw new IllegalStateException("digest128() is only for XXHash3_128, use digestLong()");
+        }
+        if (offset < 0 || offset > out.length - 2) {
+            throw new ArrayIndexOutOfBoundsException();
+        }
+        digest(scratch, 0);
+        out[offset] = readLong(scratch, 0);
+        out[offset + 1] = readLong(scratch, 8);
+    }
+
+    private static long readLong(byte[] bytes, int offset) {
+        long value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value = (value << 8) | (bytes[offset + i] & 0xFFL);
+        }
+        return value;
+    }
+
+    /**
+     * Computes XXHash64 of many slices of one array in a single native call.
+     * @param input the array holding every slice
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives the hash of each slice, in the same order; must hold at least offsets.length longs
+     */
+    static public void computeXXHash64Batch(byte[] input, int[] offsets, int[] lengths, long seed, long[] out) {
+        computeBatch(TYPE_XXHASH64, input, offsets, lengths, seed, out);
+    }
+
+    /**
+     * Computes XXHash64 of many slices of one buffer in a single native call. Direct buffers are read in place.
+     * @param input the buffer holding every slice; offsets are absolute indices, like ByteBuffer.get(int)
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives the hash of each slice, in the same order; must hold at least offsets.length longs
+     */
+    static public void computeXXHash64Batch(ByteBuffer input, int[] offsets, int[] lengths, long seed, long[] out) {
+        computeBatch(TYPE_XXHASH64, input, offsets, lengths, seed, out);
+    }
+
+    /**
+     * Computes XXHash3_64 of many slices of one array in a single native call.
+     * @param input the array holding every slice
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives the hash of each slice, in the same order; must hold at least offsets.length longs
+     */
+    static public void computeXXHash3_64Batch(byte[] input, int[] offsets, int[] lengths, long seed, long[] out) {
+        computeBatch(TYPE_XXHASH3_64, input, offsets, lengths, seed, out);
+    }
+
+    /**
+     * Computes XXHash3_64 of many slices of one buffer in a single native call. Direct buffers are read in place.
+     * @param input the buffer holding every slice; offsets are absolute indices, like ByteBuffer.get(int)
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives the hash of each slice, in the same order; must hold at least offsets.length longs
+     */
+    static public void computeXXHash3_64Batch(ByteBuffer input, int[] offsets, int[] lengths, long seed, long[] out) {
+        computeBatch(TYPE_XXHASH3_64, input, offsets, lengths, seed, out);
+    }
+
+    /**
+     * Computes XXHash3_128 of many slices of one array in a single native call.
+     * @param input the array holding every slice
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives two longs per slice, the high 64 bits then the low 64 bits; must hold at least
+     *            2 * offsets.length longs
+     */
+    static public void computeXXHash3_128Batch(byte[] input, int[] offsets, int[] lengths, long seed, long[] out) {
+        computeBatch(TYPE_XXHASH3_128, input, offsets, lengths, seed, out);
+    }
+
+    /**
+     * Computes XXHash3_128 of many slices of one buffer in a single native call. Direct buffers are read in place.
+     * @param input the buffer holding every slice; offsets are absolute indices, like ByteBuffer.get(int)
+     * @param offsets offset of each slice in input
+     * @param lengths length of each slice
+     * @param seed seed
+     * @param out receives two longs per slice, the high 64 bits then the low 64 bits; must hold at least
+     *            2 * offsets.length longs
+     */
+    static public void computeXXHash3_128Batch(ByteBuffer input, int[] offsets, int[] lengths, long seed,
+            long[] out) {
+        computeBatch(TYPE_XXHASH3_128, input, offsets, lengths, seed, out);
+    }
+
+    private static void computeBatch(int type, byte[] input, int[] offsets, int[] lengths, long seed, long[] out) {
+        validateBatch(type, input.length, offsets, lengths, out);
+        xxHashComputeBatch(type, input, null, offsets, lengths, seed, out);
+    }
+
+    private static void computeBatch(int type, ByteBuffer input, int[] offsets, int[] lengths, long seed,
+            long[] out) {
+        validateBatch(type, input.limit(), offsets, lengths, out);
+        if (input.isDirect()) {
+            xxHashComputeBatch(type, null, input, offsets, lengths, seed, out);
+        } else if (input.hasArray()) {
+            int[] arrayOffsets = new int[offsets.length];
+            for (int i = 0; i < offsets.length; ++i) {
+                arrayOffsets[i] = input.arrayOffset() + offsets[i];
+            }
+            xxHashComputeBatch(type, input.array(), null, arrayOffsets, lengths, seed, out);
+        } else {
+            byte[] copy = new byte[input.limit()];
+            ByteBuffer source = input.duplicate();
+            source.position(0);
+            source.get(copy);
+            xxHashComputeBatch(type, copy, null, offsets, lengths, seed, out);
+        }
+    }
+
+    private static void validateBatch(int type, int inputSize, int[] offsets, int[] lengths, long[] out) {
+        if (offsets.length != lengths.length) {
+            throw new IllegalArgumentException("offsets and lengths must be the same length");
+        }
+        int digestLongs = type == TYPE_XXHASH3_128 ? 2 : 1;
+        if (out.length / digestLongs < offsets.length) {
+            throw new IllegalArgumentException("out is too small to hold every hash");
+        }
+        for (int i = 0; i < offsets.length; ++i) {
+            if (offsets[i] < 0 || lengths[i] < 0 || offsets[i] > inputSize - lengths[i]) {
+                throw new IndexOutOfBoundsException("slice " + i + " is out of bounds");
+            }
+        }
+    }
+
     /**
      * Oneshot compute XXHash64.
      * @param input input input to hash
@@ -212,7 +436,12 @@ public class XXHash extends CrtResource {
     private static native long xxHash364Create(long seed);
     private static native long xxHash3128Create(long seed);
     private static native void xxHashRelease(long xxhash);
+    private static native void xxHashReset(long xxhash, long seed);
 
     private static native void xxHashUpdate(long xxhash, byte[] input, int offset, int length);
     private static native byte[] xxHashFinalize(long xxhash);
+    private static native int xxHashFinalizeInto(long xxhash, byte[] out, int offset);
+
+    private static native void xxHashComputeBatch(int type, byte[] inputArray, ByteBuffer inputBuffer, int[] offsets,
+            int[] lengths, long seed, long[] out);
 }
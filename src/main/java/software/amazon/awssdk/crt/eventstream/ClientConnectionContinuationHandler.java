@@ -41,6 +41,43 @@ public abstract class ClientConnectionContinuationHandler implements AutoCloseab
         onContinuationMessage(headers, payload, MessageType.fromEnumValue(messageType), messageFlags);
     }
 
+    /**
+     * Override to return true to receive messages through onContinuationMessage(MessageView) instead of
+     * onContinuationMessage(List, byte[], ...), which skips copying every header and the payload into Java arrays
+     * per message. Queried once, when the continuation is set up.
+     * @return true to receive messages as a MessageView
+     */
+    protected boolean isMessageViewEnabled() {
+        return false;
+    }
+
+    /**
+     * Invoked when a message is received on a continuation whose handler returns true from isMessageViewEnabled().
+     * The view is only valid until this returns. By default decodes the whole message and forwards it to
+     * onContinuationMessage(List, byte[], ...).
+     * @param message view over the message received
+     */
+    protected void onContinuationMessage(final MessageView message) {
+        ByteBuffer payloadBuffer = message.getPayload();
+        byte[] payload = new byte[payloadBuffer.remaining()];
+        payloadBuffer.get(payload);
+
+        onContinuationMessage(message.getHeaders(), payload, message.getMessageType(), message.getMessageFlags());
+    }
+
+    /**
+     * Invoked from JNI. Wraps the native message for the duration of onContinuationMessage(MessageView).
+     */
+    private void onContinuationMessageViewShim(long messageArgs, int headerCount, int messageType, int messageFlags) {
+        MessageView message = new MessageView(messageArgs, headerCount, MessageType.fromEnumValue(messageType),
+                messageFlags);
+        try {
+            onContinuationMessage(message);
+        } finally {
+            message.invalidate();
+        }
+    }
+
     /**
      * By default closes the underlying resource. If you override this function, be sure to
      * either call close() manually or invoke super.onContinuationClosed() before returning.
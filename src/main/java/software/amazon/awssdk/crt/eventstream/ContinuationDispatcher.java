@@ -0,0 +1,223 @@
+package software.amazon.awssdk.crt.eventstream;
+
+import software.amazon.awssdk.crt.Log;
+
+import java.util.Queue;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Runs server continuation callbacks on a work-stealing pool instead of the event-loop thread that owns the
+ * connection, so a slow handler only holds up its own continuation. Pass one to
+ * {@link ServerConnectionHandler#ServerConnectionHandler(ServerConnection, ContinuationDispatcher)} or
+ * {@link OperationRoutingServerConnectionHandler}; it can be shared by every connection of a ServerListener.
+ * <p>
+ * Messages of one continuation are delivered one at a time and in order, followed by onContinuationClosed().
+ * Different continuations run in parallel. Handlers that opt in to MessageView are still called on the event loop,
+ * since a view can't outlive the native callback.
+ * </p>
+ * <p>
+ * Dispatching never blocks the event loop, which is shared by many connections: messages are always queued. Once
+ * highWaterMark messages are queued or running, {@link QueueListener#onHighWater} is called, and once the backlog
+ * has drained to half of that, {@link QueueListener#onLowWater}. An application reacts to those, for example by
+ * rejecting new continuations or closing its busiest connections, since aws-c-event-stream's RPC server doesn't let
+ * the bindings stop reading from a connection.
+ * </p>
+ */
+public class ContinuationDispatcher implements AutoCloseable {
+    /* messages run per turn on the pool before a busy continuation yields its thread to the others */
+    private static final int MAX_MESSAGES_PER_TURN = 16;
+
+    /**
+     * Notified as the dispatcher's backlog crosses its high-water mark. The two calls alternate, starting with
+     * onHighWater. They must not block: onHighWater runs on the event-loop thread that queued the message.
+     */
+    public interface QueueListener {
+        /**
+         * Called once the backlog reaches the high-water mark
+         * @param queuedMessages messages queued or running at the time
+         */
+        void onHighWater(int queuedMessages);
+
+        /**
+         * Called once the backlog, after reaching the high-water mark, has drained to half of it
+         * @param queuedMessages messages queued or running at the time
+         */
+        void onLowWater(int queuedMessages);
+    }
+
+    private final ForkJoinPool pool;
+    private final int highWaterMark;
+    private final int lowWaterMark;
+    private final QueueListener queueListener;
+    private final AtomicInteger queuedMessages = new AtomicInteger(0);
+    private final AtomicBoolean aboveHighWater = new AtomicBoolean(false);
+
+    /**
+     * Creates a dispatcher with its own pool and no queue listener
+     * @param parallelism number of pool threads
+     * @param highWaterMark messages queued or running across every continuation at which the backlog is reported
+     */
+    public ContinuationDispatcher(int parallelism, int highWaterMark) {
+        this(parallelism, highWaterMark, null);
+    }
+
+    /**
+     * Creates a dispatcher with its own pool
+     * @param parallelism number of pool threads
+     * @param highWaterMark messages queued or running across every continuation at which the backlog is reported
+     * @param queueListener notified as the backlog crosses highWaterMark, may be null
+     */
+    public ContinuationDispatcher(int parallelism, int highWaterMark, QueueListener queueListener) {
+        if (parallelism <= 0) {
+            throw new IllegalArgumentException("ContinuationDispatcher parallelism must be greater than 0");
+        }
+        if (highWaterMark <= 0) {
+            throw new IllegalArgumentException("ContinuationDispatcher highWaterMark must be greater than 0");
+        }
+
+        /* async mode: tasks are independent events, FIFO scheduling suits them better than LIFO */
+        this.pool = new ForkJoinPool(parallelism, ForkJoinPool.defaultForkJoinWorkerThreadFactory, null, true);
+        this.highWaterMark = highWaterMark;
+        this.lowWaterMark = highWaterMark / 2;
+        this.queueListener = queueListener;
+    }
+
+    /**
+     * @return messages currently queued or running
+     */
+    public int getQueuedMessageCount() {
+        return queuedMessages.get();
+    }
+
+    /**
+     * @return true between an onHighWater and the following onLowWater
+     */
+    public boolean isAboveHighWater() {
+        return aboveHighWater.get();
+    }
+
+    private void onMessageQueued() {
+        int queued = queuedMessages.incrementAndGet();
+        if (queued >= highWaterMark && aboveHighWater.compareAndSet(false, true)) {
+            notifyListener(true, queued);
+        }
+    }
+
+    private void onMessageDone() {
+        int queued = queuedMessages.decrementAndGet();
+        if (queued <= lowWaterMark && aboveHighWater.compareAndSet(true, false)) {
+            notifyListener(false, queued);
+        }
+    }
+
+    private void notifyListener(boolean highWater, int queued) {
+        if (queueListener == null) {
+            return;
+        }
+
+        try {
+            if (highWater) {
+                queueListener.onHighWater(queued);
+            } else {
+                queueListener.onLowWater(queued);
+            }
+        } catch (RuntimeException ex) {
+            Log.log(Log.LogLevel.Error, Log.LogSubject.EventStreamServerListener,
+                    "ContinuationDispatcher: queue listener threw: " + ex);
+        }
+    }
+
+    /**
+     * Stops accepting work, lets queued callbacks finish and waits for them
+     * @param timeout maximum time to wait
+     * @param unit unit of timeout
+     * @return true if everything finished within the timeout
+     * @throws InterruptedException if interrupted while waiting
+     */
+    public boolean shutdown(long timeout, TimeUnit unit) throws InterruptedException {
+        pool.shutdown();
+        return pool.awaitTermination(timeout, unit);
+    }
+
+    /**
+     * Stops accepting work. Callbacks dispatched afterwards run on the event-loop thread.
+     */
+    @Override
+    public void close() {
+        pool.shutdown();
+    }
+
+    SerialQueue newQueue() {
+        return new SerialQueue();
+    }
+
+    /**
+     * Runs the tasks of one continuation in order, never more than one at a time
+     */
+    final class SerialQueue implements Runnable {
+        private final Queue<Runnable> tasks = new ConcurrentLinkedQueue<>();
+        private final AtomicBoolean scheduled = new AtomicBoolean(false);
+
+        /**
+         * Queues a message callback, counted toward the high-water mark. Never blocks.
+         */
+        void dispatchMessage(Runnable task) {
+            onMessageQueued();
+            dispatch(() -> {
+                try {
+                    task.run();
+                } finally {
+                    onMessageDone();
+                }
+            });
+        }
+
+        /**
+         * Queues a callback that isn't counted, for the closed notification
+         */
+        void dispatch(Runnable task) {
+            tasks.add(task);
+            schedule();
+        }
+
+        private void schedule() {
+            if (!scheduled.compareAndSet(false, true)) {
+                return;
+            }
+
+            try {
+                pool.execute(this);
+            } catch (RejectedExecutionException ex) {
+                /* closed dispatcher, keep the callbacks flowing on the caller's thread */
+                run();
+            }
+        }
+
+        @Override
+        public void run() {
+            for (int i = 0; i < MAX_MESSAGES_PER_TURN; ++i) {
+                Runnable task = tasks.poll();
+                if (task == null) {
+                    break;
+                }
+
+                try {
+                    task.run();
+                } catch (RuntimeException ex) {
+                    Log.log(Log.LogLevel.Error, Log.LogSubject.EventStreamServerListener,
+                            "ContinuationDispatcher: continuation callback threw: " + ex);
+                }
+            }
+
+            scheduled.set(false);
+            if (!tasks.isEmpty()) {
+                schedule();
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+package software.amazon.awssdk.crt.eventstream;
+
+import software.amazon.awssdk.crt.CrtResource;
+
+import java.util.List;
+
+/**
+ * A list of event-stream headers, marshalled and parsed into native form once so it can be sent with any
+ * number of messages without being re-encoded. It's auto closable, so be sure to call close when finished with
+ * the object.
+ * <p>
+ * Used with {@link ClientConnectionContinuation#sendMessageDirect} and
+ * {@link ServerConnectionContinuation#sendMessageDirect}. It is read, not modified, by a send, so it may be shared
+ * between threads, but must not be closed while a send using it is in progress.
+ * </p>
+ */
+public class MessageHeaders extends CrtResource {
+    /**
+     * Creates a native header list
+     * @param headers headers to marshall, may be empty.
+     */
+    public MessageHeaders(List<Header> headers) {
+        acquireNativeHandle(messageHeadersNew(Header.marshallHeadersForJNI(headers)));
+    }
+
+    @Override
+    protected void releaseNativeHandle() {
+        if (!isNull()) {
+            messageHeadersDestroy(getNativeHandle());
+        }
+    }
+
+    @Override
+    protected boolean canReleaseReferencesImmediately() {
+        return true;
+    }
+
+    private static native long messageHeadersNew(byte[] serializedHeaders);
+    private static native void messageHeadersDestroy(long headersHandle);
+}
@@ -0,0 +1,124 @@
+package software.amazon.awssdk.crt.eventstream;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Read-only view of an incoming continuation message, handed to handlers that opt in with
+ * isMessageViewEnabled(). Nothing is copied up front: headers are decoded one at a time when asked for and the
+ * payload is a read-only buffer over the native message.
+ * <p>
+ * A view is only valid during the onContinuationMessage() call it was passed to. Afterwards every accessor throws
+ * IllegalStateException, and a payload buffer obtained from it must no longer be read, since the memory behind it
+ * has been reused. Copy out anything that needs to outlive the callback.
+ * </p>
+ */
+public final class MessageView {
+    private long messageArgs;
+    private final int headerCount;
+    private final MessageType messageType;
+    private final int messageFlags;
+    private ByteBuffer payload;
+
+    /**
+     * Package private, created by the continuation handlers around a native message.
+     */
+    MessageView(long messageArgs, int headerCount, MessageType messageType, int messageFlags) {
+        this.messageArgs = messageArgs;
+        this.headerCount = headerCount;
+        this.messageType = messageType;
+        this.messageFlags = messageFlags;
+    }
+
+    /**
+     * @return message type of the message
+     */
+    public MessageType getMessageType() {
+        return messageType;
+    }
+
+    /**
+     * @return message flags of the message
+     */
+    public int getMessageFlags() {
+        return messageFlags;
+    }
+
+    /**
+     * @return number of headers on the message
+     */
+    public int getHeaderCount() {
+        return headerCount;
+    }
+
+    /**
+     * Decodes a single header
+     * @param index position of the header on the message, from 0 to getHeaderCount() - 1
+     * @return the header at index
+     */
+    public Header getHeader(int index) {
+        checkValid();
+        if (index < 0 || index >= headerCount) {
+            throw new IndexOutOfBoundsException("header index " + index + " out of range, count " + headerCount);
+        }
+
+        return Header.fromByteBuffer(ByteBuffer.wrap(messageViewGetHeader(messageArgs, index)));
+    }
+
+    /**
+     * Finds and decodes the first header with a given name
+     * @param name header name, compared case sensitively
+     * @return the header, or null if the message has none by that name
+     */
+    public Header getHeader(String name) {
+        checkValid();
+        byte[] header = messageViewFindHeader(messageArgs, name.getBytes(StandardCharsets.UTF_8));
+        return header != null ? Header.fromByteBuffer(ByteBuffer.wrap(header)) : null;
+    }
+
+    /**
+     * Decodes every header, for handlers that need them all
+     * @return list of the message's headers
+     */
+    public List<Header> getHeaders() {
+        List<Header> headers = new ArrayList<>(headerCount);
+        for (int i = 0; i < headerCount; ++i) {
+            headers.add(getHeader(i));
+        }
+        return headers;
+    }
+
+    /**
+     * @return read-only buffer over the message's payload, only readable until the callback returns
+     */
+    public ByteBuffer getPayload() {
+        checkValid();
+        if (payload == null) {
+            ByteBuffer nativePayload = messageViewGetPayload(messageArgs);
+            payload = nativePayload != null ? nativePayload.asReadOnlyBuffer()
+                    : ByteBuffer.allocate(0).asReadOnlyBuffer();
+        }
+
+        return payload.duplicate();
+    }
+
+    /**
+     * Called once the callback the view was passed to has returned
+     */
+    void invalidate() {
+        messageArgs = 0;
+        payload = null;
+    }
+
+    private void checkValid() {
+        if (messageArgs == 0) {
+            throw new IllegalStateException("MessageView used after its onContinuationMessage() callback returned");
+        }
+    }
+
+    private static native byte[] messageViewGetHeader(long messageArgs, int index);
+    private static native byte[] messageViewFindHeader(long messageArgs, byte[] name);
+    private static native ByteBuffer messageViewGetPayload(long messageArgs);
+}
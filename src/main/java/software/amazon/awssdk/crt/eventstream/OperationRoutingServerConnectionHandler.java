@@ -25,6 +25,20 @@ public class OperationRoutingServerConnectionHandler extends ServerConnectionHan
         this.operationMap = operationMapping;
     }
 
+    /**
+     * binds an operation handler mapping to a server connection, running the operation handlers' callbacks on a
+     * dispatcher's pool rather than the connection's event-loop thread
+     * @param serverConnection connection to route messages for
+     * @param operationMapping mapping of operation names to message handlers.
+     * @param continuationDispatcher dispatcher for the connection's continuations, may be shared between connections
+     */
+    public OperationRoutingServerConnectionHandler(final ServerConnection serverConnection,
+                                                   final Map<String, Function<ServerConnectionContinuation, ServerConnectionContinuationHandler>> operationMapping,
+                                                   final ContinuationDispatcher continuationDispatcher) {
+        super(serverConnection, continuationDispatcher);
+        this.operationMap = operationMapping;
+    }
+
     /**
      * By default, automatically responds to pings when received, and routes connect requests.
      *
@@ -4,6 +4,7 @@ import software.amazon.awssdk.crt.CRT;
 import software.amazon.awssdk.crt.CrtResource;
 import software.amazon.awssdk.crt.CrtRuntimeException;
 
+import java.nio.ByteBuffer;
 import java.util.List;
 import java.util.concurrent.CompletableFuture;
 
@@ -76,6 +77,65 @@ public class ServerConnectionContinuation extends CrtResource {
         }
     }
 
+    /**
+     * Sends message on the continuation without copying the headers or payload on the way down: the headers
+     * were parsed when the MessageHeaders was created and the payload is read in place.
+     * @param headers prebuilt event stream headers to include on the message, may be null but must not be closed.
+     * @param payload payload for the message, its remaining bytes are sent. Must be a direct ByteBuffer, may be null.
+     *                Its position is left unchanged.
+     * @param messageType message type. Must be either ApplicationMessage or ApplicationError
+     * @param messageFlags message flags for the message, use TerminateStream to cause this message
+     *                     to close the continuation after sending.
+     * @return Future for syncing when the message is flushed to the transport or fails.
+     */
+    public CompletableFuture<Void> sendMessageDirect(final MessageHeaders headers, final ByteBuffer payload,
+                                               final MessageType messageType, int messageFlags) {
+        CompletableFuture<Void> messageFlush = new CompletableFuture<>();
+
+        sendMessageDirect(headers, payload, messageType, messageFlags, errorCode -> {
+            if (errorCode == 0) {
+                messageFlush.complete(null);
+            } else {
+                messageFlush.completeExceptionally(new CrtRuntimeException(errorCode));
+            }
+        });
+
+        return messageFlush;
+    }
+
+    /**
+     * Sends message on the continuation without copying the headers or payload on the way down.
+     * @param headers prebuilt event stream headers to include on the message, may be null but must not be closed.
+     * @param payload payload for the message, its remaining bytes are sent. Must be a direct ByteBuffer, may be null.
+     * @param messageType message type. Must be either ApplicationMessage or ApplicationError
+     * @param messageFlags message flags for the message, use TerminateStream to cause this message
+     *                     to close the continuation after sending.
+     * @param callback completion callback to be invoked when the message is synced to the underlying
+     *                 transport.
+     */
+    public void sendMessageDirect(final MessageHeaders headers, final ByteBuffer payload,
+                            final MessageType messageType, int messageFlags, MessageFlushCallback callback) {
+        if (isNull()) {
+            throw new IllegalStateException("close() has already been called on this object.");
+        }
+        if (headers != null && headers.isNull()) {
+            throw new IllegalStateException("close() has already been called on the MessageHeaders.");
+        }
+        if (payload != null && !payload.isDirect()) {
+            throw new IllegalArgumentException("payload must be a direct ByteBuffer");
+        }
+
+        int result = sendContinuationMessageDirect(getNativeHandle(),
+                headers != null ? headers.getNativeHandle() : 0,
+                payload, payload != null ? payload.position() : 0, payload != null ? payload.remaining() : 0,
+                messageType.getEnumValue(), messageFlags, callback);
+
+        if (result != 0) {
+            int errorCode = CRT.awsLastError();
+            throw new CrtRuntimeException(errorCode);
+        }
+    }
+
     @Override
     protected void releaseNativeHandle() {
         if (!isNull()) {
@@ -92,4 +152,5 @@ public class ServerConnectionContinuation extends CrtResource {
     private static native void release(long continuationPtr);
     private static native boolean isClosed(long continuationPtr);
     private static native int sendContinuationMessage(long continuation, byte[] serialized_headers, byte[] payload, int message_type, int message_flags, MessageFlushCallback callback);
+    private static native int sendContinuationMessageDirect(long continuation, long headersPtr, ByteBuffer payload, int payloadOffset, int payloadLength, int message_type, int message_flags, MessageFlushCallback callback);
 }
@@ -12,6 +12,8 @@ import java.util.concurrent.CompletableFuture;
 public abstract class ServerConnectionContinuationHandler implements AutoCloseable {
     protected ServerConnectionContinuation continuation;
     private CompletableFuture<Void> completableFuture = new CompletableFuture<>();
+    // set by the ServerConnectionHandler, before any message arrives, when it has a ContinuationDispatcher
+    ContinuationDispatcher.SerialQueue dispatchQueue;
 
     /**
      * Constructor invoked by your subclass.
@@ -50,10 +52,59 @@ public abstract class ServerConnectionContinuationHandler implements AutoCloseab
             headers.add(header);
         }
 
+        if (dispatchQueue != null) {
+            dispatchQueue.dispatchMessage(() -> onContinuationMessage(headers, payload,
+                    MessageType.fromEnumValue(messageType), messageFlags));
+            return;
+        }
+
         onContinuationMessage(headers, payload, MessageType.fromEnumValue(messageType), messageFlags);
     }
 
+    /**
+     * Override to return true to receive messages through onContinuationMessage(MessageView) instead of
+     * onContinuationMessage(List, byte[], ...), which skips copying every header and the payload into Java arrays
+     * per message. Queried once, when the continuation is set up.
+     * @return true to receive messages as a MessageView
+     */
+    protected boolean isMessageViewEnabled() {
+        return false;
+    }
+
+    /**
+     * Invoked when a message is received on a continuation whose handler returns true from isMessageViewEnabled().
+     * The view is only valid until this returns. By default decodes the whole message and forwards it to
+     * onContinuationMessage(List, byte[], ...).
+     * @param message view over the message received
+     */
+    protected void onContinuationMessage(final MessageView message) {
+        ByteBuffer payloadBuffer = message.getPayload();
+        byte[] payload = new byte[payloadBuffer.remaining()];
+        payloadBuffer.get(payload);
+
+        onContinuationMessage(message.getHeaders(), payload, message.getMessageType(), message.getMessageFlags());
+    }
+
+    void onContinuationMessageViewShim(long messageArgs, int headerCount, int messageType, int messageFlags) {
+        MessageView message = new MessageView(messageArgs, headerCount, MessageType.fromEnumValue(messageType),
+                messageFlags);
+        try {
+            onContinuationMessage(message);
+        } finally {
+            message.invalidate();
+        }
+    }
+
     void onContinuationClosedShim() {
+        if (dispatchQueue != null) {
+            // after any messages still queued for this continuation
+            dispatchQueue.dispatch(() -> {
+                onContinuationClosed();
+                completableFuture.complete(null);
+            });
+            return;
+        }
+
         onContinuationClosed();
         completableFuture.complete(null);
     }
@@ -11,9 +11,22 @@ import java.util.List;
  */
 public abstract class ServerConnectionHandler implements AutoCloseable {
     protected ServerConnection connection;
+    private final ContinuationDispatcher continuationDispatcher;
 
     protected ServerConnectionHandler(final ServerConnection connection) {
+        this(connection, null);
+    }
+
+    /**
+     * Creates a handler whose continuations' callbacks run on a dispatcher's pool rather than the connection's
+     * event-loop thread.
+     * @param connection connection to handle
+     * @param continuationDispatcher dispatcher for the connection's continuations, null to call them on the event loop
+     */
+    protected ServerConnectionHandler(final ServerConnection connection,
+                                      final ContinuationDispatcher continuationDispatcher) {
         this.connection = connection;
+        this.continuationDispatcher = continuationDispatcher;
         // it wasn't really doable to have JNI invoke the function from the ServerConnectionHandler, The ServerListener
         // completes this future, when it's completed, as a convenience go ahead and invoke our own callback which
         // by default cleans up the resources.
@@ -60,7 +73,13 @@ public abstract class ServerConnectionHandler implements AutoCloseable {
     private ServerConnectionContinuationHandler onIncomingStream(final ServerConnectionContinuation continuation, byte[] operationName) {
         String operationNameStr = new String(operationName, StandardCharsets.UTF_8);
 
-        return onIncomingStream(continuation, operationNameStr);
+        ServerConnectionContinuationHandler continuationHandler = onIncomingStream(continuation, operationNameStr);
+        if (continuationDispatcher != null && continuationHandler != null
+                && !continuationHandler.isMessageViewEnabled()) {
+            continuationHandler.dispatchQueue = continuationDispatcher.newQueue();
+        }
+
+        return continuationHandler;
     }
 
     /**
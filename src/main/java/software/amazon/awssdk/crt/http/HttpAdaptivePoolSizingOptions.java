@@ -0,0 +1,87 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.http;
+
+/**
+ * This class configures adaptive sizing of a connection pool, in place of a static connection count.
+ *
+ * The connection manager keeps a limit on leased connections, between a minimum and the manager's max connections,
+ * and holds acquisitions back once it is reached. The limit grows while the average time to acquire a connection,
+ * including time held back, is above the target and acquisitions are waiting. It shrinks while that time is below the
+ * target and nothing is waiting. The hysteresis is a band around the target, as a percentage of it, within which the
+ * limit is left alone. Connections above the limit go idle, so pair this with
+ * {@link HttpClientConnectionManagerOptions#withMaxConnectionIdleInMilliseconds} to have them closed.
+ */
+public class HttpAdaptivePoolSizingOptions {
+
+    /**
+     * Minimum number of connections the pool is allowed to lease at once.
+     */
+    private int minConnections = 1;
+
+    /**
+     * Connection acquisition time, in milliseconds, the pool is sized for.
+     */
+    private long targetAcquisitionLatencyInMilliseconds;
+
+    /**
+     * Band around the target, as a percentage of it, within which the pool keeps its size.
+     */
+    private int hysteresisPercent = 20;
+
+    /**
+     * Creates a new set of adaptive sizing options
+     */
+    public HttpAdaptivePoolSizingOptions() {
+    }
+
+    /**
+     * Sets the minimum number of connections the pool is allowed to lease at once, and the number it starts with.
+     * @param minConnections minimum number of connections, at least one and at most the manager's max connections
+     */
+    public void setMinConnections(int minConnections) {
+        if (minConnections < 1) {
+            throw new IllegalArgumentException("Adaptive pool minimum connections must be at least one");
+        }
+        this.minConnections = minConnections;
+    }
+
+    /**
+     * @return minimum number of connections the pool is allowed to lease at once
+     */
+    public int getMinConnections() { return minConnections; }
+
+    /**
+     * Sets the connection acquisition time the pool is sized for.
+     * @param targetAcquisitionLatencyInMilliseconds target acquisition time, in milliseconds, must be positive
+     */
+    public void setTargetAcquisitionLatencyInMilliseconds(long targetAcquisitionLatencyInMilliseconds) {
+        if (targetAcquisitionLatencyInMilliseconds <= 0) {
+            throw new IllegalArgumentException("Adaptive pool target acquisition latency must be positive");
+        }
+        this.targetAcquisitionLatencyInMilliseconds = targetAcquisitionLatencyInMilliseconds;
+    }
+
+    /**
+     * @return connection acquisition time, in milliseconds, the pool is sized for
+     */
+    public long getTargetAcquisitionLatencyInMilliseconds() { return targetAcquisitionLatencyInMilliseconds; }
+
+    /**
+     * Sets the band around the target within which the pool keeps its size. Defaults to 20 percent.
+     * @param hysteresisPercent band around the target, as a percentage of it
+     */
+    public void setHysteresisPercent(int hysteresisPercent) {
+        if (hysteresisPercent < 0) {
+            throw new IllegalArgumentException("Adaptive pool hysteresis must be non-negative");
+        }
+        this.hysteresisPercent = hysteresisPercent;
+    }
+
+    /**
+     * @return band around the target, as a percentage of it, within which the pool keeps its size
+     */
+    public int getHysteresisPercent() { return hysteresisPercent; }
+}
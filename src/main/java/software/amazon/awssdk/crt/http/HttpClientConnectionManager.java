@@ -7,6 +7,7 @@ package software.amazon.awssdk.crt.http;
 import java.net.URI;
 import java.nio.charset.Charset;
 import java.util.concurrent.CompletableFuture;
+import software.amazon.awssdk.crt.AsyncCallback;
 import software.amazon.awssdk.crt.CrtResource;
 import software.amazon.awssdk.crt.CrtRuntimeException;
 import software.amazon.awssdk.crt.io.ClientBootstrap;
@@ -30,6 +31,8 @@ public class HttpClientConnectionManager extends CrtResource {
     private final int maxConnections;
     private final CompletableFuture<Void> shutdownComplete = new CompletableFuture<>();
     private final HttpVersion expectedHttpVersion;
+    private final int maxPipelinedRequestsPerConnection;
+    private final CompletableFuture<Void> prewarmFuture;
 
     /**
      * Factory function for HttpClientConnectionManager instances
@@ -88,6 +91,7 @@ public class HttpClientConnectionManager extends CrtResource {
         this.port = port;
         this.maxConnections = maxConnections;
         this.expectedHttpVersion = options.getExpectedHttpVersion();
+        this.maxPipelinedRequestsPerConnection = options.getMaxPipelinedRequestsPerConnection();
 
         int proxyConnectionType = 0;
         String proxyHost = null;
@@ -119,6 +123,16 @@ public class HttpClientConnectionManager extends CrtResource {
             environmentVariableType = environmentVariableSetting.getEnvironmentVariableType().getValue();
         }
 
+        HttpAdaptivePoolSizingOptions adaptiveOptions = options.getAdaptivePoolSizingOptions();
+        int adaptiveMinConnections = 0;
+        long adaptiveTargetLatencyMs = 0;
+        int adaptiveHysteresisPercent = 0;
+        if (adaptiveOptions != null) {
+            adaptiveMinConnections = adaptiveOptions.getMinConnections();
+            adaptiveTargetLatencyMs = adaptiveOptions.getTargetAcquisitionLatencyInMilliseconds();
+            adaptiveHysteresisPercent = adaptiveOptions.getHysteresisPercent();
+        }
+
         HttpMonitoringOptions monitoringOptions = options.getMonitoringOptions();
         long monitoringThroughputThresholdInBytesPerSecond = 0;
         int monitoringFailureIntervalInSeconds = 0;
@@ -156,7 +170,11 @@ public class HttpClientConnectionManager extends CrtResource {
                                             expectedHttpVersion.getValue(),
                                             options.getMaxPendingConnectionAcquisitions(),
                                             options.getConnectionAcquisitionTimeoutInMilliseconds(),
-                                            options.getResponseFirstByteTimeoutInMilliseconds()));
+                                            options.getResponseFirstByteTimeoutInMilliseconds(),
+                                            maxPipelinedRequestsPerConnection,
+                                            adaptiveMinConnections,
+                                            adaptiveTargetLatencyMs,
+                                            adaptiveHysteresisPercent));
 
         /* we don't need to add a reference to socketOptions since it's copied during connection manager construction */
          addReferenceTo(clientBootstrap);
@@ -168,6 +186,54 @@ public class HttpClientConnectionManager extends CrtResource {
                 addReferenceTo(tlsConnectionOptions);
             }
          }
+
+        int prewarmConnections = options.getPrewarmConnections();
+        this.prewarmFuture = prewarmConnections > 0 ? prewarm(prewarmConnections)
+                : CompletableFuture.completedFuture(null);
+    }
+
+    /**
+     * Establishes connections ahead of time, so the first requests don't pay for DNS, TCP and TLS setup. The
+     * connections are set up in parallel with the pool's bootstrap and TLS settings, then left idle in the pool.
+     * Connections already idle in the pool count toward the n.
+     * <p>
+     * Prewarming holds every connection it sets up until all are up, so it only takes the room left in the pool:
+     * n is capped at {@link #getMaxConnections()} minus the connections currently leased or waited for. It never
+     * waits on a connection someone else holds, and a caller that holds a lease can prewarm without deadlocking.
+     * </p>
+     * @param n number of connections to have ready, at most the room left in the pool is set up
+     * @return A future that completes when all the connections are ready, or exceptionally with the first error if
+     *         any of them failed. The connections that did come up stay in the pool either way.
+     */
+    public CompletableFuture<Void> prewarm(int n) {
+        CompletableFuture<Void> future = new CompletableFuture<>();
+        if (isNull()) {
+            future.completeExceptionally(new IllegalStateException(
+                    "HttpClientConnectionManager has been closed, can't prewarm connections"));
+            return future;
+        }
+        try {
+            /* Every connection is held until all are up, so leave the ones in use, or about to be, alone */
+            HttpManagerMetrics metrics = getManagerMetrics();
+            long room = maxConnections - metrics.getLeasedConcurrency() - metrics.getPendingConcurrencyAcquires();
+            int count = (int) Math.min(n, Math.max(0, room));
+            if (count <= 0) {
+                future.complete(null);
+                return future;
+            }
+            httpClientConnectionManagerPrewarm(getNativeHandle(), count, AsyncCallback.wrapFuture(future, null));
+        } catch (CrtRuntimeException ex) {
+            future.completeExceptionally(ex);
+        }
+        return future;
+    }
+
+    /**
+     * @return the future of the prewarming requested by
+     *         {@link HttpClientConnectionManagerOptions#withPrewarmConnections}, already complete if there was none
+     */
+    public CompletableFuture<Void> getPrewarmFuture() {
+        return prewarmFuture;
     }
 
     /**
@@ -184,6 +250,65 @@ public class HttpClientConnectionManager extends CrtResource {
         return returnedFuture;
     }
 
+    /**
+     * Acquires a connection from the pool, makes a request on it and activates the stream, all natively. The
+     * connection never reaches Java: it goes back to the pool as soon as the stream completes, right after
+     * {@link HttpStreamBaseResponseHandler#onResponseComplete}. This saves the JNI round trips and futures of
+     * acquireConnection(), makeRequest(), activate() and releaseConnection() when a connection is only used for
+     * one request.
+     * <p>
+     * The caller still owns the returned stream and must close it, it needs no activate() call.
+     * </p>
+     * <p>
+     * With {@link HttpClientConnectionManagerOptions#withMaxPipelinedRequestsPerConnection} above 1, an idempotent
+     * request may be pipelined on a connection other streams are using. If one of them fails, the requests behind
+     * it fail too, typically with AWS_ERROR_HTTP_CONNECTION_CLOSED, and being idempotent they can simply be retried.
+     * </p>
+     * @param request The Request to make to the Server.
+     * @param streamHandler The Stream Handler to be called from the Native EventLoop
+     * @return A future for an activated HttpStream, or an Http2Stream on an HTTP/2 connection, that will be
+     *         completed once a connection has been acquired and the request sent.
+     */
+    public CompletableFuture<HttpStreamBase> acquireStream(HttpRequestBase request,
+            HttpStreamBaseResponseHandler streamHandler) {
+        CompletableFuture<HttpStreamBase> completionFuture = new CompletableFuture<>();
+        AsyncCallback acquireStreamCompleted = AsyncCallback.wrapFuture(completionFuture, null);
+        if (isNull()) {
+            completionFuture.completeExceptionally(new IllegalStateException(
+                    "HttpClientConnectionManager has been closed, can't acquire new streams"));
+            return completionFuture;
+        }
+        try {
+            httpClientConnectionManagerAcquireStream(this.getNativeHandle(),
+                    request.marshalForJni(),
+                    request.getBodyStream(),
+                    new HttpStreamResponseHandlerNativeAdapter(streamHandler),
+                    acquireStreamCompleted,
+                    maxPipelinedRequestsPerConnection > 1 && isIdempotent(request));
+        } catch (CrtRuntimeException ex) {
+            completionFuture.completeExceptionally(ex);
+        }
+        return completionFuture;
+    }
+
+    private static boolean isIdempotent(HttpRequestBase request) {
+        String method = request instanceof HttpRequest ? ((HttpRequest) request).getMethod() : null;
+        if (method == null) {
+            return false;
+        }
+        switch (method) {
+            case "GET":
+            case "HEAD":
+            case "PUT":
+            case "DELETE":
+            case "OPTIONS":
+            case "TRACE":
+                return true;
+            default:
+                return false;
+        }
+    }
+
     /**
      * Releases this HttpClientConnection back into the Connection Pool, and allows another Request to acquire this connection.
      * @param conn Connection to release
@@ -291,12 +416,26 @@ public class HttpClientConnectionManager extends CrtResource {
                                                         int expectedProtocol,
                                                         long maxPendingConnectionAcquisitions,
                                                         long connectionAcquisitionTimeoutInMilliseconds,
-                                                        long responseFirstByteTimeoutInMilliseconds) throws CrtRuntimeException;
+                                                        long responseFirstByteTimeoutInMilliseconds,
+                                                        int maxPipelinedRequestsPerConnection,
+                                                        int adaptiveMinConnections,
+                                                        long adaptiveTargetLatencyInMilliseconds,
+                                                        int adaptiveHysteresisPercent) throws CrtRuntimeException;
 
     private static native void httpClientConnectionManagerRelease(long conn_manager) throws CrtRuntimeException;
 
     private static native void httpClientConnectionManagerAcquireConnection(long conn_manager, CompletableFuture<HttpClientConnection> acquireFuture) throws CrtRuntimeException;
 
+    private static native void httpClientConnectionManagerAcquireStream(long conn_manager,
+                                                                        byte[] marshalledRequest,
+                                                                        HttpRequestBodyStream bodyStream,
+                                                                        HttpStreamResponseHandlerNativeAdapter responseHandler,
+                                                                        AsyncCallback completedCallback,
+                                                                        boolean pipeline) throws CrtRuntimeException;
+
+    private static native void httpClientConnectionManagerPrewarm(long conn_manager, int count,
+                                                                  AsyncCallback completedCallback) throws CrtRuntimeException;
+
     private static native HttpManagerMetrics httpConnectionManagerFetchMetrics(long conn_manager) throws CrtRuntimeException;
 
 }
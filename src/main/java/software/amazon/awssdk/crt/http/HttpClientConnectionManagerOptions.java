@@ -36,6 +36,9 @@ public class HttpClientConnectionManagerOptions {
     private long connectionAcquisitionTimeoutInMilliseconds;
     private long maxPendingConnectionAcquisitions;
     private long responseFirstByteTimeoutInMilliseconds;
+    private int maxPipelinedRequestsPerConnection = 1;
+    private HttpAdaptivePoolSizingOptions adaptivePoolSizingOptions;
+    private int prewarmConnections = 0;
 
 	private static final String HTTP = "http";
     private static final String HTTPS = "https";
@@ -371,6 +374,63 @@ public class HttpClientConnectionManagerOptions {
         return this;
     }
 
+    /**
+     * @return the maximum number of requests in flight at once on one connection
+     */
+    public int getMaxPipelinedRequestsPerConnection() {
+        return maxPipelinedRequestsPerConnection;
+    }
+
+    /**
+     * Sets how many requests made through {@link HttpClientConnectionManager#acquireStream} may be in flight at once
+     * on one HTTP/1.1 connection. Above 1, idempotent requests (GET, HEAD, PUT, DELETE, OPTIONS, TRACE) are sent
+     * on a connection that is still waiting for earlier responses rather than waiting for a connection of their own.
+     * Responses come back in order, so a slow response delays those pipelined behind it, and if one request on the
+     * connection fails, those behind it fail with it. Defaults to 1, no pipelining.
+     *
+     * @param maxPipelinedRequestsPerConnection maximum requests in flight per connection, at least 1
+     * @return this
+     */
+    public HttpClientConnectionManagerOptions withMaxPipelinedRequestsPerConnection(
+            int maxPipelinedRequestsPerConnection) {
+        this.maxPipelinedRequestsPerConnection = maxPipelinedRequestsPerConnection;
+        return this;
+    }
+
+    /**
+     * Sets the pool to size itself toward a target connection acquisition time, leasing between the adaptive
+     * options' minimum and {@link #withMaxConnections} connections at once, rather than always up to the maximum.
+     * @param adaptivePoolSizingOptions adaptive sizing options, or null for a static pool
+     * @return this
+     */
+    public HttpClientConnectionManagerOptions withAdaptivePoolSizingOptions(
+            HttpAdaptivePoolSizingOptions adaptivePoolSizingOptions) {
+        this.adaptivePoolSizingOptions = adaptivePoolSizingOptions;
+        return this;
+    }
+
+    /**
+     * @return the adaptive sizing options, or null for a static pool
+     */
+    public HttpAdaptivePoolSizingOptions getAdaptivePoolSizingOptions() { return adaptivePoolSizingOptions; }
+
+    /**
+     * Sets how many connections the manager establishes as soon as it is created, see
+     * {@link HttpClientConnectionManager#prewarm} and {@link HttpClientConnectionManager#getPrewarmFuture}.
+     * Defaults to 0, connections are only made when acquired.
+     * @param prewarmConnections number of connections to establish up front
+     * @return this
+     */
+    public HttpClientConnectionManagerOptions withPrewarmConnections(int prewarmConnections) {
+        this.prewarmConnections = prewarmConnections;
+        return this;
+    }
+
+    /**
+     * @return how many connections the manager establishes as soon as it is created
+     */
+    public int getPrewarmConnections() { return prewarmConnections; }
+
 
     /**
      * Validate the connection manager options are valid to use. Throw exceptions if not.
@@ -396,5 +456,22 @@ public class HttpClientConnectionManagerOptions {
         if (windowSize <= 0) { throw new  IllegalArgumentException("Window Size must be greater than zero."); }
 
         if (maxConnections <= 0) { throw new  IllegalArgumentException("Max Connections must be greater than zero."); }
+
+        if (maxPipelinedRequestsPerConnection <= 0) {
+            throw new IllegalArgumentException("Max Pipelined Requests Per Connection must be greater than zero.");
+        }
+
+        if (prewarmConnections < 0) {
+            throw new IllegalArgumentException("Prewarm Connections must not be negative.");
+        }
+
+        if (adaptivePoolSizingOptions != null) {
+            if (adaptivePoolSizingOptions.getTargetAcquisitionLatencyInMilliseconds() <= 0) {
+                throw new IllegalArgumentException("Adaptive pool target acquisition latency must be set.");
+            }
+            if (adaptivePoolSizingOptions.getMinConnections() > maxConnections) {
+                throw new IllegalArgumentException("Adaptive pool minimum connections must not exceed Max Connections.");
+            }
+        }
     }
 }
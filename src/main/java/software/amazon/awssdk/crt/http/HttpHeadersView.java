@@ -0,0 +1,263 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.http;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * A read-only view over a block of headers, as marshalled by native code (see
+ * {@link HttpHeader#loadHeadersListFromMarshalledHeadersBlob}), that decodes nothing up front.
+ * <p>
+ * Looking a header up by name scans the marshalled bytes and compares them in place, so only the values asked for
+ * are ever turned into Strings. {@link #toArray()} builds the full HttpHeader[] on demand, for code that wants
+ * every header.
+ * </p>
+ * <p>
+ * The view passed to a response handler points at native memory and is only valid until the callback returns,
+ * after which every method throws IllegalStateException. Copy out anything needed later, e.g. with
+ * {@link #toArray()}, during the callback.
+ * </p>
+ */
+public final class HttpHeadersView implements AutoCloseable {
+    private static final int BUFFER_INT_SIZE = 4;
+
+    private volatile ByteBuffer blob;
+    private final int start;
+    private final int end;
+
+    /* Offset of each header's name length field, filled in on first indexed access */
+    private int[] headerOffsets;
+    private int headerCount = -1;
+
+    private HttpHeader[] headers;
+
+    private HttpHeadersView(ByteBuffer blob) {
+        this.blob = blob;
+        this.start = blob.position();
+        this.end = blob.limit();
+    }
+
+    /**
+     * Creates a view over a marshalled headers blob, from its position to its limit. The blob is not copied and
+     * its position is not changed.
+     *
+     * @param headersBlob the marshalled headers
+     * @return a view over the headers
+     */
+    public static HttpHeadersView fromMarshalledHeadersBlob(ByteBuffer headersBlob) {
+        return new HttpHeadersView(headersBlob);
+    }
+
+    /**
+     * @return the number of headers
+     */
+    public int size() {
+        index();
+        return headerCount;
+    }
+
+    /**
+     * @param index index of the header, in the order received
+     * @return the name of the header at index
+     */
+    public String getName(int index) {
+        int offset = headerOffset(index);
+        return decode(offset + BUFFER_INT_SIZE, blob().getInt(offset));
+    }
+
+    /**
+     * @param index index of the header, in the order received
+     * @return the value of the header at index
+     */
+    public String getValue(int index) {
+        int valueOffset = valueLengthOffset(headerOffset(index));
+        return decode(valueOffset + BUFFER_INT_SIZE, blob().getInt(valueOffset));
+    }
+
+    /**
+     * @param name header name, compared case-insensitively
+     * @return true if there is at least one header with this name
+     */
+    public boolean contains(String name) {
+        return find(name, start) >= 0;
+    }
+
+    /**
+     * @param name header name, compared case-insensitively
+     * @return the value of the first header with this name, or null if there isn't one
+     */
+    public String getValue(String name) {
+        int offset = find(name, start);
+        if (offset < 0) {
+            return null;
+        }
+        int valueOffset = valueLengthOffset(offset);
+        return decode(valueOffset + BUFFER_INT_SIZE, blob().getInt(valueOffset));
+    }
+
+    /**
+     * @param name header name, compared case-insensitively
+     * @return the values of every header with this name, in the order received; empty if there are none
+     */
+    public List<String> getValues(String name) {
+        List<String> values = new ArrayList<>(1);
+        for (int offset = find(name, start); offset >= 0; offset = find(name, nextHeaderOffset(offset))) {
+            int valueOffset = valueLengthOffset(offset);
+            values.add(decode(valueOffset + BUFFER_INT_SIZE, blob().getInt(valueOffset)));
+        }
+        return values;
+    }
+
+    /**
+     * Parses the value of the first header with this name as a non-negative decimal number, such as
+     * content-length, without creating a String.
+     *
+     * @param name header name, compared case-insensitively
+     * @param defaultValue returned when there is no such header, or its value isn't a non-negative decimal number
+     * @return the parsed value, or defaultValue
+     */
+    public long getLongValue(String name, long defaultValue) {
+        int offset = find(name, start);
+        if (offset < 0) {
+            return defaultValue;
+        }
+
+        ByteBuffer buffer = blob();
+        int valueOffset = valueLengthOffset(offset);
+        int valueLength = buffer.getInt(valueOffset);
+        if (valueLength == 0 || valueLength > 18) {
+            /* 18 digits always fit in a long */
+            return defaultValue;
+        }
+
+        long value = 0;
+        for (int i = valueOffset + BUFFER_INT_SIZE; i < valueOffset + BUFFER_INT_SIZE + valueLength; ++i) {
+            int digit = buffer.get(i) - '0';
+            if (digit < 0 || digit > 9) {
+                return defaultValue;
+            }
+            value = value * 10 + digit;
+        }
+        return value;
+    }
+
+    /**
+     * Decodes every header. The result is built once and cached, later calls return a copy of the same array.
+     *
+     * @return all of the headers, in the order received
+     */
+    public HttpHeader[] toArray() {
+        if (headers == null) {
+            ByteBuffer duplicate = blob().duplicate();
+            duplicate.position(start);
+            duplicate.limit(end);
+            headers = HttpHeader.loadHeadersFromMarshalledHeadersBlob(duplicate);
+        }
+        return Arrays.copyOf(headers, headers.length);
+    }
+
+    /**
+     * Ends the view. Called by the CRT once the callback the view was passed to returns, since the native memory
+     * behind it is about to be reused.
+     */
+    @Override
+    public void close() {
+        blob = null;
+    }
+
+    private ByteBuffer blob() {
+        ByteBuffer current = blob;
+        if (current == null) {
+            throw new IllegalStateException("HttpHeadersView is no longer valid; copy headers out during the callback");
+        }
+        return current;
+    }
+
+    /* Same framing as HttpHeader.loadHeadersListFromMarshalledHeadersBlob(): a zero name length is skipped alone */
+    private int nextHeaderOffset(int offset) {
+        int nameLength = blob().getInt(offset);
+        if (nameLength <= 0) {
+            return offset + BUFFER_INT_SIZE;
+        }
+        int valueOffset = offset + BUFFER_INT_SIZE + nameLength;
+        return valueOffset + BUFFER_INT_SIZE + blob().getInt(valueOffset);
+    }
+
+    private int valueLengthOffset(int offset) {
+        return offset + BUFFER_INT_SIZE + blob().getInt(offset);
+    }
+
+    /* Offset of the first header at or after from whose name matches, or -1 */
+    private int find(String name, int from) {
+        ByteBuffer buffer = blob();
+        for (int offset = from; offset < end; offset = nextHeaderOffset(offset)) {
+            int nameLength = buffer.getInt(offset);
+            if (nameLength > 0 && nameMatches(buffer, offset + BUFFER_INT_SIZE, nameLength, name)) {
+                return offset;
+            }
+        }
+        return -1;
+    }
+
+    /* Header names are ASCII tokens, so comparing chars against bytes is enough; anything else never matches */
+    private static boolean nameMatches(ByteBuffer buffer, int offset, int length, String name) {
+        if (length != name.length()) {
+            return false;
+        }
+        for (int i = 0; i < length; ++i) {
+            char expected = name.charAt(i);
+            int actual = buffer.get(offset + i) & 0xFF;
+            if (expected >= 0x80 || toLowerAscii(expected) != toLowerAscii(actual)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static int toLowerAscii(int c) {
+        return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    }
+
+    private void index() {
+        if (headerCount >= 0) {
+            return;
+        }
+
+        int[] offsets = new int[16];
+        int count = 0;
+        ByteBuffer buffer = blob();
+        for (int offset = start; offset < end; offset = nextHeaderOffset(offset)) {
+            if (buffer.getInt(offset) > 0) {
+                if (count == offsets.length) {
+                    offsets = Arrays.copyOf(offsets, count * 2);
+                }
+                offsets[count++] = offset;
+            }
+        }
+        headerOffsets = offsets;
+        headerCount = count;
+    }
+
+    private int headerOffset(int index) {
+        index();
+        if (index < 0 || index >= headerCount) {
+            throw new IndexOutOfBoundsException("header " + index + " of " + headerCount);
+        }
+        return headerOffsets[index];
+    }
+
+    private String decode(int offset, int length) {
+        byte[] bytes = new byte[length];
+        ByteBuffer duplicate = blob().duplicate();
+        duplicate.position(offset);
+        duplicate.get(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+}
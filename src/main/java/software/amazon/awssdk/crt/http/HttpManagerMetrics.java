@@ -4,11 +4,22 @@ public class HttpManagerMetrics {
     private final long availableConcurrency;
     private final long pendingConcurrencyAcquires;
     private final long leasedConcurrency;
+    private final long pipelinedStreams;
+    private final long pipelineFailures;
+    private final long adaptiveConnectionLimit;
 
     HttpManagerMetrics(long availableConcurrency, long pendingConcurrencyAcquires, long leasedConcurrency) {
+        this(availableConcurrency, pendingConcurrencyAcquires, leasedConcurrency, 0, 0, 0);
+    }
+
+    HttpManagerMetrics(long availableConcurrency, long pendingConcurrencyAcquires, long leasedConcurrency,
+            long pipelinedStreams, long pipelineFailures, long adaptiveConnectionLimit) {
         this.availableConcurrency = availableConcurrency;
         this.pendingConcurrencyAcquires = pendingConcurrencyAcquires;
         this.leasedConcurrency = leasedConcurrency;
+        this.pipelinedStreams = pipelinedStreams;
+        this.pipelineFailures = pipelineFailures;
+        this.adaptiveConnectionLimit = adaptiveConnectionLimit;
     }
 
     /**
@@ -37,4 +48,30 @@ public class HttpManagerMetrics {
     public long getLeasedConcurrency() {
         return this.leasedConcurrency;
     }
+
+    /**
+     * @return the number of requests currently pipelined behind another one on the same connection. Only the
+     * connection manager pipelines, see
+     * {@link HttpClientConnectionManagerOptions#withMaxPipelinedRequestsPerConnection}.
+     */
+    public long getPipelinedStreams() {
+        return pipelinedStreams;
+    }
+
+    /**
+     * @return the total number of pipelined requests that have failed on a connection shared with other requests,
+     * including those that only failed because a request ahead of them did.
+     */
+    public long getPipelineFailures() {
+        return pipelineFailures;
+    }
+
+    /**
+     * @return the number of connections the connection manager currently lets be leased at once, as adjusted by
+     * adaptive sizing, or 0 if adaptive sizing is off. See
+     * {@link HttpClientConnectionManagerOptions#withAdaptivePoolSizingOptions}.
+     */
+    public long getAdaptiveConnectionLimit() {
+        return adaptiveConnectionLimit;
+    }
 }
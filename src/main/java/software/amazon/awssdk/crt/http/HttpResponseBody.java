@@ -0,0 +1,197 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.http;
+
+import software.amazon.awssdk.crt.CRT;
+
+import java.nio.ByteBuffer;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * A chunk of HTTP response body data delivered as a read-only direct ByteBuffer over native memory.
+ * <p>
+ * Only delivered to handlers that opt in via {@link HttpStreamBaseResponseHandler#useDirectResponseBody()}.
+ * The body passed to {@link HttpStreamBaseResponseHandler#onResponseBody(HttpStreamBase, HttpResponseBody)} points
+ * directly at the connection's read buffer, no copy is made into the Java heap. That view is only valid until the
+ * callback returns. To keep the data longer, call {@link #retain()} during the callback, which copies the data
+ * into a pooled native buffer that stays valid until {@link #release()} is called.
+ * Every retained body must be released exactly once per call to {@link #retain()}, or native memory will leak.
+ * </p>
+ * <p>
+ * Flow control: bytes that are retained are held back from the window increment returned by the callback, up to
+ * that increment, and are added to the stream's window once the retained body is finally released. A handler that
+ * retains data can keep returning the full chunk length, and the connection will stop reading once too much body is
+ * being held. A handler that returns less keeps managing the window itself, and releasing adds back no more than
+ * was held back.
+ * </p>
+ */
+public final class HttpResponseBody implements AutoCloseable {
+    static {
+        new CRT();
+    };
+
+    private volatile ByteBuffer buffer;
+
+    /* Native chunk, only valid while the body callback is running */
+    private volatile long nativeBodyChunk;
+
+    /* The retained copy of a callback body, so that retaining it again adds a reference instead of a copy */
+    private HttpResponseBody retainedBody;
+
+    /*
+     * Window held back from the callback's increment for a retained body, credited back on the last release.
+     * Guarded by this; a body released before the callback returned withholds nothing.
+     */
+    private int withheldWindow;
+    private boolean released;
+
+    /* Native retained buffer, 0 for bodies that only live for the duration of the callback */
+    private final long nativeRetainedBuffer;
+    private final AtomicInteger refCount;
+    private final HttpStreamBase stream;
+
+    HttpResponseBody(HttpStreamBase stream, ByteBuffer buffer, long nativeBodyChunk) {
+        this.buffer = buffer.asReadOnlyBuffer();
+        this.nativeBodyChunk = nativeBodyChunk;
+        this.nativeRetainedBuffer = 0;
+        this.refCount = null;
+        this.stream = stream;
+    }
+
+    private HttpResponseBody(long nativeRetainedBuffer, HttpStreamBase stream) {
+        this.nativeRetainedBuffer = nativeRetainedBuffer;
+        this.refCount = new AtomicInteger(1);
+        this.stream = stream;
+        this.buffer = httpResponseBodyGetBuffer(nativeRetainedBuffer).asReadOnlyBuffer();
+    }
+
+    /**
+     * @return a read-only direct ByteBuffer over the body data.
+     * @throws IllegalStateException if the body is no longer valid
+     */
+    public ByteBuffer getBuffer() {
+        ByteBuffer current = buffer;
+        if (current == null) {
+            throw new IllegalStateException(
+                    "HttpResponseBody is no longer valid; retain() it to use it past onResponseBody");
+        }
+        return current;
+    }
+
+    /**
+     * @return true if this body stays valid after the body callback returns
+     */
+    public boolean isRetained() {
+        return nativeRetainedBuffer != 0;
+    }
+
+    /**
+     * Keeps the body data valid past the end of the body callback.
+     * <p>
+     * Called on the body passed to the callback, this returns a new body backed by a pooled native buffer,
+     * which must be released via {@link #release()}. Called on an already-retained body, or again on the same
+     * callback body, this adds a reference and returns the same retained body, which must then be released one
+     * more time.
+     * </p>
+     * @return a body that stays valid until released
+     * @throws IllegalStateException if called on a callback body after the callback has returned
+     */
+    public HttpResponseBody retain() {
+        if (isRetained()) {
+            refCount.getAndUpdate((count) -> {
+                if (count <= 0) {
+                    throw new IllegalStateException("HttpResponseBody has already been released");
+                }
+                return count + 1;
+            });
+            return this;
+        }
+
+        long chunk = nativeBodyChunk;
+        if (chunk == 0) {
+            throw new IllegalStateException("HttpResponseBody can only be retained during onResponseBody");
+        }
+        if (retainedBody != null) {
+            return retainedBody.retain();
+        }
+        retainedBody = new HttpResponseBody(httpResponseBodyRetain(chunk), stream);
+        return retainedBody;
+    }
+
+    /**
+     * Releases one reference to a retained body. Once the last reference is released, the native buffer goes
+     * back to the pool, the window that was held back for it is added to the stream's window, and the ByteBuffer
+     * from {@link #getBuffer()} must no longer be used. Has no effect on bodies that were never retained.
+     * <p>
+     * Only window the body callback actually granted is held back, so releasing never opens the window further
+     * than the handler asked for: a callback that returns 0 gets no window back from releasing what it retained.
+     * </p>
+     * <p>
+     * Once the stream has completed or been closed, the last release only frees the native buffer and does not
+     * touch the stream's window, so retained bodies may safely outlive their stream.
+     * </p>
+     */
+    public void release() {
+        if (!isRetained()) {
+            return;
+        }
+
+        int count = refCount.decrementAndGet();
+        if (count == 0) {
+            int credit;
+            synchronized (this) {
+                released = true;
+                credit = withheldWindow;
+            }
+            buffer = null;
+            httpResponseBodyRelease(nativeRetainedBuffer);
+            /* nothing left to read once the stream is done, and a closed stream has no window */
+            if (credit > 0 && !stream.isResponseComplete() && !stream.isNull()) {
+                stream.incrementWindow(credit);
+            }
+        } else if (count < 0) {
+            throw new IllegalStateException("HttpResponseBody has already been released");
+        }
+    }
+
+    /**
+     * Same as {@link #release()}
+     */
+    @Override
+    public void close() {
+        release();
+    }
+
+    /*
+     * Called once the body callback returns, the native memory behind a callback body is about to be reused.
+     * Returns the retained copy of the body, or null if it was not retained.
+     */
+    HttpResponseBody invalidate() {
+        nativeBodyChunk = 0;
+        buffer = null;
+        return retainedBody;
+    }
+
+    /*
+     * Called on a retained body once the callback returned windowIncrement. Holds back at most the retained bytes
+     * of that increment, to be credited on the last release, and returns how much was held back.
+     */
+    synchronized int withholdWindow(int windowIncrement) {
+        if (released || windowIncrement <= 0) {
+            return 0;
+        }
+        withheldWindow = Math.min(windowIncrement, buffer.capacity());
+        return withheldWindow;
+    }
+
+    /*******************************************************************************
+     * native methods
+     ******************************************************************************/
+    private static native long httpResponseBodyRetain(long nativeBodyChunk);
+
+    private static native ByteBuffer httpResponseBodyGetBuffer(long nativeRetainedBuffer);
+
+    private static native void httpResponseBodyRelease(long nativeRetainedBuffer);
+}
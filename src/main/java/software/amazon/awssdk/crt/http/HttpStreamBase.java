@@ -20,6 +20,9 @@ import java.util.concurrent.CompletableFuture;
  */
 public class HttpStreamBase extends CrtResource {
 
+    /* Set once the response has completed, after which window updates are pointless */
+    private volatile boolean responseComplete = false;
+
     /*
      * Native code will call this constructor during
      * HttpClientConnection.makeRequest()
@@ -48,6 +51,14 @@ public class HttpStreamBase extends CrtResource {
         }
     }
 
+    void markResponseComplete() {
+        responseComplete = true;
+    }
+
+    boolean isResponseComplete() {
+        return responseComplete;
+    }
+
     /*******************************************************************************
      * Shared method
      ******************************************************************************/
@@ -5,6 +5,8 @@
 
 package software.amazon.awssdk.crt.http;
 
+import java.nio.ByteBuffer;
+
 /**
  * Interface that Native code knows how to call when handling Http Responses for HTTP/1.1 only.
  * You can use HttpStreamBaseResponseHandler instead to adapt both HTTP/1.1 and HTTP/2
@@ -24,6 +26,22 @@ public interface HttpStreamResponseHandler {
      */
     void onResponseHeaders(HttpStream stream, int responseStatusCode, int blockType, HttpHeader[] nextHeaders);
 
+    /**
+     * Called from Native when new Http Headers have been received, with a view that decodes headers only as they
+     * are looked up. The view is only valid until this method returns.
+     * The default implementation decodes every header and passes them to
+     * {@link #onResponseHeaders(HttpStream, int, int, HttpHeader[])}.
+     *
+     * @param stream The HttpStream object
+     * @param responseStatusCode The HTTP Response Status Code
+     * @param blockType The HTTP header block type
+     * @param nextHeaders The headers received in the latest IO event.
+     */
+    default void onResponseHeadersView(HttpStream stream, int responseStatusCode, int blockType,
+            HttpHeadersView nextHeaders) {
+        onResponseHeaders(stream, responseStatusCode, blockType, nextHeaders.toArray());
+    }
+
     /**
      * Called from Native once all HTTP Headers are processed. Will not be called if there are no Http Headers in the
      * response. Guaranteed to be called exactly once if there is at least 1 Header.
@@ -58,6 +76,40 @@ public interface HttpStreamResponseHandler {
         return bodyBytesIn.length;
     }
 
+    /**
+     * Opts this handler in to receiving response bodies through {@link #onResponseBody(HttpStream, HttpResponseBody)}.
+     * Checked once, when the stream is created. When false, the default, bodies are copied and passed straight to
+     * {@link #onResponseBody(HttpStream, byte[])}, and the HttpResponseBody overload is never called.
+     *
+     * @return true to receive response bodies as {@link HttpResponseBody}
+     */
+    default boolean useDirectResponseBody() {
+        return false;
+    }
+
+    /**
+     * Called when new Response Body bytes have been received, as a direct buffer over native memory that is only
+     * valid until this method returns, if {@link #useDirectResponseBody()} returns true. Override this instead of
+     * {@link #onResponseBody(HttpStream, byte[])} to read the body without copying it onto the Java heap, or to keep
+     * it past the callback via {@link HttpResponseBody#retain()}.
+     * <p>
+     * Bytes that are retained are held back from the returned window increment, and added to the window once they
+     * are released, so with manual window management the connection stops reading while too much body is held.
+     * </p>
+     * The default implementation copies the body and passes it to {@link #onResponseBody(HttpStream, byte[])}.
+     *
+     * @param stream The HTTP Stream the body was delivered to
+     * @param body The HTTP Body Bytes received in the last IO Event.
+     * @return The number of bytes to increment the window by, less any bytes retained
+     * @see HttpClientConnectionManagerOptions#withManualWindowManagement
+     */
+    default int onResponseBody(HttpStream stream, HttpResponseBody body) {
+        ByteBuffer buffer = body.getBuffer();
+        byte[] bodyBytesIn = new byte[buffer.remaining()];
+        buffer.get(bodyBytesIn);
+        return onResponseBody(stream, bodyBytesIn);
+    }
+
     /**
      * Called right before stream is complete, whether successful or unsuccessful.
      * @param stream The HTTP stream to which the metrics apply
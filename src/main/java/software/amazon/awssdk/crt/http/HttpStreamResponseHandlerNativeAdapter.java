@@ -13,23 +13,27 @@ import java.nio.ByteBuffer;
 class HttpStreamResponseHandlerNativeAdapter {
     private HttpStreamResponseHandler responseHandler;
     private HttpStreamBaseResponseHandler responseBaseHandler;
+    private final boolean directResponseBody;
 
     HttpStreamResponseHandlerNativeAdapter(HttpStreamResponseHandler responseHandler) {
         this.responseHandler = responseHandler;
         this.responseBaseHandler = null;
+        this.directResponseBody = responseHandler.useDirectResponseBody();
     }
 
     HttpStreamResponseHandlerNativeAdapter(HttpStreamBaseResponseHandler responseBaseHandler) {
         this.responseBaseHandler = responseBaseHandler;
         this.responseHandler = null;
+        this.directResponseBody = responseBaseHandler.useDirectResponseBody();
     }
 
     void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType, ByteBuffer headersBlob) {
-        HttpHeader[] headersArray = HttpHeader.loadHeadersFromMarshalledHeadersBlob(headersBlob);
-        if (this.responseBaseHandler != null) {
-            responseBaseHandler.onResponseHeaders(stream, responseStatusCode, blockType, headersArray);
-        } else {
-            responseHandler.onResponseHeaders((HttpStream) stream, responseStatusCode, blockType, headersArray);
+        try (HttpHeadersView headers = HttpHeadersView.fromMarshalledHeadersBlob(headersBlob)) {
+            if (this.responseBaseHandler != null) {
+                responseBaseHandler.onResponseHeadersView(stream, responseStatusCode, blockType, headers);
+            } else {
+                responseHandler.onResponseHeadersView((HttpStream) stream, responseStatusCode, blockType, headers);
+            }
         }
     }
 
@@ -41,14 +45,34 @@ class HttpStreamResponseHandlerNativeAdapter {
         }
     }
 
-    int onResponseBody(HttpStreamBase stream, ByteBuffer bodyBytesIn) {
-        byte[] body = new byte[bodyBytesIn.limit()];
-        bodyBytesIn.get(body);
-        if (this.responseBaseHandler != null) {
-            return responseBaseHandler.onResponseBody(stream, body);
-        } else {
-            return responseHandler.onResponseBody((HttpStream) stream, body);
+    int onResponseBody(HttpStreamBase stream, ByteBuffer bodyBytesIn, long nativeBodyChunk) {
+        if (!directResponseBody) {
+            byte[] body = new byte[bodyBytesIn.limit()];
+            bodyBytesIn.get(body);
+            if (this.responseBaseHandler != null) {
+                return responseBaseHandler.onResponseBody(stream, body);
+            } else {
+                return responseHandler.onResponseBody((HttpStream) stream, body);
+            }
+        }
+
+        HttpResponseBody body = new HttpResponseBody(stream, bodyBytesIn, nativeBodyChunk);
+        int windowIncrement;
+        HttpResponseBody retained;
+        try {
+            if (this.responseBaseHandler != null) {
+                windowIncrement = responseBaseHandler.onResponseBody(stream, body);
+            } else {
+                windowIncrement = responseHandler.onResponseBody((HttpStream) stream, body);
+            }
+        } finally {
+            retained = body.invalidate();
+        }
+        if (retained == null || windowIncrement < 0) {
+            return windowIncrement;
         }
+        /* only window the handler granted is held back, and it goes back when the retained body is released */
+        return windowIncrement - retained.withholdWindow(windowIncrement);
     }
 
     void onMetrics(HttpStreamBase stream, HttpStreamMetrics metrics) {
@@ -60,6 +84,7 @@ class HttpStreamResponseHandlerNativeAdapter {
     }
 
     void onResponseComplete(HttpStreamBase stream, int errorCode) {
+        stream.markResponseComplete();
         if (this.responseBaseHandler != null) {
             responseBaseHandler.onResponseComplete(stream, errorCode);
         } else {
@@ -19,6 +19,7 @@ import software.amazon.awssdk.crt.mqtt5.Mqtt5ClientOptions;
 import software.amazon.awssdk.crt.mqtt5.packets.ConnectPacket;
 import software.amazon.awssdk.crt.iot.AWSIoTMetrics;
 
+import java.util.List;
 import java.util.concurrent.CompletableFuture;
 import java.util.function.Consumer;
 
@@ -442,6 +443,58 @@ public class MqttClientConnection extends CrtResource {
         }
     }
 
+    /**
+     * Publishes a batch of messages with a single call into native code, for high rates of small messages where
+     * per-message overhead dominates. Messages are queued in list order. Instead of a future per message, the
+     * returned future completes once every message has completed the way a single publish would (written for
+     * QoS 0, acknowledged for QoS 1).
+     * <p>
+     * If a message can't be queued, the ones after it are not sent and their packet ids stay 0. Messages already
+     * queued can't be withdrawn, so the future still waits for them and then completes exceptionally, as it does
+     * if any message in the batch fails.
+     * </p>
+     *
+     * @param messages The messages to publish.
+     *
+     * @return Future value is the packet/message ids of the messages, in the order they were given
+     */
+    public CompletableFuture<short[]> publishBatch(List<MqttMessage> messages) {
+        CompletableFuture<short[]> future = new CompletableFuture<>();
+        if (isNull()) {
+            future.completeExceptionally(new MqttException("Invalid connection during publish"));
+            return future;
+        }
+
+        int count = messages.size();
+        String[] topics = new String[count];
+        int[] qos = new int[count];
+        boolean[] retain = new boolean[count];
+        byte[][] payloads = new byte[count][];
+        for (int i = 0; i < count; ++i) {
+            MqttMessage message = messages.get(i);
+            if (message.getTopic() == null) {
+                future.completeExceptionally(new IllegalArgumentException("MqttMessage topic must be non-null"));
+                return future;
+            }
+
+            topics[i] = message.getTopic();
+            qos[i] = message.getQos().getValue();
+            retain[i] = message.getRetain();
+            payloads[i] = message.getPayload();
+        }
+
+        AsyncCallback pubAck = AsyncCallback.wrapFuture(future, null);
+        try {
+            short[] packetIds = mqttClientConnectionPublishBatch(getNativeHandle(), topics, qos, retain, payloads,
+                    pubAck);
+            // When the whole batch completes, complete the returned future with the packetIds
+            return future.thenApply(unused -> packetIds);
+        } catch (CrtRuntimeException ex) {
+            future.completeExceptionally(ex);
+            return future;
+        }
+    }
+
     @Deprecated
     public CompletableFuture<Integer> publish(MqttMessage message, QualityOfService qos, boolean retain) {
         return publish(new MqttMessage(message.getTopic(), message.getPayload(), qos, retain));
@@ -503,6 +556,9 @@ public class MqttClientConnection extends CrtResource {
     private static native short mqttClientConnectionPublish(long connection, String topic, int qos, boolean retain,
             byte[] payload, AsyncCallback ack) throws CrtRuntimeException;
 
+    private static native short[] mqttClientConnectionPublishBatch(long connection, String[] topics, int[] qos,
+            boolean[] retain, byte[][] payloads, AsyncCallback ack) throws CrtRuntimeException;
+
     private static native boolean mqttClientConnectionSetWill(long connection, String topic, int qos, boolean retain,
             byte[] payload) throws CrtRuntimeException;
 
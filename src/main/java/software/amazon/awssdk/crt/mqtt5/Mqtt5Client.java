@@ -4,6 +4,7 @@
  */
 package software.amazon.awssdk.crt.mqtt5;
 
+import java.nio.ByteBuffer;
 import java.util.concurrent.CompletableFuture;
 import java.util.function.Consumer;
 
@@ -276,6 +277,29 @@ public class Mqtt5Client extends CrtResource {
     }
 
 
+    /*******************************************************************************
+     * publish batch methods
+     ******************************************************************************/
+
+    /**
+     * Called from native with the publishes received during one event loop tick, when PublishBatchEvents are set.
+     * @param records Direct buffer over the native batch, only valid until this method returns
+     * @param count The number of publishes in the batch
+     */
+    private void onPublishBatchReceived(ByteBuffer records, int count) {
+        Mqtt5ClientOptions.PublishBatchEvents events = clientOptions.getPublishBatchEvents();
+        if (events == null) {
+            return;
+        }
+
+        PublishBatch batch = new PublishBatch(records, count);
+        try {
+            events.onMessagesReceived(this, batch);
+        } finally {
+            batch.invalidate();
+        }
+    }
+
     /*******************************************************************************
      * native methods
      ******************************************************************************/
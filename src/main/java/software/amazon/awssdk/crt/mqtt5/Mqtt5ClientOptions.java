@@ -45,6 +45,7 @@ public class Mqtt5ClientOptions {
     private LifecycleEvents lifecycleEvents;
     private Consumer<Mqtt5WebsocketHandshakeTransformArgs> websocketHandshakeTransform;
     private PublishEvents publishEvents;
+    private PublishBatchEvents publishBatchEvents;
     private TopicAliasingOptions topicAliasingOptions;
     // Opt-out flag for AWS IoT Metrics. When true, metrics are disabled.
     // Default is false (metrics enabled).
@@ -261,6 +262,15 @@ public class Mqtt5ClientOptions {
         return this.publishEvents;
     }
 
+    /**
+     * Returns the PublishBatchEvents interface that will be called with batches of received messages.
+     *
+     * @return PublishBatchEvents interface that will be called with batches of received messages.
+     */
+    public PublishBatchEvents getPublishBatchEvents() {
+        return this.publishBatchEvents;
+    }
+
     /**
      * Returns the topic aliasing options to be used by the client
      *
@@ -323,6 +333,7 @@ public class Mqtt5ClientOptions {
         this.lifecycleEvents = builder.lifecycleEvents;
         this.websocketHandshakeTransform = builder.websocketHandshakeTransform;
         this.publishEvents = builder.publishEvents;
+        this.publishBatchEvents = builder.publishBatchEvents;
         this.topicAliasingOptions = builder.topicAliasingOptions;
         this.disableMetrics = builder.disableMetrics;
         this.userMetrics = builder.metrics;
@@ -403,6 +414,28 @@ public class Mqtt5ClientOptions {
         public void onMessageReceived(Mqtt5Client client, PublishReturn publishReturn);
     }
 
+    /**
+     * An interface the Mqtt5Client will call with all of the publish packets it received within one event loop tick.
+     * Meant for clients that receive many small messages, where building a PublishPacket per message and calling
+     * into Java once per message dominates the cost of receiving.
+     */
+    public interface PublishBatchEvents {
+        /**
+         * Called with the MQTT PUBLISH packets received by the client since the last batch.
+         *
+         * <p>The batch is only valid for the duration of this callback. QoS 1 messages are acknowledged by the client
+         * once this callback returns normally. If it throws, or the client shuts down before a batch is acknowledged,
+         * those messages are never acknowledged. The server does not redeliver them on the same connection: they stay
+         * unacknowledged and keep taking receive maximum slots until the client reconnects. Messages still pending
+         * when the client terminates are delivered in one last batch, from an event loop thread. Manual publish
+         * acknowledgement control is not available in batched mode.</p>
+         *
+         * @param client The client that has received the messages
+         * @param publishBatch The messages that were received from the server
+         */
+        public void onMessagesReceived(Mqtt5Client client, PublishBatch publishBatch);
+    }
+
     /*******************************************************************************
      * builder
      ******************************************************************************/
@@ -632,6 +665,7 @@ public class Mqtt5ClientOptions {
         private LifecycleEvents lifecycleEvents;
         private Consumer<Mqtt5WebsocketHandshakeTransformArgs> websocketHandshakeTransform;
         private PublishEvents publishEvents;
+        private PublishBatchEvents publishBatchEvents;
         private TopicAliasingOptions topicAliasingOptions;
         private boolean disableMetrics = false;
         private AWSIoTMetrics metrics = null;
@@ -891,6 +925,19 @@ public class Mqtt5ClientOptions {
             return this;
         }
 
+        /**
+         * Sets the PublishBatchEvents interface that will be called with batches of received messages.
+         * When set, received messages are only delivered in batches and the PublishEvents interface is not called.
+         *
+         * @param publishBatchEvents The PublishBatchEvents interface that will be called with batches of received
+         *                           messages.
+         * @return The Mqtt5ClientOptionsBuilder after setting the PublishBatchEvents interface
+         */
+        public Mqtt5ClientOptionsBuilder withPublishBatchEvents(PublishBatchEvents publishBatchEvents) {
+            this.publishBatchEvents = publishBatchEvents;
+            return this;
+        }
+
         /**
          * Sets the topic aliasing options for clients constructed from this builder
          *
@@ -0,0 +1,299 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.mqtt5;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+import software.amazon.awssdk.crt.mqtt5.packets.PublishPacket;
+import software.amazon.awssdk.crt.mqtt5.packets.PublishPacket.PayloadFormatIndicator;
+import software.amazon.awssdk.crt.mqtt5.packets.PublishPacket.PublishPacketBuilder;
+import software.amazon.awssdk.crt.mqtt5.packets.UserProperty;
+
+/**
+ * A group of MQTT PUBLISH packets received by the client within a single event loop tick, delivered through
+ * {@link Mqtt5ClientOptions.PublishBatchEvents}.
+ * <p>
+ * The publishes are kept in a single compact native buffer and are only decoded when a field is asked for, so
+ * looking at the topic and payload of a message does not build a {@link PublishPacket} for it.
+ * The batch and every ByteBuffer obtained from it point straight at native memory and are only valid until
+ * {@link Mqtt5ClientOptions.PublishBatchEvents#onMessagesReceived} returns. Copy out anything that is needed later,
+ * for example with {@link #getPayloadBytes(int)} or {@link #toPublishPacket(int)}.
+ * </p>
+ */
+public final class PublishBatch {
+
+    /* Must match the record layout written in mqtt5_client.c */
+    private static final int RECORD_LENGTH_SIZE = 4;
+    private static final int QOS_OFFSET = 0;
+    private static final int FLAGS_OFFSET = 1;
+    private static final int PAYLOAD_FORMAT_OFFSET = 2;
+    private static final int MESSAGE_EXPIRY_INTERVAL_OFFSET = 4;
+    private static final int TOPIC_ALIAS_OFFSET = 8;
+    private static final int TOPIC_LENGTH_OFFSET = 10;
+    private static final int PAYLOAD_LENGTH_OFFSET = 12;
+    private static final int RESPONSE_TOPIC_LENGTH_OFFSET = 16;
+    private static final int CORRELATION_DATA_LENGTH_OFFSET = 18;
+    private static final int CONTENT_TYPE_LENGTH_OFFSET = 20;
+    private static final int SUBSCRIPTION_IDENTIFIER_COUNT_OFFSET = 24;
+    private static final int USER_PROPERTY_COUNT_OFFSET = 28;
+    private static final int TOPIC_OFFSET = 32;
+
+    private static final int FLAG_RETAIN = 0x01;
+    private static final int FLAG_PAYLOAD_FORMAT = 0x02;
+    private static final int FLAG_MESSAGE_EXPIRY_INTERVAL = 0x04;
+    private static final int FLAG_TOPIC_ALIAS = 0x08;
+    private static final int FLAG_RESPONSE_TOPIC = 0x10;
+    private static final int FLAG_CORRELATION_DATA = 0x20;
+    private static final int FLAG_CONTENT_TYPE = 0x40;
+
+    private volatile ByteBuffer buffer;
+
+    /* Absolute position of the fixed header of each record */
+    private final int[] recordOffsets;
+
+    PublishBatch(ByteBuffer buffer, int count) {
+        this.buffer = buffer;
+        this.recordOffsets = new int[count];
+
+        int position = 0;
+        for (int i = 0; i < count; ++i) {
+            recordOffsets[i] = position + RECORD_LENGTH_SIZE;
+            position += RECORD_LENGTH_SIZE + buffer.getInt(position);
+        }
+    }
+
+    /**
+     * @return the number of publishes in this batch
+     */
+    public int size() {
+        return recordOffsets.length;
+    }
+
+    /**
+     * @param index index of the publish within the batch
+     * @return the MQTT quality of service level the publish was delivered with
+     */
+    public QOS getQOS(int index) {
+        return QOS.getEnumValueFromInteger(getBuffer().get(recordOffset(index) + QOS_OFFSET));
+    }
+
+    /**
+     * @param index index of the publish within the batch
+     * @return true if this publish was a retained message
+     */
+    public boolean getRetain(int index) {
+        return (flags(index) & FLAG_RETAIN) != 0;
+    }
+
+    /**
+     * @param index index of the publish within the batch
+     * @return the topic the publish was sent to
+     */
+    public String getTopic(int index) {
+        int offset = recordOffset(index);
+        return decodeString(getBuffer(), offset + TOPIC_OFFSET, unsignedShort(offset + TOPIC_LENGTH_OFFSET));
+    }
+
+    /**
+     * @param index index of the publish within the batch
+     * @return a read-only direct ByteBuffer over the payload, only valid for the duration of the callback
+     */
+    public ByteBuffer getPayload(int index) {
+        int offset = recordOffset(index);
+        int payloadOffset = offset + TOPIC_OFFSET + unsignedShort(offset + TOPIC_LENGTH_OFFSET);
+        return slice(getBuffer(), payloadOffset, getBuffer().getInt(offset + PAYLOAD_LENGTH_OFFSET));
+    }
+
+    /**
+     * @param index index of the publish within the batch
+     * @return a copy of the payload on the Java heap
+     */
+    public byte[] getPayloadBytes(int index) {
+        ByteBuffer payload = getPayload(index);
+        byte[] bytes = new byte[payload.remaining()];
+        payload.get(bytes);
+        return bytes;
+    }
+
+    /**
+     * Received publishes - Returns the subscription identifiers of all the subscriptions this message matched.
+     *
+     * @param index index of the publish within the batch
+     * @return the subscription identifiers of the publish, or null if there were none
+     */
+    public List<Long> getSubscriptionIdentifiers(int index) {
+        RecordReader reader = new RecordReader(index);
+        reader.skipVariableFields();
+        return reader.readSubscriptionIdentifiers();
+    }
+
+    /**
+     * Decodes every field of a publish into a new {@link PublishPacket}, which stays valid after the callback.
+     * Subscription identifiers are not part of the returned packet, use {@link #getSubscriptionIdentifiers(int)}.
+     *
+     * @param index index of the publish within the batch
+     * @return a PublishPacket holding a copy of the publish
+     */
+    public PublishPacket toPublishPacket(int index) {
+        RecordReader reader = new RecordReader(index);
+        int flags = reader.flags;
+
+        PublishPacketBuilder builder = new PublishPacketBuilder(reader.readString(reader.topicLength),
+                QOS.getEnumValueFromInteger(reader.qos), reader.readBytes(reader.payloadLength));
+        builder.withRetain((flags & FLAG_RETAIN) != 0);
+        if ((flags & FLAG_PAYLOAD_FORMAT) != 0) {
+            builder.withPayloadFormat(PayloadFormatIndicator.getEnumValueFromInteger(reader.payloadFormat));
+        }
+        if ((flags & FLAG_MESSAGE_EXPIRY_INTERVAL) != 0) {
+            builder.withMessageExpiryIntervalSeconds(reader.messageExpiryIntervalSeconds);
+        }
+        if ((flags & FLAG_TOPIC_ALIAS) != 0) {
+            builder.withTopicAlias(reader.topicAlias);
+        }
+
+        String responseTopic = reader.readString(reader.responseTopicLength);
+        byte[] correlationData = reader.readBytes(reader.correlationDataLength);
+        String contentType = reader.readString(reader.contentTypeLength);
+        if ((flags & FLAG_RESPONSE_TOPIC) != 0) {
+            builder.withResponseTopic(responseTopic);
+        }
+        if ((flags & FLAG_CORRELATION_DATA) != 0) {
+            builder.withCorrelationData(correlationData);
+        }
+        if ((flags & FLAG_CONTENT_TYPE) != 0) {
+            builder.withContentType(contentType);
+        }
+
+        reader.readSubscriptionIdentifiers();
+        builder.withUserProperties(reader.readUserProperties());
+
+        return builder.build();
+    }
+
+    /* Called once the batch callback returns, the native memory behind the batch is about to be reused */
+    void invalidate() {
+        buffer = null;
+    }
+
+    private ByteBuffer getBuffer() {
+        ByteBuffer current = buffer;
+        if (current == null) {
+            throw new IllegalStateException("PublishBatch is only valid during onMessagesReceived");
+        }
+        return current;
+    }
+
+    private int recordOffset(int index) {
+        if (index < 0 || index >= recordOffsets.length) {
+            throw new IndexOutOfBoundsException(
+                    "Index " + index + " is out of range for a batch of " + recordOffsets.length);
+        }
+        return recordOffsets[index];
+    }
+
+    private int flags(int index) {
+        return getBuffer().get(recordOffset(index) + FLAGS_OFFSET);
+    }
+
+    private int unsignedShort(int position) {
+        return getBuffer().getShort(position) & 0xFFFF;
+    }
+
+    private static ByteBuffer slice(ByteBuffer buffer, int position, int length) {
+        ByteBuffer view = buffer.duplicate();
+        view.limit(position + length);
+        view.position(position);
+        return view.slice().asReadOnlyBuffer();
+    }
+
+    private static String decodeString(ByteBuffer buffer, int position, int length) {
+        byte[] bytes = new byte[length];
+        ByteBuffer view = buffer.duplicate();
+        view.position(position);
+        view.get(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    /* Walks the variable length part of one record in order */
+    private class RecordReader {
+        final int qos;
+        final int flags;
+        final int payloadFormat;
+        final long messageExpiryIntervalSeconds;
+        final int topicAlias;
+        final int topicLength;
+        final int payloadLength;
+        final int responseTopicLength;
+        final int correlationDataLength;
+        final int contentTypeLength;
+        final int subscriptionIdentifierCount;
+        final int userPropertyCount;
+
+        private final ByteBuffer view;
+
+        RecordReader(int index) {
+            int offset = recordOffset(index);
+            view = getBuffer().duplicate();
+
+            qos = view.get(offset + QOS_OFFSET);
+            flags = view.get(offset + FLAGS_OFFSET);
+            payloadFormat = view.get(offset + PAYLOAD_FORMAT_OFFSET);
+            messageExpiryIntervalSeconds = view.getInt(offset + MESSAGE_EXPIRY_INTERVAL_OFFSET) & 0xFFFFFFFFL;
+            topicAlias = view.getShort(offset + TOPIC_ALIAS_OFFSET) & 0xFFFF;
+            topicLength = view.getShort(offset + TOPIC_LENGTH_OFFSET) & 0xFFFF;
+            payloadLength = view.getInt(offset + PAYLOAD_LENGTH_OFFSET);
+            responseTopicLength = view.getShort(offset + RESPONSE_TOPIC_LENGTH_OFFSET) & 0xFFFF;
+            correlationDataLength = view.getShort(offset + CORRELATION_DATA_LENGTH_OFFSET) & 0xFFFF;
+            contentTypeLength = view.getShort(offset + CONTENT_TYPE_LENGTH_OFFSET) & 0xFFFF;
+            subscriptionIdentifierCount = view.getInt(offset + SUBSCRIPTION_IDENTIFIER_COUNT_OFFSET);
+            userPropertyCount = view.getInt(offset + USER_PROPERTY_COUNT_OFFSET);
+
+            view.position(offset + TOPIC_OFFSET);
+        }
+
+        void skipVariableFields() {
+            view.position(view.position() + topicLength + payloadLength + responseTopicLength
+                    + correlationDataLength + contentTypeLength);
+        }
+
+        byte[] readBytes(int length) {
+            byte[] bytes = new byte[length];
+            view.get(bytes);
+            return bytes;
+        }
+
+        String readString(int length) {
+            return new String(readBytes(length), StandardCharsets.UTF_8);
+        }
+
+        List<Long> readSubscriptionIdentifiers() {
+            if (subscriptionIdentifierCount == 0) {
+                return null;
+            }
+            List<Long> identifiers = new ArrayList<>(subscriptionIdentifierCount);
+            for (int i = 0; i < subscriptionIdentifierCount; ++i) {
+                identifiers.add(view.getInt() & 0xFFFFFFFFL);
+            }
+            return Collections.unmodifiableList(identifiers);
+        }
+
+        List<UserProperty> readUserProperties() {
+            if (userPropertyCount == 0) {
+                return null;
+            }
+            List<UserProperty> properties = new ArrayList<>(userPropertyCount);
+            for (int i = 0; i < userPropertyCount; ++i) {
+                String key = readString(view.getShort() & 0xFFFF);
+                String value = readString(view.getShort() & 0xFFFF);
+                properties.add(new UserProperty(key, value));
+            }
+            return properties;
+        }
+    }
+}
@@ -226,7 +226,8 @@ public class S3Client extends CrtResource {
                 fioOptionsSet,
                 shouldStream,
                 diskThroughputGbps,
-                directIo);
+                directIo,
+                options.getDirectResponseBody());
 
         metaRequest.setMetaRequestNativeHandle(metaRequestNativeHandle);
 
@@ -305,5 +306,6 @@ public class S3Client extends CrtResource {
             boolean fioOptionsSet,
             boolean shouldStream,
             double diskThroughputGbps,
-            boolean directIo);
+            boolean directIo,
+            boolean directResponseBody);
 }
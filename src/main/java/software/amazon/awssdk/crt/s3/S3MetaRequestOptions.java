@@ -96,6 +96,7 @@ public class S3MetaRequestOptions {
     private ResumeToken resumeToken;
     private Long objectSizeHint;
     private FileIoOptions fileIoOptions;
+    private boolean directResponseBody = false;
 
     public S3MetaRequestOptions withMetaRequestType(MetaRequestType metaRequestType) {
         this.metaRequestType = metaRequestType;
@@ -472,4 +473,25 @@ public class S3MetaRequestOptions {
     public FileIoOptions getFileIoOptions() {
         return fileIoOptions;
     }
+
+    /**
+     * If set true, the response body is delivered to
+     * {@link S3MetaRequestResponseHandler#onResponseBody(S3ResponseBody, long, long)} as a read-only direct
+     * ByteBuffer over native memory, instead of being copied into a new byte[] for every part.
+     * This avoids Java heap allocation for the body at high throughput.
+     * The buffer is only valid during the callback, unless it is retained via {@link S3ResponseBody#retain()}.
+     *
+     * By default, this is false.
+     *
+     * @param directResponseBody whether to deliver the response body as direct ByteBuffers
+     * @return this
+     */
+    public S3MetaRequestOptions withDirectResponseBody(boolean directResponseBody) {
+        this.directResponseBody = directResponseBody;
+        return this;
+    }
+
+    public boolean getDirectResponseBody() {
+        return directResponseBody;
+    }
 }
@@ -6,6 +6,7 @@ package software.amazon.awssdk.crt.s3;
 
 import java.nio.ByteBuffer;
 import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpHeadersView;
 
 /**
  * Interface called by native code to provide S3MetaRequest responses.
@@ -23,6 +24,19 @@ public interface S3MetaRequestResponseHandler {
     default void onResponseHeaders(final int statusCode, final HttpHeader[] headers) {
     }
 
+    /**
+     * Invoked to provide response headers, with a view that decodes headers only as they are looked up.
+     * The view is only valid until this method returns.
+     * Override this instead of {@link #onResponseHeaders(int, HttpHeader[])} to avoid decoding every header.
+     * The default implementation decodes every header and passes them to {@link #onResponseHeaders(int, HttpHeader[])}.
+     *
+     * @param statusCode statusCode of the HTTP response
+     * @param headers the headers received
+     */
+    default void onResponseHeadersView(final int statusCode, final HttpHeadersView headers) {
+        onResponseHeaders(statusCode, headers.toArray());
+    }
+
     /**
      * Invoked to provide the response body as it is received.
      * <p>
@@ -50,6 +64,28 @@ public interface S3MetaRequestResponseHandler {
         return 0;
     }
 
+    /**
+     * Invoked instead of {@link #onResponseBody(ByteBuffer, long, long)} when the meta request was made with
+     * {@link S3MetaRequestOptions#withDirectResponseBody} enabled.
+     * <p>
+     * The body is a read-only direct ByteBuffer over native memory, so no Java heap is allocated per part.
+     * It is only valid until this method returns, unless {@link S3ResponseBody#retain()} is called,
+     * in which case the retained body must later be released via {@link S3ResponseBody#release()}.
+     * </p>
+     * The default implementation passes the body's buffer to {@link #onResponseBody(ByteBuffer, long, long)}.
+     * Flow-control works the same way as for {@link #onResponseBody(ByteBuffer, long, long)}.
+     *
+     * @param body The body data for this chunk of the object
+     * @param objectRangeStart The byte index of the object that this refers to
+     * @param objectRangeEnd corresponds to the past-of-end chunk offset, i.e. objectRangeStart + the chunk length
+     * @return The number of bytes to increment the flow-control window by
+     *
+     * @see S3ClientOptions#withReadBackpressureEnabled
+     */
+    default int onResponseBody(S3ResponseBody body, long objectRangeStart, long objectRangeEnd) {
+        return onResponseBody(body.getBuffer(), objectRangeStart, objectRangeEnd);
+    }
+
     /**
      * Invoked when the entire meta request execution is complete.
      * @param context a wrapper object containing the following fields
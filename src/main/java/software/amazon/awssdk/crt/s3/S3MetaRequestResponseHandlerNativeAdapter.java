@@ -5,6 +5,7 @@
 package software.amazon.awssdk.crt.s3;
 
 import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpHeadersView;
 
 import java.nio.ByteBuffer;
 
@@ -19,6 +20,15 @@ class S3MetaRequestResponseHandlerNativeAdapter {
         return this.responseHandler.onResponseBody(ByteBuffer.wrap(bodyBytesIn), objectRangeStart, objectRangeEnd);
     }
 
+    int onResponseBodyDirect(ByteBuffer bodyBuffer, long nativeBodyChunk, long objectRangeStart, long objectRangeEnd) {
+        S3ResponseBody body = new S3ResponseBody(bodyBuffer.asReadOnlyBuffer(), nativeBodyChunk);
+        try {
+            return this.responseHandler.onResponseBody(body, objectRangeStart, objectRangeEnd);
+        } finally {
+            body.invalidate();
+        }
+    }
+
     void onFinished(int errorCode, int responseStatus, byte[] errorPayload, String errorOperationName, int checksumAlgorithm, boolean didValidateChecksum, Throwable cause, final ByteBuffer headersBlob) {
         HttpHeader[] errorHeaders = headersBlob == null ? null : HttpHeader.loadHeadersFromMarshalledHeadersBlob(headersBlob);
         S3FinishedResponseContext context = new S3FinishedResponseContext(errorCode, responseStatus, errorPayload, errorOperationName, ChecksumAlgorithm.getEnumValueFromInteger(checksumAlgorithm), didValidateChecksum, cause, errorHeaders);
@@ -26,7 +36,9 @@ class S3MetaRequestResponseHandlerNativeAdapter {
     }
 
     void onResponseHeaders(final int statusCode, final ByteBuffer headersBlob) {
-        responseHandler.onResponseHeaders(statusCode, HttpHeader.loadHeadersFromMarshalledHeadersBlob(headersBlob));
+        try (HttpHeadersView headers = HttpHeadersView.fromMarshalledHeadersBlob(headersBlob)) {
+            responseHandler.onResponseHeadersView(statusCode, headers);
+        }
     }
 
     void onProgress(final S3MetaRequestProgress progress) {
@@ -0,0 +1,135 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt.s3;
+
+import java.nio.ByteBuffer;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * A chunk of response body data delivered as a read-only direct ByteBuffer over native memory.
+ * Only used when {@link S3MetaRequestOptions#withDirectResponseBody} is enabled.
+ * <p>
+ * The body passed to {@link S3MetaRequestResponseHandler#onResponseBody(S3ResponseBody, long, long)} points
+ * directly at the native part buffer, no copy is made into the Java heap. That view is only valid until the
+ * callback returns. To keep the data longer, call {@link #retain()} during the callback, which moves the data
+ * into a pooled native buffer that stays valid until {@link #release()} is called.
+ * Every retained body must be released exactly once per call to {@link #retain()}, or native memory will leak.
+ * </p>
+ */
+public final class S3ResponseBody implements AutoCloseable {
+
+    private volatile ByteBuffer buffer;
+
+    /* Native chunk, only valid while the body callback is running */
+    private volatile long nativeBodyChunk;
+
+    /* Native retained buffer, 0 for bodies that only live for the duration of the callback */
+    private final long nativeRetainedBuffer;
+    private final AtomicInteger refCount;
+
+    S3ResponseBody(ByteBuffer buffer, long nativeBodyChunk) {
+        this.buffer = buffer;
+        this.nativeBodyChunk = nativeBodyChunk;
+        this.nativeRetainedBuffer = 0;
+        this.refCount = null;
+    }
+
+    private S3ResponseBody(long nativeRetainedBuffer) {
+        this.nativeRetainedBuffer = nativeRetainedBuffer;
+        this.refCount = new AtomicInteger(1);
+        this.buffer = s3ResponseBodyGetBuffer(nativeRetainedBuffer).asReadOnlyBuffer();
+    }
+
+    /**
+     * @return a read-only direct ByteBuffer over the body data.
+     * @throws IllegalStateException if the body is no longer valid
+     */
+    public ByteBuffer getBuffer() {
+        ByteBuffer current = buffer;
+        if (current == null) {
+            throw new IllegalStateException("S3ResponseBody is no longer valid; retain() it to use it past onResponseBody");
+        }
+        return current;
+    }
+
+    /**
+     * @return true if this body stays valid after the body callback returns
+     */
+    public boolean isRetained() {
+        return nativeRetainedBuffer != 0;
+    }
+
+    /**
+     * Keeps the body data valid past the end of the body callback.
+     * <p>
+     * Called on the body passed to the callback, this returns a new body backed by a pooled native buffer,
+     * which must be released via {@link #release()}. Called on an already-retained body, this adds a reference
+     * and returns the same body, which must then be released one more time.
+     * </p>
+     * @return a body that stays valid until released
+     * @throws IllegalStateException if called on a callback body after the callback has returned
+     */
+    public S3ResponseBody retain() {
+        if (isRetained()) {
+            refCount.getAndUpdate((count) -> {
+                if (count <= 0) {
+                    throw new IllegalStateException("S3ResponseBody has already been released");
+                }
+                return count + 1;
+            });
+            return this;
+        }
+
+        long chunk = nativeBodyChunk;
+        if (chunk == 0) {
+            throw new IllegalStateException("S3ResponseBody can only be retained during onResponseBody");
+        }
+        return new S3ResponseBody(s3ResponseBodyRetain(chunk));
+    }
+
+    /**
+     * Releases one reference to a retained body. Once the last reference is released, the native buffer goes
+     * back to the pool and the ByteBuffer from {@link #getBuffer()} must no longer be used.
+     * Has no effect on bodies that were never retained.
+     */
+    public void release() {
+        if (!isRetained()) {
+            return;
+        }
+
+        int count = refCount.decrementAndGet();
+        if (count == 0) {
+            buffer = null;
+            s3ResponseBodyRelease(nativeRetainedBuffer);
+        } else if (count < 0) {
+            throw new IllegalStateException("S3ResponseBody has already been released");
+        }
+    }
+
+    /**
+     * Same as {@link #release()}
+     */
+    @Override
+    public void close() {
+        release();
+    }
+
+    /* Called once the body callback returns, the native memory behind a callback body is about to be reused */
+    void invalidate() {
+        if (!isRetained()) {
+            nativeBodyChunk = 0;
+            buffer = null;
+        }
+    }
+
+    /*******************************************************************************
+     * native methods
+     ******************************************************************************/
+    private static native long s3ResponseBodyRetain(long nativeBodyChunk);
+
+    private static native ByteBuffer s3ResponseBodyGetBuffer(long nativeRetainedBuffer);
+
+    private static native void s3ResponseBodyRelease(long nativeRetainedBuffer);
+}
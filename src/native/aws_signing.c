@@ -9,10 +9,12 @@
 #include "credentials.h"
 #include "http_request_utils.h"
 #include "java_class_ids.h"
+#include "sigv4_signer.h"
 
 #include <jni.h>
 #include <string.h>
 
+#include <aws/auth/auth.h>
 #include <aws/auth/credentials.h>
 #include <aws/auth/signable.h>
 #include <aws/auth/signing.h>
@@ -602,6 +604,243 @@ on_error:
     s_cleanup_callback_data(callback_data, env);
 }
 
+/* Configs the synchronous signer turns down are caller errors, anything else is a runtime failure */
+static void s_throw_sign_now_exception(JNIEnv *env, const char *function_name) {
+    int error_code = aws_last_error();
+    if (error_code == AWS_ERROR_INVALID_ARGUMENT || error_code == AWS_AUTH_SIGNING_ILLEGAL_REQUEST_HEADER ||
+        error_code == AWS_AUTH_SIGNING_ILLEGAL_REQUEST_QUERY_PARAM) {
+        aws_jni_throw_illegal_argument_exception(
+            env,
+            "AwsSigner.%s: requires a SigV4 header or query param signing config with static credentials, a region, "
+            "a service, no conflicting headers or X-Amz-* query params and a signed body value for requests with a "
+            "body",
+            function_name);
+        return;
+    }
+    aws_jni_throw_runtime_exception(env, "AwsSigner.%s: signing failed: %s", function_name, aws_error_str(error_code));
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_auth_signing_AwsSigner_awsSignerSignNow(
+    JNIEnv *env,
+    jclass jni_class,
+    jbyteArray marshalled_request,
+    jboolean has_body,
+    jobject java_signing_config) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    jbyteArray result = NULL;
+
+    struct aws_signing_config_data config_data;
+    AWS_ZERO_STRUCT(config_data);
+    struct aws_signing_config_aws config;
+    AWS_ZERO_STRUCT(config);
+    struct aws_jni_sigv4_context context;
+    AWS_ZERO_STRUCT(context);
+    struct aws_jni_sigv4_scratch scratch;
+    AWS_ZERO_STRUCT(scratch);
+    struct aws_byte_buf output;
+    AWS_ZERO_STRUCT(output);
+    struct aws_byte_cursor marshalled_cursor;
+    AWS_ZERO_STRUCT(marshalled_cursor);
+
+    if (aws_build_signing_config(env, java_signing_config, &config_data, &config)) {
+        aws_jni_throw_runtime_exception(env, "AwsSigner.signNow: failed to create signing configuration");
+        goto done;
+    }
+
+    if (aws_jni_sigv4_context_init(&context, allocator, &config) ||
+        aws_jni_sigv4_scratch_init(&scratch, allocator) || aws_byte_buf_init(&output, allocator, 512)) {
+        s_throw_sign_now_exception(env, "signNow");
+        goto done;
+    }
+
+    /* Not a critical acquire, a shouldSignHeader predicate calls back into Java while the request is being read */
+    marshalled_cursor = aws_jni_byte_cursor_from_jbyteArray_acquire(env, marshalled_request);
+    if (marshalled_cursor.ptr == NULL) {
+        goto done;
+    }
+
+    struct aws_jni_sigv4_request request;
+    if (aws_jni_sigv4_request_from_marshalled(&request, marshalled_cursor)) {
+        s_throw_sign_now_exception(env, "signNow");
+        goto done;
+    }
+    request.has_body = has_body;
+
+    if (aws_jni_sigv4_sign_request(&context, &scratch, &request, &output)) {
+        s_throw_sign_now_exception(env, "signNow");
+        goto done;
+    }
+
+    struct aws_byte_cursor output_cursor = aws_byte_cursor_from_buf(&output);
+    result = aws_jni_byte_array_from_cursor(env, &output_cursor);
+
+done:
+
+    if (marshalled_cursor.ptr != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_release(env, marshalled_request, marshalled_cursor);
+    }
+    aws_byte_buf_clean_up(&output);
+    aws_jni_sigv4_scratch_clean_up(&scratch);
+    aws_jni_sigv4_context_clean_up(&context);
+    aws_signing_config_data_clean_up(&config_data, env);
+
+    return result;
+}
+
+/*
+ * Batch presigning. Every request in a batch shares the method, headers and signing context, only the path differs,
+ * so the scope, credential and signing key are worked out once and one scratch space is reused for every path.
+ * Paths are signed on the calling thread, which a shouldSignHeader predicate calling into Java requires anyway.
+ */
+
+/* Splits the marshalled paths, [be32 length][path] each, into cursors */
+static int s_presign_batch_parse_paths(struct aws_byte_cursor marshalled_paths, struct aws_array_list *paths) {
+    while (marshalled_paths.len > 0) {
+        uint32_t path_length = 0;
+        if (!aws_byte_cursor_read_be32(&marshalled_paths, &path_length) || path_length > marshalled_paths.len) {
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        }
+        struct aws_byte_cursor path = aws_byte_cursor_advance(&marshalled_paths, path_length);
+        if (aws_array_list_push_back(paths, &path)) {
+            return AWS_OP_ERR;
+        }
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* Each result is [be32 length][path?params] */
+static int s_presign_batch(
+    const struct aws_jni_sigv4_context *context,
+    const struct aws_jni_sigv4_request *request_template,
+    const struct aws_array_list *paths,
+    struct aws_byte_buf *output) {
+
+    size_t path_count = aws_array_list_length(paths);
+    int result = AWS_OP_ERR;
+
+    struct aws_jni_sigv4_scratch scratch;
+    if (aws_jni_sigv4_scratch_init(&scratch, context->allocator)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Presigned paths come out at a couple hundred bytes each */
+    if (aws_byte_buf_reserve_relative(output, path_count * 256)) {
+        goto done;
+    }
+
+    struct aws_jni_sigv4_request request = *request_template;
+    for (size_t i = 0; i < path_count; ++i) {
+        aws_array_list_get_at(paths, &request.path, i);
+
+        size_t length_offset = output->len;
+        uint8_t length_placeholder[4] = {0};
+        struct aws_byte_cursor placeholder_cursor = aws_byte_cursor_from_array(length_placeholder, 4);
+        bool has_query = request.path.len > 0 && memchr(request.path.ptr, '?', request.path.len) != NULL;
+        if (aws_byte_buf_append_dynamic(output, &placeholder_cursor) ||
+            aws_byte_buf_append_dynamic(output, &request.path) ||
+            aws_byte_buf_append_byte_dynamic(output, has_query ? '&' : '?') ||
+            aws_jni_sigv4_sign_request(context, &scratch, &request, output)) {
+            goto done;
+        }
+
+        size_t entry_length = output->len - length_offset - 4;
+        if (entry_length > UINT32_MAX) {
+            aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+            goto done;
+        }
+        aws_write_u32((uint32_t)entry_length, output->buffer + length_offset);
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_jni_sigv4_scratch_clean_up(&scratch);
+    return result;
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_auth_signing_AwsSigner_awsSignerPresignBatch(
+    JNIEnv *env,
+    jclass jni_class,
+    jbyteArray marshalled_request,
+    jbyteArray marshalled_paths,
+    jobject java_signing_config) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    jbyteArray result = NULL;
+
+    struct aws_signing_config_data config_data;
+    AWS_ZERO_STRUCT(config_data);
+    struct aws_signing_config_aws config;
+    AWS_ZERO_STRUCT(config);
+    struct aws_jni_sigv4_context context;
+    AWS_ZERO_STRUCT(context);
+    struct aws_array_list paths;
+    AWS_ZERO_STRUCT(paths);
+    struct aws_byte_buf output;
+    AWS_ZERO_STRUCT(output);
+    struct aws_byte_cursor request_cursor;
+    AWS_ZERO_STRUCT(request_cursor);
+    struct aws_byte_cursor paths_cursor;
+    AWS_ZERO_STRUCT(paths_cursor);
+
+    if (aws_build_signing_config(env, java_signing_config, &config_data, &config)) {
+        aws_jni_throw_runtime_exception(env, "AwsSigner.presignBatch: failed to create signing configuration");
+        goto done;
+    }
+
+    if (aws_jni_sigv4_context_init(&context, allocator, &config) ||
+        aws_array_list_init_dynamic(&paths, allocator, 64, sizeof(struct aws_byte_cursor)) ||
+        aws_byte_buf_init(&output, allocator, 1024)) {
+        s_throw_sign_now_exception(env, "presignBatch");
+        goto done;
+    }
+
+    /* Not critical acquires, the paths are signed while other threads may need the JVM to make progress */
+    request_cursor = aws_jni_byte_cursor_from_jbyteArray_acquire(env, marshalled_request);
+    if (request_cursor.ptr == NULL) {
+        goto done;
+    }
+    paths_cursor = aws_jni_byte_cursor_from_jbyteArray_acquire(env, marshalled_paths);
+    if (paths_cursor.ptr == NULL) {
+        goto done;
+    }
+
+    struct aws_jni_sigv4_request request_template;
+    if (aws_jni_sigv4_request_from_marshalled(&request_template, request_cursor) ||
+        s_presign_batch_parse_paths(paths_cursor, &paths) ||
+        s_presign_batch(&context, &request_template, &paths, &output)) {
+        s_throw_sign_now_exception(env, "presignBatch");
+        goto done;
+    }
+
+    struct aws_byte_cursor output_cursor = aws_byte_cursor_from_buf(&output);
+    result = aws_jni_byte_array_from_cursor(env, &output_cursor);
+
+done:
+
+    if (paths_cursor.ptr != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_release(env, marshalled_paths, paths_cursor);
+    }
+    if (request_cursor.ptr != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_release(env, marshalled_request, request_cursor);
+    }
+    aws_byte_buf_clean_up(&output);
+    aws_array_list_clean_up(&paths);
+    aws_jni_sigv4_context_clean_up(&context);
+    aws_signing_config_data_clean_up(&config_data, env);
+
+    return result;
+}
+
 JNIEXPORT
 bool JNICALL Java_software_amazon_awssdk_crt_auth_signing_AwsSigningUtils_awsSigningUtilsVerifyEcdsaSignature(
     JNIEnv *env,
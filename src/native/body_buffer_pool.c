@@ -0,0 +1,137 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "body_buffer_pool.h"
+
+#include <aws/common/array_list.h>
+#include <aws/common/mutex.h>
+#include <aws/common/ref_count.h>
+
+struct aws_jni_body_buffer_pool {
+    struct aws_allocator *allocator;
+    struct aws_ref_count ref_count;
+    size_t max_pooled_buffers;
+
+    struct aws_mutex lock;
+    /* struct aws_jni_retained_body_buffer *, protected by lock */
+    struct aws_array_list free_buffers;
+};
+
+static void s_retained_body_buffer_destroy(struct aws_jni_retained_body_buffer *retained_buffer) {
+    struct aws_allocator *allocator = retained_buffer->pool->allocator;
+    aws_byte_buf_clean_up(&retained_buffer->buffer);
+    aws_mem_release(allocator, retained_buffer);
+}
+
+static void s_body_buffer_pool_destroy(void *user_data) {
+    struct aws_jni_body_buffer_pool *pool = user_data;
+
+    size_t free_count = aws_array_list_length(&pool->free_buffers);
+    for (size_t i = 0; i < free_count; ++i) {
+        struct aws_jni_retained_body_buffer *retained_buffer = NULL;
+        aws_array_list_get_at(&pool->free_buffers, &retained_buffer, i);
+        s_retained_body_buffer_destroy(retained_buffer);
+    }
+
+    aws_array_list_clean_up(&pool->free_buffers);
+    aws_mutex_clean_up(&pool->lock);
+    aws_mem_release(pool->allocator, pool);
+}
+
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_new(
+    struct aws_allocator *allocator,
+    size_t max_pooled_buffers) {
+
+    struct aws_jni_body_buffer_pool *pool = aws_mem_calloc(allocator, 1, sizeof(struct aws_jni_body_buffer_pool));
+    pool->allocator = allocator;
+    pool->max_pooled_buffers = max_pooled_buffers;
+    aws_ref_count_init(&pool->ref_count, pool, s_body_buffer_pool_destroy);
+
+    if (aws_mutex_init(&pool->lock)) {
+        goto on_error;
+    }
+
+    if (aws_array_list_init_dynamic(
+            &pool->free_buffers, allocator, max_pooled_buffers, sizeof(struct aws_jni_retained_body_buffer *))) {
+        aws_mutex_clean_up(&pool->lock);
+        goto on_error;
+    }
+
+    return pool;
+
+on_error:
+    aws_mem_release(allocator, pool);
+    return NULL;
+}
+
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_acquire(struct aws_jni_body_buffer_pool *pool) {
+    if (pool != NULL) {
+        aws_ref_count_acquire(&pool->ref_count);
+    }
+    return pool;
+}
+
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_release(struct aws_jni_body_buffer_pool *pool) {
+    if (pool != NULL) {
+        aws_ref_count_release(&pool->ref_count);
+    }
+    return NULL;
+}
+
+struct aws_jni_retained_body_buffer *aws_jni_body_buffer_pool_retain_copy(
+    struct aws_jni_body_buffer_pool *pool,
+    struct aws_byte_cursor data) {
+
+    struct aws_jni_retained_body_buffer *retained_buffer = NULL;
+
+    aws_mutex_lock(&pool->lock);
+    /* Most bodies arrive in part-sized chunks, so the most recently released buffer is usually big enough */
+    size_t free_count = aws_array_list_length(&pool->free_buffers);
+    for (size_t i = free_count; i > 0; --i) {
+        struct aws_jni_retained_body_buffer *candidate = NULL;
+        aws_array_list_get_at(&pool->free_buffers, &candidate, i - 1);
+        if (candidate->buffer.capacity >= data.len) {
+            aws_array_list_erase(&pool->free_buffers, i - 1);
+            retained_buffer = candidate;
+            break;
+        }
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    if (retained_buffer == NULL) {
+        retained_buffer = aws_mem_calloc(pool->allocator, 1, sizeof(struct aws_jni_retained_body_buffer));
+        if (aws_byte_buf_init(&retained_buffer->buffer, pool->allocator, data.len)) {
+            aws_mem_release(pool->allocator, retained_buffer);
+            return NULL;
+        }
+    }
+
+    retained_buffer->pool = aws_jni_body_buffer_pool_acquire(pool);
+    aws_byte_buf_reset(&retained_buffer->buffer, false);
+    aws_byte_buf_write_from_whole_cursor(&retained_buffer->buffer, data);
+
+    return retained_buffer;
+}
+
+void aws_jni_retained_body_buffer_release(struct aws_jni_retained_body_buffer *retained_buffer) {
+    if (retained_buffer == NULL) {
+        return;
+    }
+
+    struct aws_jni_body_buffer_pool *pool = retained_buffer->pool;
+    bool pooled = false;
+
+    aws_mutex_lock(&pool->lock);
+    if (aws_array_list_length(&pool->free_buffers) < pool->max_pooled_buffers) {
+        pooled = aws_array_list_push_back(&pool->free_buffers, &retained_buffer) == AWS_OP_SUCCESS;
+    }
+    aws_mutex_unlock(&pool->lock);
+
+    if (!pooled) {
+        s_retained_body_buffer_destroy(retained_buffer);
+    }
+
+    aws_jni_body_buffer_pool_release(pool);
+}
@@ -0,0 +1,51 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#ifndef AWS_JNI_CRT_BODY_BUFFER_POOL_H
+#define AWS_JNI_CRT_BODY_BUFFER_POOL_H
+
+#include <aws/common/byte_buf.h>
+
+struct aws_jni_body_buffer_pool;
+
+/*
+ * A native buffer holding a copy of response body data that Java has chosen to keep past the end of the body
+ * callback. The buffer holds a reference to the pool it came from, and goes back to that pool when released.
+ */
+struct aws_jni_retained_body_buffer {
+    struct aws_jni_body_buffer_pool *pool;
+    struct aws_byte_buf buffer;
+};
+
+/*******************************************************************************
+ * aws_jni_body_buffer_pool_new - Creates a ref-counted pool of native body buffers.
+ * At most max_pooled_buffers released buffers are kept around for reuse, the rest are freed.
+ ******************************************************************************/
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_new(
+    struct aws_allocator *allocator,
+    size_t max_pooled_buffers);
+
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_acquire(struct aws_jni_body_buffer_pool *pool);
+
+/*******************************************************************************
+ * aws_jni_body_buffer_pool_release - Drops a reference to the pool. Outstanding retained buffers keep the pool
+ * alive until they are released too. Always returns NULL.
+ ******************************************************************************/
+struct aws_jni_body_buffer_pool *aws_jni_body_buffer_pool_release(struct aws_jni_body_buffer_pool *pool);
+
+/*******************************************************************************
+ * aws_jni_body_buffer_pool_retain_copy - Copies data into a buffer taken from the pool (reusing a released buffer
+ * when one is large enough). Returns NULL and raises an error on failure.
+ ******************************************************************************/
+struct aws_jni_retained_body_buffer *aws_jni_body_buffer_pool_retain_copy(
+    struct aws_jni_body_buffer_pool *pool,
+    struct aws_byte_cursor data);
+
+/*******************************************************************************
+ * aws_jni_retained_body_buffer_release - Returns a retained buffer to its pool. Safe to call from any thread.
+ ******************************************************************************/
+void aws_jni_retained_body_buffer_release(struct aws_jni_retained_body_buffer *retained_buffer);
+
+#endif /* AWS_JNI_CRT_BODY_BUFFER_POOL_H */
@@ -13,26 +13,178 @@
  * Note: we use critical mem access in below functions to speed up checksums.
  * This approach is the same as what OpenJDK uses for their checksum implementation.
  * Think twice before using similar approach elsewhere as it can lead to stalling.
+ * To keep that stall bounded, large arrays are checksummed in chunks, re-entering the critical section for each.
  */
+#define CHECKSUM_CRITICAL_CHUNK_SIZE (1024 * 1024)
 
-jint crc32_common(
+typedef uint64_t(checksum_fn)(const uint8_t *input, size_t length, uint64_t previous);
+
+static uint64_t s_crc32(const uint8_t *input, size_t length, uint64_t previous) {
+    return aws_checksums_crc32_ex(input, length, (uint32_t)previous);
+}
+
+static uint64_t s_crc32c(const uint8_t *input, size_t length, uint64_t previous) {
+    return aws_checksums_crc32c_ex(input, length, (uint32_t)previous);
+}
+
+static uint64_t s_crc64nvme(const uint8_t *input, size_t length, uint64_t previous) {
+    return aws_checksums_crc64nvme_ex(input, length, previous);
+}
+
+static uint64_t s_checksum_array(
     JNIEnv *env,
     jbyteArray input,
-    jint previous,
-    const size_t start,
+    uint64_t previous,
+    size_t start,
     size_t length,
-    uint32_t (*checksum_fn)(const uint8_t *, size_t, uint32_t)) {
-    struct aws_byte_cursor c_byte_array = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, input);
-    if (AWS_UNLIKELY(c_byte_array.ptr == NULL)) {
+    checksum_fn *checksum) {
+
+    uint64_t result = previous;
+    do {
+        struct aws_byte_cursor c_byte_array = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, input);
+        if (AWS_UNLIKELY(c_byte_array.ptr == NULL)) {
+            return previous;
+        }
+
+        struct aws_byte_cursor cursor = c_byte_array;
+        aws_byte_cursor_advance(&cursor, start);
+        cursor.len = aws_min_size(aws_min_size(length, cursor.len), CHECKSUM_CRITICAL_CHUNK_SIZE);
+        result = checksum(cursor.ptr, cursor.len, result);
+        aws_jni_byte_cursor_from_jbyteArray_critical_release(env, input, c_byte_array);
+
+        if (cursor.len == 0) {
+            break;
+        }
+        start += cursor.len;
+        length -= cursor.len;
+    } while (length > 0);
+
+    return result;
+}
+
+static uint64_t s_checksum_direct_buffer(
+    JNIEnv *env,
+    jobject buffer,
+    uint64_t previous,
+    jint position,
+    jint length,
+    checksum_fn *checksum) {
+
+    if (buffer == NULL) {
+        aws_jni_throw_null_pointer_exception(env, "ByteBuffer is null");
+        return previous;
+    }
+
+    uint8_t *address = (*env)->GetDirectBufferAddress(env, buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, buffer);
+    if (address == NULL || capacity < 0) {
+        aws_jni_throw_illegal_argument_exception(env, "ByteBuffer is not a direct buffer");
+        return previous;
+    }
+    if (position < 0 || length < 0 || (jlong)position + length > capacity) {
+        aws_jni_throw_illegal_argument_exception(env, "ByteBuffer range is out of bounds");
+        return previous;
+    }
+
+    return checksum(address + position, (size_t)length, previous);
+}
+
+/* positions and lengths hold one entry per buffer, the whole scatter list is checksummed in order */
+static uint64_t s_checksum_direct_buffers(
+    JNIEnv *env,
+    jobjectArray buffers,
+    jintArray positions,
+    jintArray lengths,
+    uint64_t previous,
+    checksum_fn *checksum) {
+
+    if (buffers == NULL || positions == NULL || lengths == NULL) {
+        aws_jni_throw_null_pointer_exception(env, "ByteBuffer[] is null");
+        return previous;
+    }
+
+    jsize count = (*env)->GetArrayLength(env, buffers);
+    if ((*env)->GetArrayLength(env, positions) < count || (*env)->GetArrayLength(env, lengths) < count) {
+        aws_jni_throw_illegal_argument_exception(env, "ByteBuffer[] ranges are missing");
         return previous;
     }
 
-    struct aws_byte_cursor cursor = c_byte_array;
-    aws_byte_cursor_advance(&cursor, start);
-    cursor.len = aws_min_size(length, cursor.len);
-    jint res_signed = (jint)checksum_fn(cursor.ptr, cursor.len, previous);
-    aws_jni_byte_cursor_from_jbyteArray_critical_release(env, input, c_byte_array);
-    return res_signed;
+    jint *c_positions = (*env)->GetIntArrayElements(env, positions, NULL);
+    jint *c_lengths = (*env)->GetIntArrayElements(env, lengths, NULL);
+    uint64_t result = previous;
+    if (c_positions == NULL || c_lengths == NULL) {
+        aws_jni_throw_out_of_memory_exception(env, "failed to acquire ByteBuffer[] ranges");
+        goto done;
+    }
+
+    for (jsize i = 0; i < count; ++i) {
+        jobject buffer = (*env)->GetObjectArrayElement(env, buffers, i);
+        result = s_checksum_direct_buffer(env, buffer, result, c_positions[i], c_lengths[i], checksum);
+        (*env)->DeleteLocalRef(env, buffer);
+        if ((*env)->ExceptionCheck(env)) {
+            result = previous;
+            goto done;
+        }
+    }
+
+done:
+    if (c_positions != NULL) {
+        (*env)->ReleaseIntArrayElements(env, positions, c_positions, JNI_ABORT);
+    }
+    if (c_lengths != NULL) {
+        (*env)->ReleaseIntArrayElements(env, lengths, c_lengths, JNI_ABORT);
+    }
+    return result;
+}
+
+/*
+ * Combining two checksums, the same way zlib's crc32_combine() does. For these CRCs (reflected, all-ones initial
+ * value and final xor) crc(A || B) == crc(A) * x^(8 * len(B)) mod P xor crc(B), so only the lengths are needed, not
+ * the data. Polynomials and values are in reflected bit order, where x^0 is the top bit of the width.
+ */
+#define CRC32_POLY_REFLECTED 0xEDB88320ULL
+#define CRC32C_POLY_REFLECTED 0x82F63B78ULL
+#define CRC64NVME_POLY_REFLECTED 0x9A6C9329AC4BC9B5ULL
+
+/* a * b mod P, where a is a non-zero power of x */
+static uint64_t s_multiply_mod_poly(uint64_t a, uint64_t b, uint64_t poly, int width) {
+    uint64_t product = 0;
+    for (uint64_t m = (uint64_t)1 << (width - 1); m != 0; m >>= 1) {
+        if (a & m) {
+            product ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        b = (b & 1) ? (b >> 1) ^ poly : b >> 1;
+    }
+    return product;
+}
+
+/* x^(8 * length) mod P, by repeated squaring of x^8 */
+static uint64_t s_x_pow_8n_mod_poly(uint64_t length, uint64_t poly, int width) {
+    uint64_t result = (uint64_t)1 << (width - 1);
+    uint64_t square = result >> 8;
+    while (length != 0) {
+        if (length & 1) {
+            result = s_multiply_mod_poly(square, result, poly, width);
+        }
+        square = s_multiply_mod_poly(square, square, poly, width);
+        length >>= 1;
+    }
+    return result;
+}
+
+static uint64_t s_checksum_combine(uint64_t crc_a, uint64_t crc_b, uint64_t length_b, uint64_t poly, int width) {
+    return s_multiply_mod_poly(s_x_pow_8n_mod_poly(length_b, poly, width), crc_a, poly, width) ^ crc_b;
+}
+
+static bool s_validate_combine_length(JNIEnv *env, jlong length_b) {
+    if (length_b < 0) {
+        aws_jni_throw_illegal_argument_exception(env, "combine length must not be negative");
+        return false;
+    }
+    return true;
 }
 
 JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32_crc32(
@@ -45,7 +197,49 @@ JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32_crc32(
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    return crc32_common(env, input, previous, offset, length, aws_checksums_crc32_ex);
+    return (jint)s_checksum_array(env, input, (uint32_t)previous, offset, length, s_crc32);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32_crc32Direct(
+    JNIEnv *env,
+    jclass jni_class,
+    jobject input,
+    jint previous,
+    jint position,
+    jint length) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jint)s_checksum_direct_buffer(env, input, (uint32_t)previous, position, length, s_crc32);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32_crc32DirectArray(
+    JNIEnv *env,
+    jclass jni_class,
+    jobjectArray inputs,
+    jintArray positions,
+    jintArray lengths,
+    jint previous) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jint)s_checksum_direct_buffers(env, inputs, positions, lengths, (uint32_t)previous, s_crc32);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32_crc32Combine(
+    JNIEnv *env,
+    jclass jni_class,
+    jint crc_a,
+    jint crc_b,
+    jlong length_b) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    if (!s_validate_combine_length(env, length_b)) {
+        return crc_a;
+    }
+
+    return (jint)s_checksum_combine((uint32_t)crc_a, (uint32_t)crc_b, (uint64_t)length_b, CRC32_POLY_REFLECTED, 32);
 }
 
 JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32C_crc32c(
@@ -58,7 +252,49 @@ JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32C_crc32c(
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    return crc32_common(env, input, previous, offset, length, aws_checksums_crc32c_ex);
+    return (jint)s_checksum_array(env, input, (uint32_t)previous, offset, length, s_crc32c);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32C_crc32cDirect(
+    JNIEnv *env,
+    jclass jni_class,
+    jobject input,
+    jint previous,
+    jint position,
+    jint length) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jint)s_checksum_direct_buffer(env, input, (uint32_t)previous, position, length, s_crc32c);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32C_crc32cDirectArray(
+    JNIEnv *env,
+    jclass jni_class,
+    jobjectArray inputs,
+    jintArray positions,
+    jintArray lengths,
+    jint previous) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jint)s_checksum_direct_buffers(env, inputs, positions, lengths, (uint32_t)previous, s_crc32c);
+}
+
+JNIEXPORT jint JNICALL Java_software_amazon_awssdk_crt_checksums_CRC32C_crc32cCombine(
+    JNIEnv *env,
+    jclass jni_class,
+    jint crc_a,
+    jint crc_b,
+    jlong length_b) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    if (!s_validate_combine_length(env, length_b)) {
+        return crc_a;
+    }
+
+    return (jint)s_checksum_combine((uint32_t)crc_a, (uint32_t)crc_b, (uint64_t)length_b, CRC32C_POLY_REFLECTED, 32);
 }
 
 JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_checksums_CRC64NVME_crc64nvme(
@@ -71,15 +307,48 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_checksums_CRC64NVME_crc6
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_byte_cursor c_byte_array = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, input);
-    if (AWS_UNLIKELY(c_byte_array.ptr == NULL)) {
-        return previous;
+    return (jlong)s_checksum_array(env, input, (uint64_t)previous, offset, length, s_crc64nvme);
+}
+
+JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_checksums_CRC64NVME_crc64nvmeDirect(
+    JNIEnv *env,
+    jclass jni_class,
+    jobject input,
+    jlong previous,
+    jint position,
+    jint length) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jlong)s_checksum_direct_buffer(env, input, (uint64_t)previous, position, length, s_crc64nvme);
+}
+
+JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_checksums_CRC64NVME_crc64nvmeDirectArray(
+    JNIEnv *env,
+    jclass jni_class,
+    jobjectArray inputs,
+    jintArray positions,
+    jintArray lengths,
+    jlong previous) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    return (jlong)s_checksum_direct_buffers(env, inputs, positions, lengths, (uint64_t)previous, s_crc64nvme);
+}
+
+JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_checksums_CRC64NVME_crc64nvmeCombine(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong crc_a,
+    jlong crc_b,
+    jlong length_b) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    if (!s_validate_combine_length(env, length_b)) {
+        return crc_a;
     }
 
-    struct aws_byte_cursor cursor = c_byte_array;
-    aws_byte_cursor_advance(&cursor, offset);
-    cursor.len = aws_min_size(length, cursor.len);
-    jlong res_signed = (jlong)aws_checksums_crc64nvme_ex(cursor.ptr, cursor.len, previous);
-    aws_jni_byte_cursor_from_jbyteArray_critical_release(env, input, c_byte_array);
-    return res_signed;
+    return (jlong)s_checksum_combine(
+        (uint64_t)crc_a, (uint64_t)crc_b, (uint64_t)length_b, CRC64NVME_POLY_REFLECTED, 64);
 }
@@ -0,0 +1,539 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "crt.h"
+
+#include "aws_signing.h"
+#include "java_class_ids.h"
+#include "sigv4_signer.h"
+
+#include <jni.h>
+
+#include <aws/auth/signing_config.h>
+#include <aws/common/byte_buf.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+/*
+ * Signs an aws-chunked body one chunk at a time on the calling thread, keeping the rolling signature natively.
+ * Chunks are framed as:
+ *   <hex length>;chunk-signature=<signature>\r\n<data>\r\n
+ * and the body ends with an empty chunk, optionally followed by a signed trailer:
+ *   0;chunk-signature=<signature>\r\n[<name>:<value>\r\n ... x-amz-trailer-signature:<signature>\r\n]\r\n
+ */
+
+#define CHUNK_SIGNER_SIGNATURE_LENGTH 64
+
+static const struct aws_byte_cursor s_chunk_signature_prefix =
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(";chunk-signature=");
+static const struct aws_byte_cursor s_trailer_signature_prefix =
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-trailer-signature:");
+static const struct aws_byte_cursor s_crlf = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("\r\n");
+
+struct aws_jni_chunk_signer {
+    struct aws_allocator *allocator;
+    struct aws_signing_config_data config_data;
+    struct aws_signing_config_aws config;
+    struct aws_jni_sigv4_context context;
+    struct aws_jni_sigv4_scratch scratch;
+
+    /* Hex signature of whatever was signed last, the seed signature to begin with */
+    uint8_t previous_signature[CHUNK_SIGNER_SIGNATURE_LENGTH];
+};
+
+static void s_chunk_signer_destroy(JNIEnv *env, struct aws_jni_chunk_signer *signer) {
+    if (signer == NULL) {
+        return;
+    }
+
+    aws_jni_sigv4_scratch_clean_up(&signer->scratch);
+    aws_jni_sigv4_context_clean_up(&signer->context);
+    aws_signing_config_data_clean_up(&signer->config_data, env);
+    aws_mem_release(signer->allocator, signer);
+}
+
+/* Replaces the previous signature only once signing has succeeded, so a failure leaves the chain intact */
+static int s_chunk_signer_sign_chunk(struct aws_jni_chunk_signer *signer, struct aws_byte_cursor chunk) {
+    uint8_t signature_storage[CHUNK_SIGNER_SIGNATURE_LENGTH];
+    struct aws_byte_buf signature = aws_byte_buf_from_empty_array(signature_storage, sizeof(signature_storage));
+
+    if (aws_jni_sigv4_sign_chunk(
+            &signer->context,
+            &signer->scratch,
+            aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH),
+            chunk,
+            &signature)) {
+        return AWS_OP_ERR;
+    }
+
+    memcpy(signer->previous_signature, signature_storage, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_chunk_signer_sign_trailer(struct aws_jni_chunk_signer *signer, struct aws_byte_cursor marshalled_headers) {
+    uint8_t signature_storage[CHUNK_SIGNER_SIGNATURE_LENGTH];
+    struct aws_byte_buf signature = aws_byte_buf_from_empty_array(signature_storage, sizeof(signature_storage));
+
+    if (aws_jni_sigv4_sign_trailing_headers(
+            &signer->context,
+            &signer->scratch,
+            aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH),
+            marshalled_headers,
+            &signature)) {
+        return AWS_OP_ERR;
+    }
+
+    memcpy(signer->previous_signature, signature_storage, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    return AWS_OP_SUCCESS;
+}
+
+static size_t s_framed_chunk_length(size_t data_length) {
+    char hex_length[32];
+    int hex_digits = snprintf(hex_length, sizeof(hex_length), "%" PRIx64, (uint64_t)data_length);
+    return (size_t)hex_digits + s_chunk_signature_prefix.len + CHUNK_SIGNER_SIGNATURE_LENGTH + s_crlf.len +
+           data_length + s_crlf.len;
+}
+
+/* The marshalled headers are [be32 len][name][be32 len][value] */
+static int s_read_trailer_header(
+    struct aws_byte_cursor *marshalled_headers,
+    struct aws_byte_cursor *name,
+    struct aws_byte_cursor *value) {
+
+    uint32_t field_length = 0;
+    if (!aws_byte_cursor_read_be32(marshalled_headers, &field_length) || field_length > marshalled_headers->len) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    *name = aws_byte_cursor_advance(marshalled_headers, field_length);
+    if (!aws_byte_cursor_read_be32(marshalled_headers, &field_length) || field_length > marshalled_headers->len) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    *value = aws_byte_cursor_advance(marshalled_headers, field_length);
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Each trailer header goes out as "<name>:<value>\r\n". Headers with an empty name are skipped, as they are when
+ * marshalling and signing, and a trailer without any named headers isn't written at all.
+ */
+static int s_trailer_length(struct aws_byte_cursor marshalled_headers, size_t *length) {
+    *length = 0;
+
+    while (marshalled_headers.len > 0) {
+        struct aws_byte_cursor name;
+        struct aws_byte_cursor value;
+        if (s_read_trailer_header(&marshalled_headers, &name, &value)) {
+            return AWS_OP_ERR;
+        }
+        if (name.len > 0) {
+            *length += name.len + 1 + value.len + s_crlf.len;
+        }
+    }
+
+    if (*length > 0) {
+        *length += s_trailer_signature_prefix.len + CHUNK_SIGNER_SIGNATURE_LENGTH + s_crlf.len;
+    }
+    return AWS_OP_SUCCESS;
+}
+
+static int s_write_framed_chunk(
+    struct aws_jni_chunk_signer *signer,
+    struct aws_byte_cursor chunk,
+    struct aws_byte_buf *output) {
+
+    if (s_chunk_signer_sign_chunk(signer, chunk)) {
+        return AWS_OP_ERR;
+    }
+
+    char hex_length[32];
+    snprintf(hex_length, sizeof(hex_length), "%" PRIx64, (uint64_t)chunk.len);
+    struct aws_byte_cursor signature =
+        aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH);
+
+    /* The caller checked the output has room for all of it */
+    aws_byte_buf_write_from_whole_cursor(output, aws_byte_cursor_from_c_str(hex_length));
+    aws_byte_buf_write_from_whole_cursor(output, s_chunk_signature_prefix);
+    aws_byte_buf_write_from_whole_cursor(output, signature);
+    aws_byte_buf_write_from_whole_cursor(output, s_crlf);
+    aws_byte_buf_write_from_whole_cursor(output, chunk);
+    aws_byte_buf_write_from_whole_cursor(output, s_crlf);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_write_final_chunk(
+    struct aws_jni_chunk_signer *signer,
+    struct aws_byte_cursor marshalled_trailer,
+    size_t trailer_length,
+    struct aws_byte_buf *output) {
+
+    struct aws_byte_cursor empty_chunk;
+    AWS_ZERO_STRUCT(empty_chunk);
+    if (s_write_framed_chunk(signer, empty_chunk, output)) {
+        return AWS_OP_ERR;
+    }
+
+    if (trailer_length == 0) {
+        /* Without a trailer the empty chunk's own trailing CRLF ends the body */
+        return AWS_OP_SUCCESS;
+    }
+
+    /* With a trailer, it goes between the empty chunk's header and the final CRLF */
+    output->len -= s_crlf.len;
+
+    if (s_chunk_signer_sign_trailer(signer, marshalled_trailer)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Names go out lowercased, the way they were signed. The trailer was already validated by s_trailer_length */
+    while (marshalled_trailer.len > 0) {
+        struct aws_byte_cursor name;
+        struct aws_byte_cursor value;
+        s_read_trailer_header(&marshalled_trailer, &name, &value);
+        if (name.len == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < name.len; ++i) {
+            aws_byte_buf_write_u8(output, aws_ascii_tolower(name.ptr[i]));
+        }
+        aws_byte_buf_write_u8(output, ':');
+        aws_byte_buf_write_from_whole_cursor(output, value);
+        aws_byte_buf_write_from_whole_cursor(output, s_crlf);
+    }
+
+    aws_byte_buf_write_from_whole_cursor(output, s_trailer_signature_prefix);
+    aws_byte_buf_write_from_whole_cursor(
+        output, aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH));
+    aws_byte_buf_write_from_whole_cursor(output, s_crlf);
+    aws_byte_buf_write_from_whole_cursor(output, s_crlf);
+    return AWS_OP_SUCCESS;
+}
+
+static void s_throw_chunk_signer_exception(JNIEnv *env, const char *function_name) {
+    aws_jni_throw_runtime_exception(
+        env, "ChunkSigner.%s: signing failed: %s", function_name, aws_error_str(aws_last_error()));
+}
+
+/* Resolves an output range of a direct buffer, throwing if it isn't one or the range is out of bounds */
+static bool s_get_output_range(
+    JNIEnv *env,
+    jobject output_buffer,
+    jint output_offset,
+    jint output_length,
+    struct aws_byte_buf *output) {
+
+    uint8_t *address = (*env)->GetDirectBufferAddress(env, output_buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, output_buffer);
+    if (address == NULL || capacity < 0) {
+        aws_jni_throw_illegal_argument_exception(env, "ChunkSigner: output must be a direct ByteBuffer");
+        return false;
+    }
+    if (output_offset < 0 || output_length < 0 || (jlong)output_offset + output_length > capacity) {
+        aws_jni_throw_illegal_argument_exception(env, "ChunkSigner: output range is out of bounds");
+        return false;
+    }
+
+    *output = aws_byte_buf_from_empty_array(address + output_offset, (size_t)output_length);
+    return true;
+}
+
+/*
+ * Chunk data comes from either a direct buffer or an array, held critical. No JNI calls are allowed until it is
+ * released again, so every check that might throw happens before.
+ */
+struct chunk_data {
+    jbyteArray array;
+    struct aws_byte_cursor array_cursor;
+    struct aws_byte_cursor chunk;
+};
+
+static bool s_chunk_data_acquire(
+    JNIEnv *env,
+    jobject chunk_buffer,
+    jbyteArray chunk_array,
+    jint offset,
+    jint length,
+    struct chunk_data *data) {
+
+    AWS_ZERO_STRUCT(*data);
+    if (offset < 0 || length < 0) {
+        aws_jni_throw_illegal_argument_exception(env, "ChunkSigner: chunk range is out of bounds");
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+
+    struct aws_byte_cursor source;
+    if (chunk_array != NULL) {
+        if ((jlong)offset + length > (*env)->GetArrayLength(env, chunk_array)) {
+            aws_jni_throw_illegal_argument_exception(env, "ChunkSigner: chunk range is out of bounds");
+            return false;
+        }
+        data->array = chunk_array;
+        data->array_cursor = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, chunk_array);
+        source = data->array_cursor;
+    } else if (chunk_buffer != NULL) {
+        source = aws_jni_byte_cursor_from_direct_byte_buffer(env, chunk_buffer);
+        if (source.ptr != NULL && (jlong)offset + length > (jlong)source.len) {
+            aws_jni_throw_illegal_argument_exception(env, "ChunkSigner: chunk range is out of bounds");
+            return false;
+        }
+    } else {
+        aws_jni_throw_null_pointer_exception(env, "ChunkSigner: chunk is null");
+        return false;
+    }
+
+    if (source.ptr == NULL) {
+        /* the acquire helpers have thrown */
+        return false;
+    }
+
+    data->chunk = aws_byte_cursor_from_array(source.ptr + offset, (size_t)length);
+    return true;
+}
+
+static void s_chunk_data_release(JNIEnv *env, struct chunk_data *data) {
+    if (data->array_cursor.ptr != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_critical_release(env, data->array, data->array_cursor);
+    }
+    AWS_ZERO_STRUCT(*data);
+}
+
+JNIEXPORT
+jlong JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerNew(
+    JNIEnv *env,
+    jclass jni_class,
+    jobject java_signing_config,
+    jbyteArray seed_signature) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    struct aws_jni_chunk_signer *signer = aws_mem_calloc(allocator, 1, sizeof(struct aws_jni_chunk_signer));
+    signer->allocator = allocator;
+
+    if (aws_build_signing_config(env, java_signing_config, &signer->config_data, &signer->config)) {
+        aws_jni_throw_runtime_exception(env, "ChunkSigner.chunkSignerNew: failed to create signing configuration");
+        goto on_error;
+    }
+
+    if (aws_jni_sigv4_context_init(&signer->context, allocator, &signer->config)) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "ChunkSigner.chunkSignerNew: requires a SigV4 signing config with static credentials");
+        goto on_error;
+    }
+
+    if (aws_jni_sigv4_scratch_init(&signer->scratch, allocator)) {
+        aws_jni_throw_out_of_memory_exception(env, "ChunkSigner.chunkSignerNew: failed to allocate scratch space");
+        goto on_error;
+    }
+
+    struct aws_byte_cursor seed = aws_jni_byte_cursor_from_jbyteArray_acquire(env, seed_signature);
+    if (seed.ptr == NULL) {
+        goto on_error;
+    }
+    bool seed_valid = seed.len == CHUNK_SIGNER_SIGNATURE_LENGTH;
+    if (seed_valid) {
+        memcpy(signer->previous_signature, seed.ptr, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    }
+    aws_jni_byte_cursor_from_jbyteArray_release(env, seed_signature, seed);
+
+    if (!seed_valid) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "ChunkSigner.chunkSignerNew: seed signature must be a 64 character hex SigV4 signature");
+        goto on_error;
+    }
+
+    return (jlong)signer;
+
+on_error:
+    s_chunk_signer_destroy(env, signer);
+    return (jlong)NULL;
+}
+
+JNIEXPORT
+void JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerDestroy(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    s_chunk_signer_destroy(env, (struct aws_jni_chunk_signer *)signer_handle);
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerSignChunk(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle,
+    jobject chunk_buffer,
+    jbyteArray chunk_array,
+    jint offset,
+    jint length) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_chunk_signer *signer = (struct aws_jni_chunk_signer *)signer_handle;
+
+    struct chunk_data data;
+    if (!s_chunk_data_acquire(env, chunk_buffer, chunk_array, offset, length, &data)) {
+        return NULL;
+    }
+    int result = s_chunk_signer_sign_chunk(signer, data.chunk);
+    s_chunk_data_release(env, &data);
+
+    if (result) {
+        s_throw_chunk_signer_exception(env, "signChunk");
+        return NULL;
+    }
+
+    struct aws_byte_cursor signature =
+        aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    return aws_jni_byte_array_from_cursor(env, &signature);
+}
+
+JNIEXPORT
+jint JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerWriteChunk(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle,
+    jobject chunk_buffer,
+    jbyteArray chunk_array,
+    jint offset,
+    jint length,
+    jobject output_buffer,
+    jint output_offset,
+    jint output_length) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_chunk_signer *signer = (struct aws_jni_chunk_signer *)signer_handle;
+
+    struct aws_byte_buf output;
+    if (!s_get_output_range(env, output_buffer, output_offset, output_length, &output)) {
+        return 0;
+    }
+    if (length < 0 || s_framed_chunk_length((size_t)length) > output.capacity) {
+        aws_jni_throw_illegal_argument_exception(env, "ChunkSigner.writeChunk: output does not have enough room");
+        return 0;
+    }
+
+    struct chunk_data data;
+    if (!s_chunk_data_acquire(env, chunk_buffer, chunk_array, offset, length, &data)) {
+        return 0;
+    }
+    int result = s_write_framed_chunk(signer, data.chunk, &output);
+    s_chunk_data_release(env, &data);
+
+    if (result) {
+        s_throw_chunk_signer_exception(env, "writeChunk");
+        return 0;
+    }
+
+    return (jint)output.len;
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerSignTrailingHeaders(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle,
+    jbyteArray marshalled_headers) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_chunk_signer *signer = (struct aws_jni_chunk_signer *)signer_handle;
+
+    struct aws_byte_cursor headers = aws_jni_byte_cursor_from_jbyteArray_acquire(env, marshalled_headers);
+    if (headers.ptr == NULL) {
+        return NULL;
+    }
+    int result = s_chunk_signer_sign_trailer(signer, headers);
+    aws_jni_byte_cursor_from_jbyteArray_release(env, marshalled_headers, headers);
+
+    if (result) {
+        s_throw_chunk_signer_exception(env, "signTrailingHeaders");
+        return NULL;
+    }
+
+    struct aws_byte_cursor signature =
+        aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    return aws_jni_byte_array_from_cursor(env, &signature);
+}
+
+JNIEXPORT
+jint JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerWriteFinalChunk(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle,
+    jbyteArray marshalled_trailer,
+    jobject output_buffer,
+    jint output_offset,
+    jint output_length) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_chunk_signer *signer = (struct aws_jni_chunk_signer *)signer_handle;
+    jint written = 0;
+
+    struct aws_byte_buf output;
+    if (!s_get_output_range(env, output_buffer, output_offset, output_length, &output)) {
+        return 0;
+    }
+
+    struct aws_byte_cursor trailer;
+    AWS_ZERO_STRUCT(trailer);
+    if (marshalled_trailer != NULL) {
+        trailer = aws_jni_byte_cursor_from_jbyteArray_acquire(env, marshalled_trailer);
+        if (trailer.ptr == NULL) {
+            return 0;
+        }
+    }
+
+    size_t trailer_length = 0;
+    if (s_trailer_length(trailer, &trailer_length)) {
+        aws_jni_throw_illegal_argument_exception(env, "ChunkSigner.writeFinalChunk: malformed trailing headers");
+        goto done;
+    }
+    if (s_framed_chunk_length(0) + trailer_length > output.capacity) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "ChunkSigner.writeFinalChunk: output does not have enough room");
+        goto done;
+    }
+
+    if (s_write_final_chunk(signer, trailer, trailer_length, &output)) {
+        s_throw_chunk_signer_exception(env, "writeFinalChunk");
+        goto done;
+    }
+    written = (jint)output.len;
+
+done:
+    if (trailer.ptr != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_release(env, marshalled_trailer, trailer);
+    }
+    return written;
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_auth_signing_ChunkSigner_chunkSignerGetPreviousSignature(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong signer_handle) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_chunk_signer *signer = (struct aws_jni_chunk_signer *)signer_handle;
+    struct aws_byte_cursor signature =
+        aws_byte_cursor_from_array(signer->previous_signature, CHUNK_SIGNER_SIGNATURE_LENGTH);
+    return aws_jni_byte_array_from_cursor(env, &signature);
+}
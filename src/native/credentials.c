@@ -3,10 +3,12 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 
+#include "credentials.h"
 #include "crt.h"
 #include "java_class_ids.h"
 
 #include <aws/auth/credentials.h>
+#include <aws/common/mutex.h>
 
 /* on 32-bit platforms, casting pointers to longs throws a warning we don't need */
 #if UINTPTR_MAX == 0xffffffff
@@ -140,6 +142,126 @@ jobject aws_java_credentials_from_native_new(JNIEnv *env, const struct aws_crede
     return java_credentials;
 }
 
+/*
+ * Per-provider identity map between native credentials and the Java Credentials objects they were converted to or
+ * from. A provider tends to hand the same credentials across the boundary over and over, so rather than copying the
+ * keys and secret every time, recently seen native credentials map back to the same Java object and vice versa.
+ * Java Credentials copy their arrays in and out, so sharing one instance between callers is safe.
+ */
+
+int aws_jni_credentials_cache_init(struct aws_jni_credentials_cache *cache) {
+    AWS_ZERO_STRUCT(*cache);
+    return aws_mutex_init(&cache->lock);
+}
+
+static void s_credentials_cache_entry_clean_up(JNIEnv *env, struct aws_jni_credentials_cache_entry *entry) {
+    aws_credentials_release(entry->native_credentials);
+    if (entry->java_credentials != NULL) {
+        (*env)->DeleteWeakGlobalRef(env, entry->java_credentials);
+    }
+    AWS_ZERO_STRUCT(*entry);
+}
+
+void aws_jni_credentials_cache_clean_up(struct aws_jni_credentials_cache *cache, JNIEnv *env) {
+    for (size_t i = 0; i < AWS_JNI_CREDENTIALS_CACHE_SIZE; ++i) {
+        s_credentials_cache_entry_clean_up(env, &cache->entries[i]);
+    }
+    aws_mutex_clean_up(&cache->lock);
+}
+
+static void s_credentials_cache_put(
+    struct aws_jni_credentials_cache *cache,
+    JNIEnv *env,
+    struct aws_credentials *native_credentials,
+    jobject java_credentials) {
+
+    jweak weak_credentials = (*env)->NewWeakGlobalRef(env, java_credentials);
+    if (weak_credentials == NULL) {
+        aws_jni_check_and_clear_exception(env);
+        return;
+    }
+
+    aws_mutex_lock(&cache->lock);
+
+    /* Prefer a free slot, or one whose Java object has been collected, over the next round-robin victim */
+    struct aws_jni_credentials_cache_entry *slot = NULL;
+    for (size_t i = 0; i < AWS_JNI_CREDENTIALS_CACHE_SIZE; ++i) {
+        struct aws_jni_credentials_cache_entry *entry = &cache->entries[i];
+        if (entry->native_credentials == NULL || (*env)->IsSameObject(env, entry->java_credentials, NULL)) {
+            slot = entry;
+            break;
+        }
+    }
+    if (slot == NULL) {
+        slot = &cache->entries[cache->next_victim];
+        cache->next_victim = (cache->next_victim + 1) % AWS_JNI_CREDENTIALS_CACHE_SIZE;
+    }
+
+    s_credentials_cache_entry_clean_up(env, slot);
+    slot->native_credentials = aws_credentials_acquire(native_credentials);
+    slot->java_credentials = weak_credentials;
+
+    aws_mutex_unlock(&cache->lock);
+}
+
+struct aws_credentials *aws_jni_credentials_cache_to_native(
+    struct aws_jni_credentials_cache *cache,
+    JNIEnv *env,
+    jobject java_credentials) {
+
+    if (java_credentials == NULL) {
+        return NULL;
+    }
+
+    aws_mutex_lock(&cache->lock);
+    struct aws_credentials *native_credentials = NULL;
+    for (size_t i = 0; i < AWS_JNI_CREDENTIALS_CACHE_SIZE; ++i) {
+        struct aws_jni_credentials_cache_entry *entry = &cache->entries[i];
+        if (entry->native_credentials != NULL && (*env)->IsSameObject(env, entry->java_credentials, java_credentials)) {
+            native_credentials = aws_credentials_acquire(entry->native_credentials);
+            break;
+        }
+    }
+    aws_mutex_unlock(&cache->lock);
+
+    if (native_credentials == NULL) {
+        native_credentials = aws_credentials_new_from_java_credentials(env, java_credentials);
+        if (native_credentials != NULL) {
+            s_credentials_cache_put(cache, env, native_credentials, java_credentials);
+        }
+    }
+
+    return native_credentials;
+}
+
+jobject aws_jni_credentials_cache_to_java(
+    struct aws_jni_credentials_cache *cache,
+    JNIEnv *env,
+    const struct aws_credentials *credentials) {
+
+    aws_mutex_lock(&cache->lock);
+    jobject java_credentials = NULL;
+    for (size_t i = 0; i < AWS_JNI_CREDENTIALS_CACHE_SIZE; ++i) {
+        struct aws_jni_credentials_cache_entry *entry = &cache->entries[i];
+        if (entry->native_credentials == credentials) {
+            /* NULL if the Java object has been collected */
+            java_credentials = (*env)->NewLocalRef(env, entry->java_credentials);
+            break;
+        }
+    }
+    aws_mutex_unlock(&cache->lock);
+
+    if (java_credentials == NULL) {
+        java_credentials = aws_java_credentials_from_native_new(env, credentials);
+        if (java_credentials != NULL) {
+            /* The cache only takes a reference, it never modifies the credentials */
+            s_credentials_cache_put(cache, env, (struct aws_credentials *)credentials, java_credentials);
+        }
+    }
+
+    return java_credentials;
+}
+
 #if UINTPTR_MAX == 0xffffffff
 #    if defined(_MSC_VER)
 #        pragma warning(pop)
@@ -8,9 +8,41 @@
 
 #include <jni.h>
 
+#include <aws/common/mutex.h>
+
 struct aws_credentials;
 
 struct aws_credentials *aws_credentials_new_from_java_credentials(JNIEnv *env, jobject java_credentials);
 jobject aws_java_credentials_from_native_new(JNIEnv *env, const struct aws_credentials *credentials);
 
+#define AWS_JNI_CREDENTIALS_CACHE_SIZE 8
+
+/* Holds a reference on the native credentials and a weak reference on the Java object */
+struct aws_jni_credentials_cache_entry {
+    struct aws_credentials *native_credentials;
+    jweak java_credentials;
+};
+
+/* Identity map between native and Java credentials, owned by a credentials provider binding */
+struct aws_jni_credentials_cache {
+    struct aws_mutex lock;
+    struct aws_jni_credentials_cache_entry entries[AWS_JNI_CREDENTIALS_CACHE_SIZE];
+    size_t next_victim;
+};
+
+int aws_jni_credentials_cache_init(struct aws_jni_credentials_cache *cache);
+void aws_jni_credentials_cache_clean_up(struct aws_jni_credentials_cache *cache, JNIEnv *env);
+
+/* Like aws_credentials_new_from_java_credentials, but returns the cached native credentials for a known object */
+struct aws_credentials *aws_jni_credentials_cache_to_native(
+    struct aws_jni_credentials_cache *cache,
+    JNIEnv *env,
+    jobject java_credentials);
+
+/* Like aws_java_credentials_from_native_new, but returns the cached Java object for known native credentials */
+jobject aws_jni_credentials_cache_to_java(
+    struct aws_jni_credentials_cache *cache,
+    JNIEnv *env,
+    const struct aws_credentials *credentials);
+
 #endif /* AWS_JNI_CRT_CREDENTIALS_H */
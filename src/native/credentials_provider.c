@@ -14,6 +14,9 @@
 
 #include <aws/auth/credentials.h>
 #include <aws/common/clock.h>
+#include <aws/common/device_random.h>
+#include <aws/common/math.h>
+#include <aws/common/mutex.h>
 #include <aws/common/string.h>
 #include <aws/http/connection.h>
 #include <aws/http/proxy.h>
@@ -45,6 +48,9 @@ struct aws_credentials_provider_callback_data {
      * for this structure is called, hence the fatal assert below.
      */
     void *aux_data;
+
+    /* Credentials this provider handed across the boundary, so unchanged credentials keep the same objects */
+    struct aws_jni_credentials_cache credentials_cache;
 };
 
 static void s_callback_data_clean_up(
@@ -52,6 +58,10 @@ static void s_callback_data_clean_up(
     struct aws_allocator *allocator,
     struct aws_credentials_provider_callback_data *callback_data) {
 
+    if (callback_data == NULL) {
+        return;
+    }
+
     // any provider-specific auxiliary data should have been already cleaned up
     AWS_FATAL_ASSERT(callback_data->aux_data == NULL);
 
@@ -59,10 +69,25 @@ static void s_callback_data_clean_up(
     if (callback_data->jni_delegate_credential_handler != NULL) {
         (*env)->DeleteGlobalRef(env, callback_data->jni_delegate_credential_handler);
     }
+    aws_jni_credentials_cache_clean_up(&callback_data->credentials_cache, env);
 
     aws_mem_release(allocator, callback_data);
 }
 
+/* Allocates the binding's callback data. Throws and returns NULL if its credentials cache can't be set up. */
+static struct aws_credentials_provider_callback_data *s_callback_data_new(JNIEnv *env, struct aws_allocator *allocator) {
+    struct aws_credentials_provider_callback_data *callback_data =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+
+    if (aws_jni_credentials_cache_init(&callback_data->credentials_cache)) {
+        aws_mem_release(allocator, callback_data);
+        aws_jni_throw_runtime_exception(env, "Failed to initialize the credentials provider's credentials cache");
+        return NULL;
+    }
+
+    return callback_data;
+}
+
 static void s_on_shutdown_complete(void *user_data) {
     struct aws_credentials_provider_callback_data *callback_data = user_data;
 
@@ -108,8 +133,10 @@ JNIEXPORT jlong JNICALL
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
 
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -155,8 +182,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -195,8 +224,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -262,8 +293,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -328,8 +361,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -387,8 +422,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -436,8 +473,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
@@ -504,12 +543,286 @@ JNIEXPORT jlong JNICALL
     return (jlong)provider;
 }
 
+/*
+ * Cached provider that refreshes ahead of expiry. aws_credentials_provider_new_cached() only goes back to its source
+ * once the cached credentials have expired, so every caller that arrives during that fetch waits on it. This one
+ * starts the fetch a configurable (and jittered) time before expiry, triggered by the first caller in that window,
+ * and keeps handing out the current credentials until the new ones arrive. Callers only wait when there are no
+ * usable credentials at all. Each new set of credentials is also pushed up to the Java provider along with its refresh
+ * time, so getCredentialsNow() can serve them without a native call and still start the refresh when it is due.
+ */
+struct aws_refreshing_credentials_waiter {
+    aws_on_get_credentials_callback_fn *callback;
+    void *user_data;
+};
+
+struct aws_refreshing_credentials {
+    struct aws_allocator *allocator;
+    struct aws_credentials_provider *source;
+    /* The delegate provider this is the implementation of, kept alive by an in-flight refresh */
+    struct aws_credentials_provider *provider;
+    uint64_t cache_duration_ns;
+    uint64_t refresh_before_expiry_ns;
+    uint64_t refresh_jitter_ns;
+
+    struct aws_mutex lock;
+    /* Everything below is protected by lock */
+    struct aws_credentials *credentials;
+    uint64_t expires_at_ns;
+    uint64_t refresh_at_ns;
+    bool refresh_in_flight;
+    struct aws_array_list waiters;
+};
+
+static void s_refreshing_credentials_destroy(struct aws_refreshing_credentials *impl) {
+    if (impl == NULL) {
+        return;
+    }
+
+    AWS_FATAL_ASSERT(aws_array_list_length(&impl->waiters) == 0);
+
+    aws_credentials_release(impl->credentials);
+    aws_credentials_provider_release(impl->source);
+    aws_array_list_clean_up(&impl->waiters);
+    aws_mutex_clean_up(&impl->lock);
+    aws_mem_release(impl->allocator, impl);
+}
+
+static void s_on_refreshing_credentials_shutdown_complete(void *user_data) {
+    struct aws_credentials_provider_callback_data *callback_data = user_data;
+
+    s_refreshing_credentials_destroy(callback_data->aux_data);
+    callback_data->aux_data = NULL;
+
+    s_on_shutdown_complete(callback_data);
+}
+
+/* When to start refreshing credentials that expire at expires_at_ns */
+static uint64_t s_refreshing_credentials_refresh_time(
+    const struct aws_refreshing_credentials *impl,
+    uint64_t now_ns,
+    uint64_t expires_at_ns) {
+
+    uint64_t lead_ns = impl->refresh_before_expiry_ns;
+    if (impl->refresh_jitter_ns > 0) {
+        uint64_t random = 0;
+        if (aws_device_random_u64(&random) == AWS_OP_SUCCESS) {
+            lead_ns = aws_add_u64_saturating(lead_ns, random % (impl->refresh_jitter_ns + 1));
+        }
+    }
+
+    uint64_t lifetime_ns = expires_at_ns - now_ns;
+    if (lead_ns >= lifetime_ns) {
+        /* Credentials that don't live much longer than the lead time would otherwise be refreshed on every call */
+        return now_ns + lifetime_ns / 2;
+    }
+
+    return expires_at_ns - lead_ns;
+}
+
+static void s_refreshing_credentials_notify_java(
+    struct aws_credentials_provider_callback_data *callback_data,
+    struct aws_credentials *credentials,
+    uint64_t expires_at_ns,
+    uint64_t refresh_at_ns) {
+
+    /********** JNI ENV ACQUIRE **********/
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(callback_data->jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env == NULL) {
+        /* If we can't get an environment, then the JVM is probably shutting down.  Don't crash. */
+        return;
+    }
+
+    jobject java_credentials = aws_jni_credentials_cache_to_java(&callback_data->credentials_cache, env, credentials);
+    if (java_credentials != NULL) {
+        (*env)->CallVoidMethod(
+            env,
+            callback_data->java_crt_credentials_provider,
+            cached_credentials_provider_properties.on_credentials_refreshed_method_id,
+            java_credentials,
+            (jlong)aws_timestamp_convert(expires_at_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL),
+            (jlong)aws_timestamp_convert(refresh_at_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL));
+        (*env)->DeleteLocalRef(env, java_credentials);
+    }
+
+    /* A missed snapshot update only means Java callers fall back to getCredentials() */
+    aws_jni_check_and_clear_exception(env);
+
+    aws_jni_release_thread_env(callback_data->jvm, &jvm_env_context);
+    /********** JNI ENV RELEASE **********/
+}
+
+static void s_on_refreshing_credentials_sourced(struct aws_credentials *credentials, int error_code, void *user_data) {
+    struct aws_credentials_provider_callback_data *callback_data = user_data;
+    struct aws_refreshing_credentials *impl = callback_data->aux_data;
+
+    uint64_t now_ns = 0;
+    aws_sys_clock_get_ticks(&now_ns);
+
+    struct aws_array_list waiters;
+    aws_array_list_init_dynamic(&waiters, impl->allocator, 0, sizeof(struct aws_refreshing_credentials_waiter));
+
+    uint64_t expires_at_ns = 0;
+    uint64_t refresh_at_ns = 0;
+
+    aws_mutex_lock(&impl->lock);
+    if (credentials != NULL) {
+        expires_at_ns = impl->cache_duration_ns > 0 ? aws_add_u64_saturating(now_ns, impl->cache_duration_ns)
+                                                     : UINT64_MAX;
+        uint64_t expiration_secs = aws_credentials_get_expiration_timepoint_seconds(credentials);
+        if (expiration_secs != UINT64_MAX) {
+            uint64_t expiration_ns =
+                aws_timestamp_convert(expiration_secs, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+            expires_at_ns = aws_min_u64(expires_at_ns, expiration_ns);
+        }
+
+        aws_credentials_acquire(credentials);
+        aws_credentials_release(impl->credentials);
+        impl->credentials = credentials;
+        impl->expires_at_ns = expires_at_ns;
+        impl->refresh_at_ns = expires_at_ns > now_ns
+                                  ? s_refreshing_credentials_refresh_time(impl, now_ns, expires_at_ns)
+                                  : now_ns;
+        refresh_at_ns = impl->refresh_at_ns;
+    } else if (impl->credentials != NULL && now_ns < impl->expires_at_ns) {
+        /* Keep serving what we have, and back off halfway to expiry rather than retrying on every call */
+        impl->refresh_at_ns = now_ns + (impl->expires_at_ns - now_ns) / 2;
+    }
+    impl->refresh_in_flight = false;
+    aws_array_list_swap_contents(&waiters, &impl->waiters);
+    aws_mutex_unlock(&impl->lock);
+
+    if (credentials == NULL && error_code == AWS_ERROR_SUCCESS) {
+        error_code = AWS_AUTH_CREDENTIALS_PROVIDER_SOURCE_FAILURE;
+    }
+
+    size_t waiter_count = aws_array_list_length(&waiters);
+    for (size_t i = 0; i < waiter_count; ++i) {
+        struct aws_refreshing_credentials_waiter *waiter = NULL;
+        aws_array_list_get_at_ptr(&waiters, (void **)&waiter, i);
+        waiter->callback(credentials, credentials != NULL ? AWS_ERROR_SUCCESS : error_code, waiter->user_data);
+    }
+    aws_array_list_clean_up(&waiters);
+
+    if (credentials != NULL) {
+        s_refreshing_credentials_notify_java(callback_data, credentials, expires_at_ns, refresh_at_ns);
+    }
+
+    /* Taken when the refresh started, this may be the last reference and destroy impl */
+    aws_credentials_provider_release(impl->provider);
+}
+
+static int s_refreshing_credentials_get_credentials(
+    void *delegate_user_data,
+    aws_on_get_credentials_callback_fn callback,
+    void *callback_user_data) {
+
+    struct aws_credentials_provider_callback_data *callback_data = delegate_user_data;
+    struct aws_refreshing_credentials *impl = callback_data->aux_data;
+
+    uint64_t now_ns = 0;
+    aws_sys_clock_get_ticks(&now_ns);
+
+    struct aws_credentials *current = NULL;
+    bool start_refresh = false;
+    int result = AWS_OP_SUCCESS;
+
+    aws_mutex_lock(&impl->lock);
+    if (impl->credentials != NULL && now_ns < impl->expires_at_ns) {
+        current = impl->credentials;
+        aws_credentials_acquire(current);
+        start_refresh = now_ns >= impl->refresh_at_ns && !impl->refresh_in_flight;
+    } else {
+        struct aws_refreshing_credentials_waiter waiter = {
+            .callback = callback,
+            .user_data = callback_user_data,
+        };
+        if (aws_array_list_push_back(&impl->waiters, &waiter)) {
+            result = AWS_OP_ERR;
+        } else {
+            start_refresh = !impl->refresh_in_flight;
+        }
+    }
+    if (start_refresh) {
+        impl->refresh_in_flight = true;
+    }
+    aws_mutex_unlock(&impl->lock);
+
+    if (current != NULL) {
+        callback(current, AWS_ERROR_SUCCESS, callback_user_data);
+        aws_credentials_release(current);
+    }
+
+    if (start_refresh) {
+        aws_credentials_provider_acquire(impl->provider);
+        if (aws_credentials_provider_get_credentials(
+                impl->source, s_on_refreshing_credentials_sourced, callback_data)) {
+            s_on_refreshing_credentials_sourced(NULL, aws_last_error(), callback_data);
+        }
+    }
+
+    return result;
+}
+
+static struct aws_credentials_provider *s_refreshing_credentials_provider_new(
+    struct aws_allocator *allocator,
+    struct aws_credentials_provider_callback_data *callback_data,
+    struct aws_credentials_provider *source,
+    uint64_t cache_duration_ns,
+    uint64_t refresh_before_expiry_ns,
+    uint64_t refresh_jitter_ns) {
+
+    struct aws_refreshing_credentials *impl = aws_mem_calloc(allocator, 1, sizeof(struct aws_refreshing_credentials));
+    impl->allocator = allocator;
+    impl->cache_duration_ns = cache_duration_ns;
+    impl->refresh_before_expiry_ns = refresh_before_expiry_ns;
+    impl->refresh_jitter_ns = refresh_jitter_ns;
+
+    if (aws_mutex_init(&impl->lock)) {
+        aws_mem_release(allocator, impl);
+        return NULL;
+    }
+
+    if (aws_array_list_init_dynamic(
+            &impl->waiters, allocator, 4, sizeof(struct aws_refreshing_credentials_waiter))) {
+        aws_mutex_clean_up(&impl->lock);
+        aws_mem_release(allocator, impl);
+        return NULL;
+    }
+
+    impl->source = aws_credentials_provider_acquire(source);
+    callback_data->aux_data = impl;
+
+    struct aws_credentials_provider_delegate_options options = {
+        .get_credentials = s_refreshing_credentials_get_credentials,
+        .delegate_user_data = callback_data,
+        .shutdown_options =
+            {
+                .shutdown_callback = s_on_refreshing_credentials_shutdown_complete,
+                .shutdown_user_data = callback_data,
+            },
+    };
+
+    struct aws_credentials_provider *provider = aws_credentials_provider_new_delegate(allocator, &options);
+    if (provider == NULL) {
+        s_refreshing_credentials_destroy(impl);
+        callback_data->aux_data = NULL;
+        return NULL;
+    }
+
+    impl->provider = provider;
+    return provider;
+}
+
 JNIEXPORT jlong JNICALL
     Java_software_amazon_awssdk_crt_auth_credentials_CachedCredentialsProvider_cachedCredentialsProviderNew(
         JNIEnv *env,
         jclass jni_class,
         jobject java_crt_credentials_provider,
         jint cached_duration_in_seconds,
+        jint refresh_before_expiry_in_seconds,
+        jint refresh_jitter_in_seconds,
         jlong native_cached_provider) {
 
     (void)jni_class;
@@ -521,25 +834,45 @@ JNIEXPORT jlong JNICALL
         return 0;
     }
 
+    if (cached_duration_in_seconds < 0 || refresh_before_expiry_in_seconds < 0 || refresh_jitter_in_seconds < 0) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "CachedCredentialsProvider.cachedCredentialsProviderNew: durations must not be negative");
+        return 0;
+    }
+
     struct aws_allocator *allocator = aws_jni_get_allocator();
 
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
     AWS_FATAL_ASSERT(jvmresult == 0);
 
-    struct aws_credentials_provider_cached_options options;
-    AWS_ZERO_STRUCT(options);
-    options.refresh_time_in_milliseconds =
-        aws_timestamp_convert(cached_duration_in_seconds, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_MILLIS, NULL);
-    options.source = (struct aws_credentials_provider *)native_cached_provider;
+    struct aws_credentials_provider *provider = NULL;
+    if (refresh_before_expiry_in_seconds > 0 || refresh_jitter_in_seconds > 0) {
+        provider = s_refreshing_credentials_provider_new(
+            allocator,
+            callback_data,
+            (struct aws_credentials_provider *)native_cached_provider,
+            aws_timestamp_convert(cached_duration_in_seconds, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL),
+            aws_timestamp_convert(refresh_before_expiry_in_seconds, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL),
+            aws_timestamp_convert(refresh_jitter_in_seconds, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL));
+    } else {
+        struct aws_credentials_provider_cached_options options;
+        AWS_ZERO_STRUCT(options);
+        options.refresh_time_in_milliseconds =
+            aws_timestamp_convert(cached_duration_in_seconds, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_MILLIS, NULL);
+        options.source = (struct aws_credentials_provider *)native_cached_provider;
 
-    options.shutdown_options.shutdown_callback = s_on_shutdown_complete;
-    options.shutdown_options.shutdown_user_data = callback_data;
+        options.shutdown_options.shutdown_callback = s_on_shutdown_complete;
+        options.shutdown_options.shutdown_user_data = callback_data;
+
+        provider = aws_credentials_provider_new_cached(allocator, &options);
+    }
 
-    struct aws_credentials_provider *provider = aws_credentials_provider_new_cached(allocator, &options);
     if (provider == NULL) {
         s_callback_data_clean_up(env, allocator, callback_data);
         aws_jni_throw_runtime_exception(env, "Failed to create cached credentials provider");
@@ -577,7 +910,8 @@ static int s_credentials_provider_delegate_get_credentials(
         goto done;
     }
 
-    struct aws_credentials *native_credentials = aws_credentials_new_from_java_credentials(env, java_credentials);
+    struct aws_credentials *native_credentials =
+        aws_jni_credentials_cache_to_native(&callback_data->credentials_cache, env, java_credentials);
     if (!native_credentials) {
         aws_jni_throw_runtime_exception(env, "Failed to create native credentials");
         // error has been raised from creating function
@@ -609,8 +943,10 @@ JNIEXPORT jlong JNICALL
     aws_cache_jni_ids(env);
 
     struct aws_allocator *allocator = aws_jni_get_allocator();
-    struct aws_credentials_provider_callback_data *callback_data =
-        aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    struct aws_credentials_provider_callback_data *callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        return (jlong)NULL;
+    }
     callback_data->java_crt_credentials_provider = (*env)->NewGlobalRef(env, java_crt_credentials_provider);
     callback_data->jni_delegate_credential_handler = (*env)->NewGlobalRef(env, jni_delegate_credential_handler);
 
@@ -973,7 +1309,10 @@ jlong JNICALL Java_software_amazon_awssdk_crt_auth_credentials_CognitoCredential
     endpoint_cursor = aws_jni_byte_cursor_from_jstring_acquire(env, endpoint);
     identity_cursor = aws_jni_byte_cursor_from_jstring_acquire(env, identity);
 
-    callback_data = aws_mem_calloc(allocator, 1, sizeof(struct aws_credentials_provider_callback_data));
+    callback_data = s_callback_data_new(env, allocator);
+    if (callback_data == NULL) {
+        goto done;
+    }
 
     jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
     AWS_FATAL_ASSERT(jvmresult == 0);
@@ -1050,7 +1389,9 @@ done:
 
     if (provider == NULL) {
         s_callback_data_clean_up(env, allocator, callback_data);
-        aws_jni_throw_runtime_exception(env, "Failed to create native cognito credentials provider");
+        if (!(*env)->ExceptionCheck(env)) {
+            aws_jni_throw_runtime_exception(env, "Failed to create native cognito credentials provider");
+        }
     }
 
     return (jlong)provider;
@@ -1099,6 +1440,20 @@ static void s_cp_callback_data_clean_up(
     aws_mem_release(aws_jni_get_allocator(), callback_data);
 }
 
+/* Every provider created by these bindings carries its binding as its shutdown user data */
+static struct aws_credentials_provider_callback_data *s_callback_data_from_provider(
+    struct aws_credentials_provider *provider) {
+
+    aws_simple_completion_callback *shutdown_callback = provider->shutdown_options.shutdown_callback;
+    if (shutdown_callback != s_on_shutdown_complete &&
+        shutdown_callback != s_on_refreshing_credentials_shutdown_complete &&
+        shutdown_callback != s_on_cognito_shutdown_complete) {
+        return NULL;
+    }
+
+    return provider->shutdown_options.shutdown_user_data;
+}
+
 static void s_on_get_credentials_callback(struct aws_credentials *credentials, int error_code, void *user_data) {
     (void)error_code;
 
@@ -1115,7 +1470,12 @@ static void s_on_get_credentials_callback(struct aws_credentials *credentials, i
     jobject java_credentials = NULL;
 
     if (credentials) {
-        java_credentials = aws_java_credentials_from_native_new(env, credentials);
+        /* The provider binding outlives this call, which holds a reference on the provider */
+        struct aws_credentials_provider_callback_data *provider_data =
+            s_callback_data_from_provider(callback_data->provider);
+        java_credentials = provider_data != NULL
+                               ? aws_jni_credentials_cache_to_java(&provider_data->credentials_cache, env, credentials)
+                               : aws_java_credentials_from_native_new(env, credentials);
     }
 
     (*env)->CallVoidMethod(
@@ -5,11 +5,15 @@
 
 #include <aws/auth/auth.h>
 #include <aws/common/allocator.h>
+#include <aws/common/array_list.h>
 #include <aws/common/atomics.h>
 #include <aws/common/clock.h>
 #include <aws/common/common.h>
 #include <aws/common/hash_table.h>
+#include <aws/common/linked_list.h>
 #include <aws/common/logging.h>
+#include <aws/common/mutex.h>
+#include <aws/common/ref_count.h>
 #include <aws/common/rw_lock.h>
 #include <aws/common/string.h>
 #include <aws/common/system_info.h>
@@ -27,6 +31,7 @@
 #include "crt.h"
 #include "java_class_ids.h"
 #include "logging.h"
+#include "sigv4_signer.h"
 #include <stdio.h>
 
 #ifdef AWS_OS_LINUX
@@ -63,10 +68,15 @@ void aws_jni_set_dispatch_queue_threads(bool is_dispatch_queue) {
     s_dispatch_queue_threads = is_dispatch_queue;
 }
 
+static void s_thread_env_cache_destroy(void);
+
 static void s_detach_jvm_from_thread(void *user_data) {
     AWS_LOGF_DEBUG(AWS_LS_COMMON_GENERAL, "s_detach_jvm_from_thread invoked");
     JavaVM *jvm = user_data;
 
+    /* Drop the cached env first so the acquire below goes through the JVM table */
+    s_thread_env_cache_destroy();
+
     /* we don't need this JNIEnv, but this is an easy way to verify the JVM is still valid to use */
     /********** JNI ENV ACQUIRE **********/
     struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
@@ -164,6 +174,173 @@ read locks on a shared rw lock.  Only when the JVM shutdown hook calls into nati
 static struct aws_rw_lock s_jvm_table_lock = AWS_RW_LOCK_INIT;
 static struct aws_hash_table *s_jvms = NULL;
 
+/*
+Even an uncontended read lock is a shared cache line that every event loop thread writes to on every callback, which
+shows up on machines with many cores.  So threads that we attached to the JVM ourselves (event loop threads, which are
+where nearly all callbacks come from) cache their JNIEnv, and use it without touching the JVM table lock.
+
+The cache is validated against a generation counter that is bumped whenever the JVM table changes.  A cached acquire
+publishes itself in a per-thread depth counter and then re-checks the generation; the JVM shutdown hook bumps the
+generation and then waits for every thread's depth counter to drain.  Since both sides write then read with sequential
+consistency, either the acquire sees the new generation (and falls back to the locked path, which fails), or the
+shutdown hook sees the acquire and waits for its release, which gives us the same guarantee as the read lock.
+
+The shutdown hook must not hold s_thread_env_caches_lock while it waits: exiting threads take that lock to destroy
+their cache, and one of them may be what the callback being waited on is waiting for.  So it takes a reference to each
+cache under the lock and waits after releasing it; a cache is freed once its thread and any waiter are done with it.
+ */
+#define THREAD_ENV_CACHE_LINE_SIZE 64
+#define THREAD_ENV_CACHE_DRAIN_SLEEP_NS (1000 * 1000)
+
+struct aws_jni_thread_env_cache {
+    /* Only written by the owning thread */
+    JavaVM *jvm;
+    JNIEnv *env;
+    size_t generation;
+
+    struct aws_linked_list_node node;
+
+    /* Held by the owning thread, and by the JVM shutdown hook while it waits on acquire_depth */
+    struct aws_ref_count ref_count;
+
+    /* Outstanding cached acquires on the owning thread, read by the JVM shutdown hook */
+    struct aws_atomic_var acquire_depth;
+
+    /* Keep each thread's depth counter on its own cache line */
+    uint8_t padding[THREAD_ENV_CACHE_LINE_SIZE];
+};
+
+static struct aws_atomic_var s_jvm_generation = AWS_ATOMIC_INIT_INT(1);
+
+static struct aws_mutex s_thread_env_caches_lock = AWS_MUTEX_INIT;
+static struct aws_linked_list s_thread_env_caches;
+static bool s_thread_env_caches_initialized = false;
+
+static AWS_THREAD_LOCAL struct aws_jni_thread_env_cache *tl_thread_env_cache = NULL;
+
+static void s_thread_env_cache_on_zero_refs(void *user_data) {
+    struct aws_jni_thread_env_cache *cache = user_data;
+    aws_mem_release(aws_default_allocator(), cache);
+}
+
+/* Must be called while holding a read lock on the JVM table, so the generation can't change underneath us */
+static void s_thread_env_cache_update(JavaVM *jvm, JNIEnv *env) {
+    struct aws_jni_thread_env_cache *cache = tl_thread_env_cache;
+    if (cache == NULL) {
+        /* use default allocator so that tracing allocator doesn't flag this as a leak during tests */
+        cache = aws_mem_calloc(aws_default_allocator(), 1, sizeof(struct aws_jni_thread_env_cache));
+        aws_atomic_init_int(&cache->acquire_depth, 0);
+        aws_ref_count_init(&cache->ref_count, cache, s_thread_env_cache_on_zero_refs);
+
+        aws_mutex_lock(&s_thread_env_caches_lock);
+        if (!s_thread_env_caches_initialized) {
+            aws_linked_list_init(&s_thread_env_caches);
+            s_thread_env_caches_initialized = true;
+        }
+        aws_linked_list_push_back(&s_thread_env_caches, &cache->node);
+        aws_mutex_unlock(&s_thread_env_caches_lock);
+
+        tl_thread_env_cache = cache;
+    }
+
+    cache->jvm = jvm;
+    cache->env = env;
+    cache->generation = aws_atomic_load_int(&s_jvm_generation);
+}
+
+static void s_thread_env_cache_destroy(void) {
+    struct aws_jni_thread_env_cache *cache = tl_thread_env_cache;
+    if (cache == NULL) {
+        return;
+    }
+
+    tl_thread_env_cache = NULL;
+
+    aws_mutex_lock(&s_thread_env_caches_lock);
+    aws_linked_list_remove(&cache->node);
+    aws_mutex_unlock(&s_thread_env_caches_lock);
+
+    aws_ref_count_release(&cache->ref_count);
+}
+
+static bool s_thread_env_cache_try_acquire(JavaVM *jvm, struct aws_jvm_env_context *jvm_env_context) {
+    struct aws_jni_thread_env_cache *cache = tl_thread_env_cache;
+    if (cache == NULL || cache->jvm != jvm) {
+        return false;
+    }
+
+    size_t depth = aws_atomic_load_int(&cache->acquire_depth);
+    aws_atomic_store_int(&cache->acquire_depth, depth + 1);
+
+    /* Re-check after publishing the acquire, pairs with the generation bump in s_jvm_table_remove_jvm_for_env */
+    if (aws_atomic_load_int(&s_jvm_generation) != cache->generation) {
+        aws_atomic_store_int(&cache->acquire_depth, depth);
+        return false;
+    }
+
+    jvm_env_context->env = cache->env;
+    jvm_env_context->from_thread_cache = true;
+    return true;
+}
+
+static void s_thread_env_cache_release(void) {
+    struct aws_jni_thread_env_cache *cache = tl_thread_env_cache;
+    AWS_FATAL_ASSERT(cache != NULL);
+
+    size_t depth = aws_atomic_load_int(&cache->acquire_depth);
+    AWS_FATAL_ASSERT(depth > 0);
+    aws_atomic_store_int(&cache->acquire_depth, depth - 1);
+}
+
+/* Must be called while holding the write lock on the JVM table */
+static void s_thread_env_caches_invalidate(void) {
+    aws_atomic_fetch_add(&s_jvm_generation, 1);
+
+    /* Snapshot the caches, so threads can still exit and destroy theirs while we wait */
+    struct aws_array_list caches;
+    AWS_ZERO_STRUCT(caches);
+
+    aws_mutex_lock(&s_thread_env_caches_lock);
+    if (s_thread_env_caches_initialized) {
+        size_t cache_count = 0;
+        for (struct aws_linked_list_node *node = aws_linked_list_begin(&s_thread_env_caches);
+             node != aws_linked_list_end(&s_thread_env_caches);
+             node = aws_linked_list_next(node)) {
+            ++cache_count;
+        }
+
+        aws_array_list_init_dynamic(
+            &caches, aws_default_allocator(), cache_count, sizeof(struct aws_jni_thread_env_cache *));
+        for (struct aws_linked_list_node *node = aws_linked_list_begin(&s_thread_env_caches);
+             node != aws_linked_list_end(&s_thread_env_caches);
+             node = aws_linked_list_next(node)) {
+            struct aws_jni_thread_env_cache *cache = AWS_CONTAINER_OF(node, struct aws_jni_thread_env_cache, node);
+            if (cache == tl_thread_env_cache) {
+                continue;
+            }
+
+            aws_ref_count_acquire(&cache->ref_count);
+            aws_array_list_push_back(&caches, &cache);
+        }
+    }
+    aws_mutex_unlock(&s_thread_env_caches_lock);
+
+    size_t cache_count = aws_array_list_length(&caches);
+    for (size_t i = 0; i < cache_count; ++i) {
+        struct aws_jni_thread_env_cache *cache = NULL;
+        aws_array_list_get_at(&caches, &cache, i);
+
+        /* Same as waiting for outstanding read locks to be released */
+        while (aws_atomic_load_int(&cache->acquire_depth) > 0) {
+            aws_thread_current_sleep(THREAD_ENV_CACHE_DRAIN_SLEEP_NS);
+        }
+
+        aws_ref_count_release(&cache->ref_count);
+    }
+
+    aws_array_list_clean_up(&caches);
+}
+
 static void s_jvm_table_add_jvm_for_env(JNIEnv *env) {
     aws_rw_lock_wlock(&s_jvm_table_lock);
 
@@ -183,6 +360,8 @@ static void s_jvm_table_add_jvm_for_env(JNIEnv *env) {
     AWS_FATAL_ASSERT(AWS_OP_SUCCESS == aws_hash_table_put(s_jvms, jvm, NULL, &was_created));
     AWS_FATAL_ASSERT(was_created == 1);
 
+    s_thread_env_caches_invalidate();
+
     aws_rw_lock_wunlock(&s_jvm_table_lock);
 }
 
@@ -199,6 +378,8 @@ static void s_jvm_table_remove_jvm_for_env(JNIEnv *env) {
 
     AWS_FATAL_ASSERT(AWS_OP_SUCCESS == aws_hash_table_remove(s_jvms, jvm, NULL, NULL));
 
+    s_thread_env_caches_invalidate();
+
     if (aws_hash_table_get_entry_count(s_jvms) == 0) {
         aws_hash_table_clean_up(s_jvms);
         aws_mem_release(aws_default_allocator(), s_jvms);
@@ -214,8 +395,13 @@ struct aws_jvm_env_context aws_jni_acquire_thread_env(JavaVM *jvm) {
     struct aws_jvm_env_context jvm_env_context = {
         .env = NULL,
         .should_detach = false,
+        .from_thread_cache = false,
     };
 
+    if (s_thread_env_cache_try_acquire(jvm, &jvm_env_context)) {
+        return jvm_env_context;
+    }
+
     /*
      * We use try-lock here in order to avoid the re-entrant deadlock case that could happen if we have a read
      * lock already, the JVM shutdown hooks causes another thread to block on taking the write lock, and then
@@ -247,6 +433,14 @@ struct aws_jvm_env_context aws_jni_acquire_thread_env(JavaVM *jvm) {
         goto error;
     }
 
+    /*
+     * Only cache threads that we attached ourselves: their attachment lasts until the thread exits, when the cache is
+     * destroyed along with it.  Dispatch queue threads are detached after every use, so they can't be cached.
+     */
+    if (!s_dispatch_queue_threads && (jvm_env_context.should_detach || tl_thread_env_cache != NULL)) {
+        s_thread_env_cache_update(jvm, jvm_env_context.env);
+    }
+
     return jvm_env_context;
 
 error:
@@ -257,6 +451,11 @@ error:
 }
 
 void aws_jni_release_thread_env(JavaVM *jvm, struct aws_jvm_env_context *jvm_env_context) {
+    if (jvm_env_context->from_thread_cache) {
+        s_thread_env_cache_release();
+        return;
+    }
+
     if (jvm_env_context->env != NULL) {
         /*
         Dispatch Queue threads must be manually detached after they're used instead of depending
@@ -321,6 +520,15 @@ void aws_jni_throw_illegal_argument_exception(JNIEnv *env, const char *msg, ...)
     (*env)->ThrowNew(env, (*env)->FindClass(env, "java/lang/IllegalArgumentException"), buf);
 }
 
+void aws_jni_throw_io_exception(JNIEnv *env, const char *msg, ...) {
+    va_list args;
+    va_start(args, msg);
+    char buf[1024];
+    vsnprintf(buf, sizeof(buf), msg, args);
+    va_end(args);
+    (*env)->ThrowNew(env, (*env)->FindClass(env, "java/io/IOException"), buf);
+}
+
 bool aws_jni_check_and_clear_exception(JNIEnv *env) {
     bool exception_pending = (*env)->ExceptionCheck(env);
     if (exception_pending) {
@@ -589,6 +797,8 @@ static void s_jni_atexit_strict(void) {
     aws_unregister_log_subject_info_list(&s_crt_log_subject_list);
     aws_unregister_error_info(&s_crt_error_list);
 
+    aws_jni_sigv4_key_cache_clean_up();
+
     aws_s3_library_clean_up();
     aws_event_stream_library_clean_up();
     aws_auth_library_clean_up();
@@ -630,6 +840,9 @@ static void s_jni_atexit_gentle(void) {
             AWS_LS_JAVA_CRT_GENERAL,
             "Not all native threads were successfully joined during gentle shutdown.  Memory may be leaked.");
 
+        /* The libraries stay up, but the cached signing keys can still be wiped */
+        aws_jni_sigv4_key_cache_clean_up();
+
         if (g_memory_tracing) {
             AWS_LOGF_DEBUG(
                 AWS_LS_JAVA_CRT_GENERAL,
@@ -724,6 +937,17 @@ void JNICALL Java_software_amazon_awssdk_crt_CRT_onJvmShutdown(JNIEnv *env, jcla
     s_jvm_table_remove_jvm_for_env(env);
 }
 
+JNIEXPORT
+void JNICALL Java_software_amazon_awssdk_crt_CRT_nativeInvalidateThreadEnvCaches(JNIEnv *env, jclass jni_crt_class) {
+    (void)env;
+    (void)jni_crt_class;
+
+    /* What the JVM shutdown hook does to the thread env caches, without removing the JVM */
+    aws_rw_lock_wlock(&s_jvm_table_lock);
+    s_thread_env_caches_invalidate();
+    aws_rw_lock_wunlock(&s_jvm_table_lock);
+}
+
 JNIEXPORT
 jint JNICALL Java_software_amazon_awssdk_crt_CRT_awsLastError(JNIEnv *env, jclass jni_crt_class) {
     (void)env;
@@ -829,3 +1053,124 @@ void JNICALL Java_software_amazon_awssdk_crt_CRT_nativeCheckJniExceptionContract
         (*env)->ExceptionCheck(env);
     }
 }
+
+struct callback_dispatch_thread_data {
+    JavaVM *jvm;
+    int thread_count;
+    int callbacks;
+    struct aws_atomic_var *threads_ready;
+    struct aws_atomic_var *callbacks_dispatched;
+    uint64_t elapsed_ns;
+};
+
+static void s_callback_dispatch_thread_fn(void *user_data) {
+    struct callback_dispatch_thread_data *data = user_data;
+
+    /* Attach to the JVM before timing anything, so only steady-state dispatch is measured */
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(data->jvm);
+    if (jvm_env_context.env == NULL) {
+        return;
+    }
+    aws_jni_release_thread_env(data->jvm, &jvm_env_context);
+
+    /* Start all threads together so they actually contend */
+    aws_atomic_fetch_add(data->threads_ready, 1);
+    while (aws_atomic_load_int(data->threads_ready) < (size_t)data->thread_count) {
+        aws_thread_current_sleep(0);
+    }
+
+    size_t dispatched = 0;
+    uint64_t start_ns = 0;
+    aws_high_res_clock_get_ticks(&start_ns);
+
+    for (int i = 0; i < data->callbacks; ++i) {
+        /********** JNI ENV ACQUIRE **********/
+        jvm_env_context = aws_jni_acquire_thread_env(data->jvm);
+        JNIEnv *env = jvm_env_context.env;
+        if (env == NULL) {
+            break;
+        }
+
+        (*env)->CallStaticVoidMethod(env, crt_properties.crt_class, crt_properties.test_callback_dispatch_method_id);
+        if (!aws_jni_check_and_clear_exception(env)) {
+            ++dispatched;
+        }
+
+        aws_jni_release_thread_env(data->jvm, &jvm_env_context);
+        /********** JNI ENV RELEASE **********/
+    }
+
+    uint64_t end_ns = 0;
+    aws_high_res_clock_get_ticks(&end_ns);
+    data->elapsed_ns = end_ns - start_ns;
+
+    aws_atomic_fetch_add(data->callbacks_dispatched, dispatched);
+}
+
+JNIEXPORT
+jlong JNICALL Java_software_amazon_awssdk_crt_CRT_nativeMeasureCallbackDispatch(
+    JNIEnv *env,
+    jclass jni_crt_class,
+    jint thread_count,
+    jint callbacks_per_thread) {
+    (void)jni_crt_class;
+    aws_cache_jni_ids(env);
+
+    if (thread_count <= 0 || callbacks_per_thread < 0) {
+        aws_jni_throw_illegal_argument_exception(env, "CRT.measureCallbackDispatch: invalid thread or callback count");
+        return -1;
+    }
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+
+    JavaVM *jvm = NULL;
+    jint jvmresult = (*env)->GetJavaVM(env, &jvm);
+    AWS_FATAL_ASSERT(jvmresult == 0 && jvm != NULL);
+
+    struct aws_atomic_var threads_ready;
+    aws_atomic_init_int(&threads_ready, 0);
+    struct aws_atomic_var callbacks_dispatched;
+    aws_atomic_init_int(&callbacks_dispatched, 0);
+
+    struct aws_thread *threads = aws_mem_calloc(allocator, (size_t)thread_count, sizeof(struct aws_thread));
+    struct callback_dispatch_thread_data *thread_data =
+        aws_mem_calloc(allocator, (size_t)thread_count, sizeof(struct callback_dispatch_thread_data));
+
+    int launched = 0;
+    for (; launched < thread_count; ++launched) {
+        thread_data[launched] = (struct callback_dispatch_thread_data){
+            .jvm = jvm,
+            .thread_count = thread_count,
+            .callbacks = callbacks_per_thread,
+            .threads_ready = &threads_ready,
+            .callbacks_dispatched = &callbacks_dispatched,
+        };
+
+        aws_thread_init(&threads[launched], allocator);
+        if (aws_thread_launch(
+                &threads[launched], s_callback_dispatch_thread_fn, &thread_data[launched], aws_default_thread_options())) {
+            aws_thread_clean_up(&threads[launched]);
+            /* Let the threads that did start run, rather than waiting forever for the missing ones */
+            aws_atomic_fetch_add(&threads_ready, (size_t)(thread_count - launched));
+            break;
+        }
+    }
+
+    uint64_t total_elapsed_ns = 0;
+    for (int i = 0; i < launched; ++i) {
+        aws_thread_join(&threads[i]);
+        aws_thread_clean_up(&threads[i]);
+        total_elapsed_ns += thread_data[i].elapsed_ns;
+    }
+
+    aws_mem_release(allocator, thread_data);
+    aws_mem_release(allocator, threads);
+
+    if (launched < thread_count ||
+        aws_atomic_load_int(&callbacks_dispatched) != (size_t)thread_count * (size_t)callbacks_per_thread) {
+        aws_jni_throw_runtime_exception(env, "CRT.measureCallbackDispatch: not every callback was dispatched");
+        return -1;
+    }
+
+    return (jlong)total_elapsed_ns;
+}
@@ -38,6 +38,8 @@ struct aws_jvm_env_context {
     JNIEnv *env;
     /* Determines whether to detach non-CRT threads at the end of a callback. */
     bool should_detach;
+    /* Set when the env came from the calling thread's cache, in which case no JVM table lock is held. */
+    bool from_thread_cache;
 };
 
 /*******************************************************************************
@@ -63,6 +65,11 @@ void aws_jni_throw_out_of_memory_exception(JNIEnv *env, const char *msg, ...);
  ******************************************************************************/
 void aws_jni_throw_illegal_argument_exception(JNIEnv *env, const char *msg, ...);
 
+/*******************************************************************************
+ * Throws java IOException
+ ******************************************************************************/
+void aws_jni_throw_io_exception(JNIEnv *env, const char *msg, ...);
+
 /*******************************************************************************
  * Checks whether or not an exception is pending on the stack and clears it.
  * If an exception was pending, it is cleared.
@@ -245,7 +252,7 @@ struct aws_jvm_env_context aws_jni_acquire_thread_env(JavaVM *jvm);
  * aws_jni_release_thread_env - Releases an acquired JNIEnv for the current thread. Every
  * successfully acquired JNIEnv must be released exactly once.
  * Internally, it
- * - releases the reader lock on the set of valid JVMs
+ * - releases the reader lock on the set of valid JVMs (or the thread cache's hold on the JVM)
  * - detaches the dispatch queue threads (on Apple platforms only) from JVM.
  ******************************************************************************/
 void aws_jni_release_thread_env(JavaVM *jvm, struct aws_jvm_env_context *jvm_env_context);
@@ -94,6 +94,121 @@ jobject JNICALL Java_software_amazon_awssdk_crt_eventstream_Message_messageBuffe
     return aws_jni_direct_byte_buffer_from_raw_ptr(env, buffer, (jlong)buffer_len);
 }
 
+JNIEXPORT
+jlong JNICALL Java_software_amazon_awssdk_crt_eventstream_MessageHeaders_messageHeadersNew(
+    JNIEnv *env,
+    jclass jni_class,
+    jbyteArray headers) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    struct aws_event_stream_rpc_marshalled_message *marshalled_headers =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_event_stream_rpc_marshalled_message));
+
+    /* parsed once here, the header values keep pointing into headers_buf for as long as this lives */
+    if (aws_event_stream_rpc_marshall_message_args_init(
+            marshalled_headers, allocator, env, headers, NULL, NULL, 0, 0)) {
+        aws_mem_release(allocator, marshalled_headers);
+        return (jlong)NULL;
+    }
+
+    return (jlong)marshalled_headers;
+}
+
+JNIEXPORT
+void JNICALL Java_software_amazon_awssdk_crt_eventstream_MessageHeaders_messageHeadersDestroy(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong headers_ptr) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_event_stream_rpc_marshalled_message *marshalled_headers =
+        (struct aws_event_stream_rpc_marshalled_message *)headers_ptr;
+    if (marshalled_headers == NULL) {
+        return;
+    }
+
+    aws_event_stream_rpc_marshall_message_args_clean_up(marshalled_headers);
+    aws_mem_release(aws_jni_get_allocator(), marshalled_headers);
+}
+
+/*
+ * MessageView accessors. The handle is the aws_event_stream_rpc_message_args of the message being delivered, only
+ * valid for the duration of the continuation callback; the Java side invalidates the view when the callback returns.
+ */
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_eventstream_MessageView_messageViewGetHeader(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong message_args_ptr,
+    jint index) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    const struct aws_event_stream_rpc_message_args *message_args =
+        (const struct aws_event_stream_rpc_message_args *)message_args_ptr;
+    if (index < 0 || (size_t)index >= message_args->headers_count) {
+        aws_jni_throw_illegal_argument_exception(env, "MessageView.getHeader: index out of range");
+        return NULL;
+    }
+
+    return aws_event_stream_rpc_marshall_headers_to_byteArray(
+        aws_jni_get_allocator(), env, &message_args->headers[index], 1);
+}
+
+JNIEXPORT
+jbyteArray JNICALL Java_software_amazon_awssdk_crt_eventstream_MessageView_messageViewFindHeader(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong message_args_ptr,
+    jbyteArray name) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    const struct aws_event_stream_rpc_message_args *message_args =
+        (const struct aws_event_stream_rpc_message_args *)message_args_ptr;
+
+    struct aws_byte_cursor name_cur = aws_jni_byte_cursor_from_jbyteArray_acquire(env, name);
+    if (name_cur.ptr == NULL) {
+        return NULL;
+    }
+
+    struct aws_event_stream_header_value_pair *found = NULL;
+    for (size_t i = 0; i < message_args->headers_count; ++i) {
+        struct aws_byte_cursor header_name = aws_event_stream_header_name(&message_args->headers[i]);
+        if (aws_byte_cursor_eq(&header_name, &name_cur)) {
+            found = &message_args->headers[i];
+            break;
+        }
+    }
+    aws_jni_byte_cursor_from_jbyteArray_release(env, name, name_cur);
+
+    if (found == NULL) {
+        return NULL;
+    }
+
+    return aws_event_stream_rpc_marshall_headers_to_byteArray(aws_jni_get_allocator(), env, found, 1);
+}
+
+JNIEXPORT
+jobject JNICALL Java_software_amazon_awssdk_crt_eventstream_MessageView_messageViewGetPayload(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong message_args_ptr) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    const struct aws_event_stream_rpc_message_args *message_args =
+        (const struct aws_event_stream_rpc_message_args *)message_args_ptr;
+    if (message_args->payload == NULL || message_args->payload->len == 0) {
+        return NULL;
+    }
+
+    return aws_jni_direct_byte_buffer_from_raw_ptr(env, message_args->payload->buffer, message_args->payload->len);
+}
+
 int aws_event_stream_rpc_marshall_message_args_init(
     struct aws_event_stream_rpc_marshalled_message *message_args,
     struct aws_allocator *allocator,
@@ -170,6 +285,45 @@ clean_up:
     return AWS_OP_ERR;
 }
 
+int aws_event_stream_rpc_marshall_message_args_init_from_direct_buffer(
+    struct aws_event_stream_rpc_marshalled_message *message_args,
+    JNIEnv *env,
+    const struct aws_event_stream_rpc_marshalled_message *headers,
+    jobject payload,
+    jint payload_offset,
+    jint payload_length,
+    jint message_flags,
+    jint message_type) {
+    AWS_ZERO_STRUCT(*message_args);
+
+    if (payload != NULL) {
+        uint8_t *address = (*env)->GetDirectBufferAddress(env, payload);
+        jlong capacity = (*env)->GetDirectBufferCapacity(env, payload);
+        if (address == NULL || capacity < 0) {
+            aws_jni_throw_illegal_argument_exception(
+                env, "EventStreamRPCMessage: payload must be a direct ByteBuffer.");
+            return AWS_OP_ERR;
+        }
+        if (payload_offset < 0 || payload_length < 0 || (jlong)payload_offset + payload_length > capacity) {
+            aws_jni_throw_illegal_argument_exception(env, "EventStreamRPCMessage: payload range is out of bounds.");
+            return AWS_OP_ERR;
+        }
+
+        /* no allocator, so clean up leaves the Java buffer alone */
+        message_args->payload_buf = aws_byte_buf_from_array(address + payload_offset, (size_t)payload_length);
+    }
+
+    message_args->message_args.message_type = message_type;
+    message_args->message_args.message_flags = message_flags;
+    if (headers != NULL && headers->headers_init) {
+        message_args->message_args.headers = headers->headers_list.data;
+        message_args->message_args.headers_count = headers->headers_list.length;
+    }
+    message_args->message_args.payload = &message_args->payload_buf;
+
+    return AWS_OP_SUCCESS;
+}
+
 void aws_event_stream_rpc_marshall_message_args_clean_up(struct aws_event_stream_rpc_marshalled_message *message_args) {
     aws_byte_buf_clean_up(&message_args->headers_buf);
     aws_byte_buf_clean_up(&message_args->payload_buf);
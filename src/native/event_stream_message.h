@@ -29,6 +29,21 @@ int aws_event_stream_rpc_marshall_message_args_init(
     jint message_flags,
     jint message_type);
 
+/*
+ * Builds message args that reference already parsed headers (from a MessageHeaders, may be NULL) and a range of a
+ * direct ByteBuffer, without copying either. Nothing is owned: the headers and buffer must stay alive and unchanged
+ * until the message has been sent. Clean up is still safe to call.
+ */
+int aws_event_stream_rpc_marshall_message_args_init_from_direct_buffer(
+    struct aws_event_stream_rpc_marshalled_message *message_args,
+    JNIEnv *env,
+    const struct aws_event_stream_rpc_marshalled_message *headers,
+    jobject payload,
+    jint payload_offset,
+    jint payload_length,
+    jint message_flags,
+    jint message_type);
+
 void aws_event_stream_rpc_marshall_message_args_clean_up(struct aws_event_stream_rpc_marshalled_message *message_args);
 
 jbyteArray aws_event_stream_rpc_marshall_headers_to_byteArray(
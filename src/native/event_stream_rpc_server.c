@@ -111,6 +111,8 @@ struct continuation_callback_data {
     JavaVM *jvm;
     jobject java_continuation;
     jobject java_continuation_handler;
+    /* handler asked for a MessageView instead of marshalled headers and payload, queried once at stream setup */
+    bool use_message_view;
 };
 
 static void s_server_continuation_data_destroy(JNIEnv *env, struct continuation_callback_data *callback_data) {
@@ -145,6 +147,22 @@ static void s_stream_continuation_fn(
         return;
     }
 
+    if (callback_data->use_message_view) {
+        /* headers and payload are read in place through message_args, which only lives until this returns */
+        (*env)->CallVoidMethod(
+            env,
+            callback_data->java_continuation_handler,
+            event_stream_server_continuation_handler_properties.onContinuationMessageView,
+            (jlong)message_args,
+            (jint)message_args->headers_count,
+            (jint)message_args->message_type,
+            (jint)message_args->message_flags);
+        aws_jni_check_and_clear_exception(env);
+
+        aws_jni_release_thread_env(callback_data->jvm, &jvm_env_context);
+        return;
+    }
+
     jbyteArray headers_array = aws_event_stream_rpc_marshall_headers_to_byteArray(
         aws_jni_get_allocator(), env, message_args->headers, message_args->headers_count);
 
@@ -267,6 +285,13 @@ static int s_on_incoming_stream_fn(
         goto on_error;
     }
 
+    continuation_callback_data->use_message_view = (*env)->CallBooleanMethod(
+        env, java_continuation_handler, event_stream_server_continuation_handler_properties.isMessageViewEnabled);
+    if (aws_jni_check_and_clear_exception(env)) {
+        aws_raise_error(AWS_ERROR_INVALID_STATE);
+        goto on_error;
+    }
+
     continuation_options->user_data = continuation_callback_data;
     continuation_options->on_continuation = s_stream_continuation_fn;
     continuation_options->on_continuation_closed = s_stream_continuation_closed_fn;
@@ -924,6 +949,77 @@ clean_up:
     return ret_val;
 }
 
+JNIEXPORT
+jint JNICALL Java_software_amazon_awssdk_crt_eventstream_ServerConnectionContinuation_sendContinuationMessageDirect(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_continuation_ptr,
+    jlong jni_headers_ptr,
+    jobject payload,
+    jint payload_offset,
+    jint payload_length,
+    jint message_type,
+    jint message_flags,
+    jobject callback) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_event_stream_rpc_server_continuation_token *continuation =
+        (struct aws_event_stream_rpc_server_continuation_token *)jni_continuation_ptr;
+    const struct aws_event_stream_rpc_marshalled_message *headers =
+        (const struct aws_event_stream_rpc_marshalled_message *)jni_headers_ptr;
+
+    struct message_flush_callback_args *callback_data = NULL;
+
+    int ret_val = AWS_OP_ERR;
+
+    /* headers and payload are referenced in place, the send below encodes them into the outgoing frame */
+    struct aws_event_stream_rpc_marshalled_message marshalled_message;
+    if (aws_event_stream_rpc_marshall_message_args_init_from_direct_buffer(
+            &marshalled_message, env, headers, payload, payload_offset, payload_length, message_flags, message_type)) {
+        goto clean_up;
+    }
+
+    if (continuation == NULL) {
+        aws_jni_throw_runtime_exception(env, "ServerConnectionContinuation.sendMessage: native continuation is NULL.");
+        goto clean_up;
+    }
+
+    callback_data = aws_mem_calloc(aws_jni_get_allocator(), 1, sizeof(struct message_flush_callback_args));
+    if (!callback_data) {
+        aws_jni_throw_runtime_exception(env, "ServerConnectionContinuation.sendMessage: allocation failed.");
+        goto clean_up;
+    }
+
+    jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
+    if (jvmresult != 0) {
+        aws_jni_throw_runtime_exception(env, "ServerConnectionContinuation.sendMessage: Unable to get JVM");
+        goto clean_up;
+    }
+
+    callback_data->callback = (*env)->NewGlobalRef(env, callback);
+    if (callback_data->callback == NULL) {
+        aws_jni_throw_runtime_exception(env, "ServerConnectionContinuation.sendMessage: make global ref failed");
+        goto clean_up;
+    }
+
+    if (aws_event_stream_rpc_server_continuation_send_message(
+            continuation, &marshalled_message.message_args, s_message_flush_fn, callback_data)) {
+        aws_jni_throw_runtime_exception(env, "ServerConnectionContinuation.sendMessage: send message failed");
+        goto clean_up;
+    }
+
+    ret_val = AWS_OP_SUCCESS;
+
+clean_up:
+    aws_event_stream_rpc_marshall_message_args_clean_up(&marshalled_message);
+    if (ret_val != AWS_OP_SUCCESS) {
+        s_destroy_message_flush_callback_args(env, callback_data);
+    }
+
+    return ret_val;
+}
+
 #if UINTPTR_MAX == 0xffffffff
 #    if defined(_MSC_VER)
 #        pragma warning(pop)
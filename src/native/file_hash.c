@@ -0,0 +1,320 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include "crt.h"
+#include "java_class_ids.h"
+#include <jni.h>
+
+#include <aws/checksums/crc.h>
+#include <aws/checksums/xxhash.h>
+#include <aws/common/byte_buf.h>
+#include <aws/common/file.h>
+#include <aws/common/string.h>
+
+#ifndef _WIN32
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+/*
+ * Hashing a range of a file without moving its contents through the Java heap. The file is read a chunk at a time
+ * into a native buffer. On POSIX platforms that is done with pread() and, where available, the file is hinted for
+ * sequential access so the kernel reads ahead. The file is not mapped: a mapping of a file that is truncated
+ * underneath us faults with SIGBUS, where a read just comes up short.
+ */
+
+/* Must match the native values in FileHash.Algorithm */
+enum aws_jni_file_hash_algorithm {
+    AWS_JNI_FHA_CRC32 = 0,
+    AWS_JNI_FHA_CRC32C = 1,
+    AWS_JNI_FHA_CRC64NVME = 2,
+    AWS_JNI_FHA_XXHASH64 = 3,
+    AWS_JNI_FHA_XXHASH3_64 = 4,
+    AWS_JNI_FHA_XXHASH3_128 = 5,
+};
+
+#define FILE_HASH_READ_CHUNK_SIZE (1024 * 1024)
+
+/* A length of -1 from Java means "to the end of the file" */
+#define FILE_HASH_TO_END_OF_FILE (-1)
+
+struct file_hash_state {
+    enum aws_jni_file_hash_algorithm algorithm;
+    uint64_t crc;
+    struct aws_xxhash *xxhash;
+};
+
+static int s_file_hash_state_init(
+    struct file_hash_state *state,
+    struct aws_allocator *allocator,
+    jint algorithm,
+    uint64_t seed) {
+
+    AWS_ZERO_STRUCT(*state);
+    state->algorithm = (enum aws_jni_file_hash_algorithm)algorithm;
+
+    switch (state->algorithm) {
+        case AWS_JNI_FHA_CRC32:
+        case AWS_JNI_FHA_CRC32C:
+        case AWS_JNI_FHA_CRC64NVME:
+            return AWS_OP_SUCCESS;
+        case AWS_JNI_FHA_XXHASH64:
+            state->xxhash = aws_xxhash64_new(allocator, seed);
+            break;
+        case AWS_JNI_FHA_XXHASH3_64:
+            state->xxhash = aws_xxhash3_64_new(allocator, seed);
+            break;
+        case AWS_JNI_FHA_XXHASH3_128:
+            state->xxhash = aws_xxhash3_128_new(allocator, seed);
+            break;
+        default:
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    return state->xxhash != NULL ? AWS_OP_SUCCESS : AWS_OP_ERR;
+}
+
+static int s_file_hash_state_update(struct file_hash_state *state, const uint8_t *data, size_t length) {
+    switch (state->algorithm) {
+        case AWS_JNI_FHA_CRC32:
+            state->crc = aws_checksums_crc32_ex(data, length, (uint32_t)state->crc);
+            return AWS_OP_SUCCESS;
+        case AWS_JNI_FHA_CRC32C:
+            state->crc = aws_checksums_crc32c_ex(data, length, (uint32_t)state->crc);
+            return AWS_OP_SUCCESS;
+        case AWS_JNI_FHA_CRC64NVME:
+            state->crc = aws_checksums_crc64nvme_ex(data, length, state->crc);
+            return AWS_OP_SUCCESS;
+        default:
+            return aws_xxhash_update(state->xxhash, aws_byte_cursor_from_array(data, length));
+    }
+}
+
+/* Digests are big endian, the same as XXHash.digest() and the S3 checksum headers */
+static int s_file_hash_state_finalize(struct file_hash_state *state, struct aws_byte_buf *digest) {
+    switch (state->algorithm) {
+        case AWS_JNI_FHA_CRC32:
+        case AWS_JNI_FHA_CRC32C:
+            return aws_byte_buf_write_be32(digest, (uint32_t)state->crc) ? AWS_OP_SUCCESS : AWS_OP_ERR;
+        case AWS_JNI_FHA_CRC64NVME:
+            return aws_byte_buf_write_be64(digest, state->crc) ? AWS_OP_SUCCESS : AWS_OP_ERR;
+        default:
+            return aws_xxhash_finalize(state->xxhash, digest);
+    }
+}
+
+static void s_file_hash_state_clean_up(struct file_hash_state *state) {
+    if (state->xxhash != NULL) {
+        aws_xxhash_destroy(state->xxhash);
+        state->xxhash = NULL;
+    }
+}
+
+/* Resolves the "to end of file" length and checks the range fits in the file */
+static int s_resolve_range(int64_t file_size, int64_t offset, int64_t *length) {
+    if (offset > file_size) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    if (*length == FILE_HASH_TO_END_OF_FILE) {
+        *length = file_size - offset;
+    }
+    if (*length > file_size - offset) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+#ifndef _WIN32
+
+static int s_hash_file_range(const char *path, int64_t offset, int64_t length, struct file_hash_state *state) {
+    int result = AWS_OP_ERR;
+    struct aws_byte_buf chunk;
+    AWS_ZERO_STRUCT(chunk);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        switch (errno) {
+            case ENOENT:
+                return aws_raise_error(AWS_ERROR_FILE_INVALID_PATH);
+            case EACCES:
+            case EPERM:
+                return aws_raise_error(AWS_ERROR_NO_PERMISSION);
+            default:
+                return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        }
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+        goto done;
+    }
+    if (s_resolve_range((int64_t)file_stat.st_size, offset, &length)) {
+        goto done;
+    }
+
+#    ifdef POSIX_FADV_SEQUENTIAL
+    /* Only a hint, hashing works the same if it is ignored */
+    posix_fadvise(fd, (off_t)offset, (off_t)length, POSIX_FADV_SEQUENTIAL);
+#    endif
+
+    if (aws_byte_buf_init(&chunk, aws_jni_get_allocator(), (size_t)aws_min_i64(length, FILE_HASH_READ_CHUNK_SIZE))) {
+        goto done;
+    }
+
+    while (length > 0) {
+        size_t to_read = (size_t)aws_min_i64(length, FILE_HASH_READ_CHUNK_SIZE);
+        ssize_t bytes_read = pread(fd, chunk.buffer, to_read, (off_t)offset);
+        if (bytes_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+            goto done;
+        }
+        if (bytes_read == 0) {
+            /* the file shrank underneath us */
+            aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+            goto done;
+        }
+        if (s_file_hash_state_update(state, chunk.buffer, (size_t)bytes_read)) {
+            goto done;
+        }
+        offset += (int64_t)bytes_read;
+        length -= (int64_t)bytes_read;
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_byte_buf_clean_up(&chunk);
+    close(fd);
+    return result;
+}
+
+#else /* _WIN32 */
+
+static int s_hash_file_range(const char *path, int64_t offset, int64_t length, struct file_hash_state *state) {
+    int result = AWS_OP_ERR;
+    struct aws_byte_buf chunk;
+    AWS_ZERO_STRUCT(chunk);
+
+    FILE *file = aws_fopen(path, "rb");
+    if (file == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    int64_t file_size = 0;
+    if (aws_file_get_length(file, &file_size) || s_resolve_range(file_size, offset, &length) ||
+        aws_fseek(file, offset, SEEK_SET)) {
+        goto done;
+    }
+
+    if (aws_byte_buf_init(&chunk, aws_jni_get_allocator(), (size_t)aws_min_i64(length, FILE_HASH_READ_CHUNK_SIZE))) {
+        goto done;
+    }
+
+    while (length > 0) {
+        size_t to_read = (size_t)aws_min_i64(length, FILE_HASH_READ_CHUNK_SIZE);
+        size_t read = fread(chunk.buffer, 1, to_read, file);
+        if (read != to_read) {
+            /* the file shrank underneath us */
+            aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+            goto done;
+        }
+        if (s_file_hash_state_update(state, chunk.buffer, read)) {
+            goto done;
+        }
+        length -= (int64_t)read;
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_byte_buf_clean_up(&chunk);
+    fclose(file);
+    return result;
+}
+
+#endif /* _WIN32 */
+
+JNIEXPORT jbyteArray JNICALL Java_software_amazon_awssdk_crt_checksums_FileHash_fileHashCompute(
+    JNIEnv *env,
+    jclass jni_class,
+    jstring path,
+    jint algorithm,
+    jlong offset,
+    jlong length,
+    jlong seed) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    if (offset < 0 || (length < 0 && length != FILE_HASH_TO_END_OF_FILE)) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "FileHash.fileHashCompute: offset and length must not be negative");
+        return NULL;
+    }
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    jbyteArray hash = NULL;
+    struct aws_byte_buf digest;
+    AWS_ZERO_STRUCT(digest);
+    struct file_hash_state state;
+    AWS_ZERO_STRUCT(state);
+
+    if (path == NULL) {
+        aws_jni_throw_null_pointer_exception(env, "FileHash.fileHashCompute: path is null");
+        return NULL;
+    }
+
+    struct aws_string *c_path = aws_jni_new_string_from_jstring(env, path);
+    if (c_path == NULL) {
+        aws_jni_throw_runtime_exception(env, "FileHash.fileHashCompute: failed to read path");
+        return NULL;
+    }
+
+    if (s_file_hash_state_init(&state, allocator, algorithm, (uint64_t)seed)) {
+        aws_jni_throw_runtime_exception(
+            env, "FileHash.fileHashCompute: failed to create hash: %s", aws_error_str(aws_last_error()));
+        goto done;
+    }
+
+    if (s_hash_file_range(aws_string_c_str(c_path), offset, length, &state)) {
+        int error_code = aws_last_error();
+        if (error_code == AWS_ERROR_INVALID_ARGUMENT) {
+            aws_jni_throw_illegal_argument_exception(
+                env, "FileHash.fileHashCompute: range is outside of %s", aws_string_c_str(c_path));
+            goto done;
+        }
+        if (error_code == AWS_ERROR_OOM) {
+            aws_jni_throw_out_of_memory_exception(
+                env, "FileHash.fileHashCompute: failed to allocate a buffer to hash %s", aws_string_c_str(c_path));
+            goto done;
+        }
+        /* Everything else is the file failing to open or read, including it shrinking underneath us */
+        aws_jni_throw_io_exception(
+            env,
+            "FileHash.fileHashCompute: failed to read %s: %s",
+            aws_string_c_str(c_path),
+            aws_error_str(error_code));
+        goto done;
+    }
+
+    if (aws_byte_buf_init(&digest, allocator, 16) || s_file_hash_state_finalize(&state, &digest)) {
+        aws_jni_throw_runtime_exception(env, "FileHash.fileHashCompute: failed to finalize hash");
+        goto done;
+    }
+
+    struct aws_byte_cursor digest_cursor = aws_byte_cursor_from_buf(&digest);
+    hash = aws_jni_byte_array_from_cursor(env, &digest_cursor);
+
+done:
+    aws_byte_buf_clean_up(&digest);
+    s_file_hash_state_clean_up(&state);
+    aws_string_destroy(c_path);
+
+    return hash;
+}
@@ -4,13 +4,20 @@
  */
 
 #include "crt.h"
+#include "http_request_response.h"
+#include "http_request_utils.h"
 #include "java_class_ids.h"
 
 #include <http_proxy_options.h>
+#include <inttypes.h>
 #include <jni.h>
 #include <string.h>
 
+#include <aws/common/clock.h>
 #include <aws/common/condition_variable.h>
+#include <aws/common/linked_list.h>
+#include <aws/common/math.h>
+#include <aws/common/mutex.h>
 #include <aws/common/string.h>
 
 #include <aws/io/channel_bootstrap.h>
@@ -46,6 +53,29 @@ struct http_connection_manager_binding {
     JavaVM *jvm;
     jobject java_http_conn_manager;
     struct aws_http_connection_manager *manager;
+
+    /* Pipelining of acquireStream() requests, see s_pipeline_join() */
+    size_t max_pipelined_requests;
+    /* Protects the pipelining and adaptive sizing state below */
+    struct aws_mutex lock;
+    struct aws_linked_list pipelined_connections;
+    uint64_t pipeline_failures;
+
+    /* Adaptive sizing, see s_acquire_connection(). Off when adaptive_target_ns is 0 */
+    uint64_t adaptive_target_ns;
+    uint64_t adaptive_hysteresis_ns;
+    size_t adaptive_min_connections;
+    size_t adaptive_max_connections;
+    size_t adaptive_limit;
+    size_t adaptive_leased;
+    /* Acquisitions held back by the limit, aws_adaptive_acquisition entries */
+    struct aws_linked_list adaptive_waiters;
+    uint64_t adaptive_window_ns;
+    size_t adaptive_window_samples;
+    /* Acquisitions taken off adaptive_waiters but not yet handed to the manager, which can't be released until then */
+    size_t adaptive_starting;
+    bool adaptive_closing;
+    struct aws_condition_variable adaptive_started;
 };
 
 static void s_destroy_manager_binding(struct http_connection_manager_binding *binding, JNIEnv *env) {
@@ -57,6 +87,11 @@ static void s_destroy_manager_binding(struct http_connection_manager_binding *bi
         (*env)->DeleteGlobalRef(env, binding->java_http_conn_manager);
     }
 
+    AWS_ASSERT(aws_linked_list_empty(&binding->pipelined_connections));
+    AWS_ASSERT(aws_linked_list_empty(&binding->adaptive_waiters));
+    aws_condition_variable_clean_up(&binding->adaptive_started);
+    aws_mutex_clean_up(&binding->lock);
+
     aws_mem_release(aws_jni_get_allocator(), binding);
 }
 
@@ -87,6 +122,200 @@ static void s_on_http_conn_manager_shutdown_complete_callback(void *user_data) {
     /********** JNI ENV RELEASE **********/
 }
 
+/********************************************************************************************************************/
+
+/*
+ * Adaptive sizing. aws_http_connection_manager's max_connections is fixed, so the binding keeps its own limit on
+ * leased connections, between the configured minimum and max_connections, and holds acquisitions back once it is
+ * reached. The limit follows the acquisition latency, from the acquire call to the connection, averaged over a
+ * window of acquisitions: it grows while that is above the target plus hysteresis with acquisitions held back, and
+ * shrinks by one while it is below the target minus hysteresis with none held back. Connections above the limit go
+ * idle and are closed by the manager's idle timeout.
+ *
+ * Held back acquisitions are only ever handed to the manager while something keeps it alive: a lease, or the Java
+ * object, which waits for them in s_adaptive_close() before releasing the manager.
+ */
+#define ADAPTIVE_MIN_WINDOW_SAMPLES 8
+
+struct aws_adaptive_acquisition {
+    struct aws_linked_list_node node;
+    struct http_connection_manager_binding *binding;
+    aws_http_connection_manager_on_connection_setup_fn *callback;
+    void *user_data;
+    uint64_t start_ns;
+};
+
+static uint64_t s_adaptive_now_ns(void) {
+    uint64_t now = 0;
+    aws_high_res_clock_get_ticks(&now);
+    return now;
+}
+
+/* Takes as many held back acquisitions as the limit allows off the waiters, call with the lock held */
+static void s_adaptive_take_waiters_synced(
+    struct http_connection_manager_binding *binding,
+    struct aws_linked_list *to_start) {
+
+    size_t count = 0;
+    while (!aws_linked_list_empty(&binding->adaptive_waiters) &&
+           (binding->adaptive_closing || binding->adaptive_leased < binding->adaptive_limit)) {
+        aws_linked_list_push_back(to_start, aws_linked_list_pop_front(&binding->adaptive_waiters));
+        ++binding->adaptive_leased;
+        ++count;
+    }
+    binding->adaptive_starting += count;
+}
+
+static void s_on_adaptive_connection_acquired(struct aws_http_connection *connection, int error_code, void *user_data);
+
+/* Hands acquisitions taken by s_adaptive_take_waiters_synced() to the manager */
+static void s_adaptive_start(struct http_connection_manager_binding *binding, struct aws_linked_list *to_start) {
+    size_t count = 0;
+    while (!aws_linked_list_empty(to_start)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(to_start);
+        aws_http_connection_manager_acquire_connection(
+            binding->manager,
+            s_on_adaptive_connection_acquired,
+            AWS_CONTAINER_OF(node, struct aws_adaptive_acquisition, node));
+        ++count;
+    }
+
+    if (count > 0) {
+        aws_mutex_lock(&binding->lock);
+        binding->adaptive_starting -= count;
+        aws_mutex_unlock(&binding->lock);
+        aws_condition_variable_notify_all(&binding->adaptive_started);
+    }
+}
+
+static void s_on_adaptive_connection_acquired(struct aws_http_connection *connection, int error_code, void *user_data) {
+    struct aws_adaptive_acquisition *acquisition = user_data;
+    struct http_connection_manager_binding *binding = acquisition->binding;
+    uint64_t latency_ns = s_adaptive_now_ns() - acquisition->start_ns;
+
+    aws_mutex_lock(&binding->lock);
+    if (error_code) {
+        --binding->adaptive_leased;
+    } else {
+        binding->adaptive_window_ns += latency_ns;
+        ++binding->adaptive_window_samples;
+
+        if (binding->adaptive_window_samples >= aws_max_size(binding->adaptive_limit, ADAPTIVE_MIN_WINDOW_SAMPLES)) {
+            uint64_t average_ns = binding->adaptive_window_ns / binding->adaptive_window_samples;
+            bool held_back = !aws_linked_list_empty(&binding->adaptive_waiters);
+            size_t old_limit = binding->adaptive_limit;
+
+            if (average_ns > binding->adaptive_target_ns + binding->adaptive_hysteresis_ns && held_back) {
+                binding->adaptive_limit = aws_min_size(
+                    binding->adaptive_max_connections,
+                    binding->adaptive_limit + aws_max_size(1, binding->adaptive_limit / 4));
+            } else if (
+                average_ns + binding->adaptive_hysteresis_ns < binding->adaptive_target_ns && !held_back &&
+                binding->adaptive_limit > binding->adaptive_min_connections) {
+                --binding->adaptive_limit;
+            }
+
+            if (binding->adaptive_limit != old_limit) {
+                AWS_LOGF_DEBUG(
+                    AWS_LS_HTTP_CONNECTION_MANAGER,
+                    "ConnManager adaptive limit: manager: %p, average acquisition: %" PRIu64 "ns, limit: %zu -> %zu",
+                    (void *)binding->manager,
+                    average_ns,
+                    old_limit,
+                    binding->adaptive_limit);
+            }
+            binding->adaptive_window_ns = 0;
+            binding->adaptive_window_samples = 0;
+        }
+    }
+
+    struct aws_linked_list to_start;
+    aws_linked_list_init(&to_start);
+    s_adaptive_take_waiters_synced(binding, &to_start);
+    aws_mutex_unlock(&binding->lock);
+
+    aws_http_connection_manager_on_connection_setup_fn *callback = acquisition->callback;
+    void *callback_user_data = acquisition->user_data;
+    aws_mem_release(aws_jni_get_allocator(), acquisition);
+
+    /* Started before the callback, which may release this connection and with it the manager's last lease */
+    s_adaptive_start(binding, &to_start);
+    callback(connection, error_code, callback_user_data);
+}
+
+/* aws_http_connection_manager_acquire_connection(), subject to the adaptive limit */
+static void s_acquire_connection(
+    struct http_connection_manager_binding *binding,
+    aws_http_connection_manager_on_connection_setup_fn *callback,
+    void *user_data) {
+
+    if (binding->adaptive_target_ns == 0) {
+        aws_http_connection_manager_acquire_connection(binding->manager, callback, user_data);
+        return;
+    }
+
+    struct aws_adaptive_acquisition *acquisition =
+        aws_mem_calloc(aws_jni_get_allocator(), 1, sizeof(struct aws_adaptive_acquisition));
+    acquisition->binding = binding;
+    acquisition->callback = callback;
+    acquisition->user_data = user_data;
+    acquisition->start_ns = s_adaptive_now_ns();
+
+    struct aws_linked_list to_start;
+    aws_linked_list_init(&to_start);
+
+    aws_mutex_lock(&binding->lock);
+    aws_linked_list_push_back(&binding->adaptive_waiters, &acquisition->node);
+    s_adaptive_take_waiters_synced(binding, &to_start);
+    aws_mutex_unlock(&binding->lock);
+
+    s_adaptive_start(binding, &to_start);
+}
+
+/* aws_http_connection_manager_release_connection(), making room for a held back acquisition */
+static void s_release_connection(
+    struct http_connection_manager_binding *binding,
+    struct aws_http_connection *connection) {
+
+    if (binding->adaptive_target_ns != 0) {
+        struct aws_linked_list to_start;
+        aws_linked_list_init(&to_start);
+
+        aws_mutex_lock(&binding->lock);
+        --binding->adaptive_leased;
+        s_adaptive_take_waiters_synced(binding, &to_start);
+        aws_mutex_unlock(&binding->lock);
+
+        /* Before the release: this connection's lease keeps the manager, and this binding, alive until then */
+        s_adaptive_start(binding, &to_start);
+    }
+
+    aws_http_connection_manager_release_connection(binding->manager, connection);
+}
+
+/* Hands every held back acquisition to the manager, which must still be alive, before it is released */
+static void s_adaptive_close(struct http_connection_manager_binding *binding) {
+    if (binding->adaptive_target_ns == 0) {
+        return;
+    }
+
+    struct aws_linked_list to_start;
+    aws_linked_list_init(&to_start);
+
+    aws_mutex_lock(&binding->lock);
+    binding->adaptive_closing = true;
+    s_adaptive_take_waiters_synced(binding, &to_start);
+    aws_mutex_unlock(&binding->lock);
+
+    s_adaptive_start(binding, &to_start);
+
+    aws_mutex_lock(&binding->lock);
+    while (binding->adaptive_starting > 0) {
+        aws_condition_variable_wait(&binding->adaptive_started, &binding->lock);
+    }
+    aws_mutex_unlock(&binding->lock);
+}
+
 JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnectionManager_httpClientConnectionManagerNew(
     JNIEnv *env,
     jclass jni_class,
@@ -117,7 +346,11 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnectio
     jint jni_expected_protocol_version,
     jlong jni_max_pending_connection_acquisitions,
     jlong jni_connection_acquisition_timeout_ms,
-    jlong jni_response_first_byte_timeout_ms) {
+    jlong jni_response_first_byte_timeout_ms,
+    jint jni_max_pipelined_requests,
+    jint jni_adaptive_min_connections,
+    jlong jni_adaptive_target_latency_ms,
+    jint jni_adaptive_hysteresis_percent) {
 
     (void)jni_class;
     (void)jni_expected_protocol_version;
@@ -153,6 +386,18 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnectio
         goto cleanup;
     }
 
+    if (jni_max_pipelined_requests <= 0) {
+        aws_jni_throw_runtime_exception(env, "Max Pipelined Requests must be > 0");
+        goto cleanup;
+    }
+
+    if (jni_adaptive_target_latency_ms > 0 &&
+        (jni_adaptive_min_connections <= 0 || jni_adaptive_min_connections > jni_max_conns ||
+         jni_adaptive_hysteresis_percent < 0)) {
+        aws_jni_throw_runtime_exception(env, "Invalid adaptive pool sizing options");
+        goto cleanup;
+    }
+
     uint32_t port = (uint32_t)jni_port;
 
     bool new_tls_conn_opts = (jni_tls_ctx != 0 && !tls_connection_options);
@@ -168,6 +413,19 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnectio
     binding = aws_mem_calloc(allocator, 1, sizeof(struct http_connection_manager_binding));
     AWS_FATAL_ASSERT(binding);
     binding->java_http_conn_manager = (*env)->NewGlobalRef(env, conn_manager_jobject);
+    binding->max_pipelined_requests = (size_t)jni_max_pipelined_requests;
+    aws_mutex_init(&binding->lock);
+    aws_linked_list_init(&binding->pipelined_connections);
+    aws_linked_list_init(&binding->adaptive_waiters);
+    aws_condition_variable_init(&binding->adaptive_started);
+    if (jni_adaptive_target_latency_ms > 0) {
+        binding->adaptive_target_ns = aws_timestamp_convert(
+            (uint64_t)jni_adaptive_target_latency_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+        binding->adaptive_hysteresis_ns = binding->adaptive_target_ns * (uint64_t)jni_adaptive_hysteresis_percent / 100;
+        binding->adaptive_min_connections = (size_t)jni_adaptive_min_connections;
+        binding->adaptive_max_connections = (size_t)jni_max_conns;
+        binding->adaptive_limit = binding->adaptive_min_connections;
+    }
 
     jint jvmresult = (*env)->GetJavaVM(env, &binding->jvm);
     (void)jvmresult;
@@ -259,7 +517,7 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnectio
 cleanup:
     aws_jni_byte_cursor_from_jbyteArray_release(env, jni_host, host);
 
-    if (binding->manager == NULL) {
+    if (binding != NULL && binding->manager == NULL) {
         s_destroy_manager_binding(binding, env);
         binding = NULL;
     }
@@ -286,6 +544,7 @@ JNIEXPORT void JNICALL
     }
 
     AWS_LOGF_DEBUG(AWS_LS_HTTP_CONNECTION, "Releasing ConnManager: id: %p", (void *)conn_manager);
+    s_adaptive_close(binding);
     aws_http_connection_manager_release(conn_manager);
 }
 
@@ -300,8 +559,8 @@ static void s_destroy_connection_binding(struct aws_http_connection_binding *bin
         (*env)->DeleteGlobalRef(env, binding->java_acquire_connection_future);
     }
 
-    if (binding->manager != NULL && binding->connection != NULL) {
-        aws_http_connection_manager_release_connection(binding->manager, binding->connection);
+    if (binding->manager_binding != NULL && binding->connection != NULL) {
+        s_release_connection(binding->manager_binding, binding->connection);
     }
 
     aws_mem_release(aws_jni_get_allocator(), binding);
@@ -385,13 +644,487 @@ JNIEXPORT void JNICALL
         aws_mem_calloc(allocator, 1, sizeof(struct aws_http_connection_binding));
     connection_binding->java_acquire_connection_future = future_ref;
     connection_binding->manager = conn_manager;
+    connection_binding->manager_binding = manager_binding;
 
     jint jvmresult = (*env)->GetJavaVM(env, &connection_binding->jvm);
     (void)jvmresult;
     AWS_FATAL_ASSERT(jvmresult == 0);
 
-    aws_http_connection_manager_acquire_connection(
-        conn_manager, &s_on_http_conn_acquisition_callback, (void *)connection_binding);
+    s_acquire_connection(manager_binding, &s_on_http_conn_acquisition_callback, (void *)connection_binding);
+}
+
+/********************************************************************************************************************/
+
+/*
+ * Acquire a connection and make a request on it in one go. The Java side only sees the activated stream, the
+ * connection stays native and goes back to the manager as soon as the stream completes.
+ *
+ * With pipelining on, idempotent requests may also be queued on an HTTP/1.1 connection that is already carrying
+ * requests made this way, up to max_pipelined_requests at once. Such a connection goes back to the manager when its
+ * last stream completes, and takes no new streams once one of them has failed: the requests queued behind a failed
+ * one are failed along with the connection.
+ */
+struct aws_pipelined_connection {
+    struct aws_linked_list_node node;
+    struct aws_http_connection *connection;
+    size_t in_flight;
+    bool failed;
+};
+
+struct aws_managed_stream_callback_data {
+    JavaVM *jvm;
+    struct http_stream_binding *stream_binding;
+    struct http_connection_manager_binding *manager_binding;
+    bool pipeline;
+    jobject java_async_callback;
+};
+
+static void s_cleanup_managed_stream_callback_data(
+    struct aws_managed_stream_callback_data *callback_data,
+    JNIEnv *env) {
+
+    if (callback_data->java_async_callback) {
+        (*env)->DeleteGlobalRef(env, callback_data->java_async_callback);
+    }
+    aws_mem_release(aws_jni_get_allocator(), callback_data);
+}
+
+/* Returns an open pipelined connection with room for one more stream, counting that stream in, or NULL */
+static struct aws_http_connection *s_pipeline_join(struct http_connection_manager_binding *binding) {
+    struct aws_http_connection *connection = NULL;
+
+    aws_mutex_lock(&binding->lock);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&binding->pipelined_connections);
+         node != aws_linked_list_end(&binding->pipelined_connections);
+         node = aws_linked_list_next(node)) {
+
+        struct aws_pipelined_connection *pipelined = AWS_CONTAINER_OF(node, struct aws_pipelined_connection, node);
+        if (!pipelined->failed && pipelined->in_flight < binding->max_pipelined_requests &&
+            aws_http_connection_is_open(pipelined->connection)) {
+            ++pipelined->in_flight;
+            connection = pipelined->connection;
+            break;
+        }
+    }
+    aws_mutex_unlock(&binding->lock);
+
+    return connection;
+}
+
+/* Makes a freshly acquired connection available to later pipelined streams, with this first one in flight */
+static void s_pipeline_add(struct http_connection_manager_binding *binding, struct aws_http_connection *connection) {
+    struct aws_pipelined_connection *pipelined =
+        aws_mem_calloc(aws_jni_get_allocator(), 1, sizeof(struct aws_pipelined_connection));
+    pipelined->connection = connection;
+    pipelined->in_flight = 1;
+
+    aws_mutex_lock(&binding->lock);
+    aws_linked_list_push_back(&binding->pipelined_connections, &pipelined->node);
+    aws_mutex_unlock(&binding->lock);
+}
+
+/* A stream is done with its connection, which goes back to the manager unless other pipelined streams still use it */
+static void s_managed_stream_connection_done(
+    struct http_connection_manager_binding *binding,
+    struct aws_http_connection *connection,
+    bool pipelined,
+    int error_code) {
+
+    if (pipelined) {
+        struct aws_pipelined_connection *found = NULL;
+
+        aws_mutex_lock(&binding->lock);
+        for (struct aws_linked_list_node *node = aws_linked_list_begin(&binding->pipelined_connections);
+             node != aws_linked_list_end(&binding->pipelined_connections);
+             node = aws_linked_list_next(node)) {
+
+            struct aws_pipelined_connection *pipelined_conn =
+                AWS_CONTAINER_OF(node, struct aws_pipelined_connection, node);
+            if (pipelined_conn->connection == connection) {
+                found = pipelined_conn;
+                break;
+            }
+        }
+        AWS_FATAL_ASSERT(found != NULL);
+
+        --found->in_flight;
+        if (error_code) {
+            /* Only failures that other requests on the connection were exposed to */
+            if (found->in_flight > 0 || found->failed) {
+                ++binding->pipeline_failures;
+            }
+            found->failed = true;
+        }
+
+        if (found->in_flight > 0) {
+            found = NULL;
+        } else {
+            aws_linked_list_remove(&found->node);
+        }
+        aws_mutex_unlock(&binding->lock);
+
+        if (found == NULL) {
+            return;
+        }
+        aws_mem_release(aws_jni_get_allocator(), found);
+    }
+
+    AWS_LOGF_TRACE(
+        AWS_LS_HTTP_CONNECTION,
+        "ConnManager Releasing Conn after stream completion: manager: %p, conn: %p",
+        (void *)binding->manager,
+        (void *)connection);
+    /* Once the connection is back, the manager (and this binding) may shut down at any time */
+    s_release_connection(binding, connection);
+}
+
+static void s_on_managed_stream_complete(struct aws_http_stream *stream, int error_code, void *user_data) {
+    struct http_stream_binding *binding = (struct http_stream_binding *)user_data;
+
+    aws_java_http_stream_on_stream_complete_fn(stream, error_code, user_data);
+
+    /* The stream holds its own reference to the connection, so it stays valid until the Java stream is closed */
+    s_managed_stream_connection_done(
+        binding->connection_manager_binding, aws_http_stream_get_connection(stream), binding->pipelined, error_code);
+}
+
+static void s_on_managed_stream_failure(
+    JNIEnv *env,
+    struct aws_managed_stream_callback_data *callback_data,
+    int error_code) {
+
+    jobject crt_exception = aws_jni_new_crt_exception_from_error_code(env, error_code);
+    (*env)->CallVoidMethod(
+        env, callback_data->java_async_callback, async_callback_properties.on_failure, crt_exception);
+    (*env)->DeleteLocalRef(env, crt_exception);
+}
+
+/* Makes and activates the stream on a connection it holds, then completes the Java future either way */
+static void s_make_managed_stream(
+    JNIEnv *env,
+    struct aws_managed_stream_callback_data *callback_data,
+    struct aws_http_connection *connection,
+    bool pipelined) {
+
+    struct http_stream_binding *binding = callback_data->stream_binding;
+    int error_code = AWS_ERROR_SUCCESS;
+
+    struct aws_http_make_request_options request_options = {
+        .self_size = sizeof(request_options),
+        .request = binding->native_request,
+        /* Set Callbacks */
+        .on_response_headers = aws_java_http_stream_on_incoming_headers_fn,
+        .on_response_header_block_done = aws_java_http_stream_on_incoming_header_block_done_fn,
+        .on_response_body = aws_java_http_stream_on_incoming_body_fn,
+        .on_complete = s_on_managed_stream_complete,
+        .on_destroy = aws_java_http_stream_on_stream_destroy_fn,
+        .on_metrics = aws_java_http_stream_on_stream_metrics_fn,
+        .user_data = binding,
+    };
+
+    binding->native_stream = aws_http_connection_make_request(connection, &request_options);
+    if (binding->native_stream == NULL) {
+        error_code = aws_last_error();
+        AWS_LOGF_ERROR(AWS_LS_HTTP_CONNECTION, "Stream Request Failed. conn: %p", (void *)connection);
+        s_on_managed_stream_failure(env, callback_data, error_code);
+        goto error;
+    }
+
+    /* Acquire for the native stream. The destroy callback for native stream will release the ref. */
+    aws_http_stream_binding_acquire(binding);
+
+    jobject j_http_stream =
+        aws_java_http_stream_from_native_new(env, binding, aws_http_connection_get_version(connection));
+    if (j_http_stream == NULL) {
+        error_code = AWS_ERROR_UNKNOWN;
+        jthrowable crt_exception = (*env)->ExceptionOccurred(env);
+        AWS_ASSERT(crt_exception);
+        (*env)->ExceptionClear(env);
+        (*env)->CallVoidMethod(
+            env, callback_data->java_async_callback, async_callback_properties.on_failure, crt_exception);
+        (*env)->DeleteLocalRef(env, crt_exception);
+        goto error;
+    }
+
+    /* global ref this because now the callbacks will be firing, and they will release their reference when the
+     * stream callback sequence completes. */
+    binding->java_http_stream_base = (*env)->NewGlobalRef(env, j_http_stream);
+    (*env)->DeleteLocalRef(env, j_http_stream);
+    /* Set before activating, the stream may complete on another thread before this returns */
+    binding->connection_manager_binding = callback_data->manager_binding;
+    binding->pipelined = pipelined;
+    if (aws_http_stream_activate(binding->native_stream)) {
+        error_code = aws_last_error();
+        (*env)->DeleteGlobalRef(env, binding->java_http_stream_base);
+        binding->java_http_stream_base = NULL;
+        binding->connection_manager_binding = NULL;
+        s_on_managed_stream_failure(env, callback_data, error_code);
+        goto error;
+    }
+
+    (*env)->CallVoidMethod(
+        env,
+        callback_data->java_async_callback,
+        async_callback_properties.on_success_with_object,
+        binding->java_http_stream_base);
+    return;
+
+error:
+    /* Drops the native stream's ref on the binding through its destroy callback */
+    aws_http_stream_release(binding->native_stream);
+    /* And the ref for the Java stream, which never made it to the caller */
+    aws_http_stream_binding_release(env, binding);
+    s_managed_stream_connection_done(callback_data->manager_binding, connection, pipelined, error_code);
+}
+
+static void s_on_managed_stream_conn_acquired(struct aws_http_connection *connection, int error_code, void *user_data) {
+    struct aws_managed_stream_callback_data *callback_data = user_data;
+
+    /********** JNI ENV ACQUIRE **********/
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(callback_data->jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env == NULL) {
+        /* If we can't get an environment, then the JVM is probably shutting down.  Don't crash. */
+        return;
+    }
+
+    if (error_code) {
+        AWS_ASSERT(connection == NULL);
+        s_on_managed_stream_failure(env, callback_data, error_code);
+        aws_http_stream_binding_release(env, callback_data->stream_binding);
+    } else {
+        /* HTTP/2 connections multiplex on their own, Http2StreamManager is the way to share those */
+        bool pipelined = callback_data->pipeline && aws_http_connection_get_version(connection) == AWS_HTTP_VERSION_1_1;
+        if (pipelined) {
+            s_pipeline_add(callback_data->manager_binding, connection);
+        }
+        s_make_managed_stream(env, callback_data, connection, pipelined);
+    }
+
+    AWS_FATAL_ASSERT(!aws_jni_check_and_clear_exception(env));
+    JavaVM *jvm = callback_data->jvm;
+    s_cleanup_managed_stream_callback_data(callback_data, env);
+    aws_jni_release_thread_env(jvm, &jvm_env_context);
+    /********** JNI ENV RELEASE **********/
+}
+
+JNIEXPORT void JNICALL
+    Java_software_amazon_awssdk_crt_http_HttpClientConnectionManager_httpClientConnectionManagerAcquireStream(
+        JNIEnv *env,
+        jclass jni_class,
+        jlong jni_conn_manager_binding,
+        jbyteArray marshalled_request,
+        jobject jni_http_request_body_stream,
+        jobject jni_http_response_callback_handler,
+        jobject java_async_callback,
+        jboolean jni_pipeline) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct http_connection_manager_binding *manager_binding =
+        (struct http_connection_manager_binding *)jni_conn_manager_binding;
+    struct aws_http_connection_manager *conn_manager = manager_binding->manager;
+
+    if (!conn_manager) {
+        aws_jni_throw_runtime_exception(env, "Connection Manager can't be null");
+        return;
+    }
+
+    if (!jni_http_response_callback_handler) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "HttpClientConnectionManager.acquireStream: Invalid jni_http_response_callback_handler");
+        return;
+    }
+    if (!java_async_callback) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "HttpClientConnectionManager.acquireStream: Invalid async callback");
+        return;
+    }
+
+    /* initial refcount created for the Java object */
+    struct http_stream_binding *stream_binding = aws_http_stream_binding_new(env, jni_http_response_callback_handler);
+    if (!stream_binding) {
+        /* Exception already thrown */
+        return;
+    }
+
+    stream_binding->native_request =
+        aws_http_request_new_from_java_http_request(env, marshalled_request, jni_http_request_body_stream);
+    if (stream_binding->native_request == NULL) {
+        /* Exception already thrown */
+        aws_http_stream_binding_release(env, stream_binding);
+        return;
+    }
+
+    struct aws_managed_stream_callback_data *callback_data =
+        aws_mem_calloc(aws_jni_get_allocator(), 1, sizeof(struct aws_managed_stream_callback_data));
+
+    jint jvmresult = (*env)->GetJavaVM(env, &callback_data->jvm);
+    (void)jvmresult;
+    AWS_FATAL_ASSERT(jvmresult == 0);
+    callback_data->java_async_callback = (*env)->NewGlobalRef(env, java_async_callback);
+    AWS_FATAL_ASSERT(callback_data->java_async_callback != NULL);
+    callback_data->stream_binding = stream_binding;
+    callback_data->manager_binding = manager_binding;
+    callback_data->pipeline = jni_pipeline && manager_binding->max_pipelined_requests > 1;
+
+    if (callback_data->pipeline) {
+        struct aws_http_connection *connection = s_pipeline_join(manager_binding);
+        if (connection != NULL) {
+            AWS_LOGF_TRACE(
+                AWS_LS_HTTP_CONNECTION,
+                "Pipelining stream on conn: %p, manager: %p",
+                (void *)connection,
+                (void *)conn_manager);
+            s_make_managed_stream(env, callback_data, connection, true);
+            s_cleanup_managed_stream_callback_data(callback_data, env);
+            return;
+        }
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION, "Requesting a new connection for a stream from conn_manager: %p", (void *)conn_manager);
+
+    s_acquire_connection(manager_binding, &s_on_managed_stream_conn_acquired, (void *)callback_data);
+}
+
+/********************************************************************************************************************/
+
+/*
+ * Prewarming: acquire count connections in parallel, straight from the manager rather than through the adaptive
+ * limit, and hold them all until every acquisition has finished so each is a distinct connection. They then go back
+ * to the manager as idle connections for the next acquisitions to pick up.
+ */
+struct aws_prewarm_data {
+    JavaVM *jvm;
+    jobject java_async_callback;
+    struct aws_http_connection_manager *manager;
+    struct aws_mutex lock;
+    /* Protected by lock */
+    size_t remaining;
+    size_t acquired_count;
+    int error_code;
+    /* Trailing storage for count connections */
+    struct aws_http_connection **acquired;
+};
+
+static void s_on_prewarm_conn_acquired(struct aws_http_connection *connection, int error_code, void *user_data) {
+    struct aws_prewarm_data *prewarm = user_data;
+
+    aws_mutex_lock(&prewarm->lock);
+    if (error_code) {
+        if (prewarm->error_code == AWS_ERROR_SUCCESS) {
+            prewarm->error_code = error_code;
+        }
+    } else {
+        prewarm->acquired[prewarm->acquired_count++] = connection;
+    }
+    bool done = --prewarm->remaining == 0;
+    aws_mutex_unlock(&prewarm->lock);
+
+    if (!done) {
+        return;
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION,
+        "ConnManager prewarmed %zu connections: manager: %p, err_code: %d",
+        prewarm->acquired_count,
+        (void *)prewarm->manager,
+        prewarm->error_code);
+
+    /* Back to the pool before the future completes, so acquisitions that follow it find them idle */
+    for (size_t i = 0; i < prewarm->acquired_count; ++i) {
+        aws_http_connection_manager_release_connection(prewarm->manager, prewarm->acquired[i]);
+    }
+
+    /********** JNI ENV ACQUIRE **********/
+    JavaVM *jvm = prewarm->jvm;
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env == NULL) {
+        /* If we can't get an environment, then the JVM is probably shutting down.  Don't crash. */
+        return;
+    }
+
+    if (prewarm->error_code) {
+        jobject crt_exception = aws_jni_new_crt_exception_from_error_code(env, prewarm->error_code);
+        (*env)->CallVoidMethod(env, prewarm->java_async_callback, async_callback_properties.on_failure, crt_exception);
+        (*env)->DeleteLocalRef(env, crt_exception);
+    } else {
+        (*env)->CallVoidMethod(env, prewarm->java_async_callback, async_callback_properties.on_success);
+    }
+    AWS_FATAL_ASSERT(!aws_jni_check_and_clear_exception(env));
+
+    (*env)->DeleteGlobalRef(env, prewarm->java_async_callback);
+    aws_mutex_clean_up(&prewarm->lock);
+    aws_mem_release(aws_jni_get_allocator(), prewarm);
+
+    aws_jni_release_thread_env(jvm, &jvm_env_context);
+    /********** JNI ENV RELEASE **********/
+}
+
+JNIEXPORT void JNICALL
+    Java_software_amazon_awssdk_crt_http_HttpClientConnectionManager_httpClientConnectionManagerPrewarm(
+        JNIEnv *env,
+        jclass jni_class,
+        jlong jni_conn_manager_binding,
+        jint jni_count,
+        jobject java_async_callback) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct http_connection_manager_binding *manager_binding =
+        (struct http_connection_manager_binding *)jni_conn_manager_binding;
+    struct aws_http_connection_manager *conn_manager = manager_binding->manager;
+
+    if (!conn_manager) {
+        aws_jni_throw_runtime_exception(env, "Connection Manager can't be null");
+        return;
+    }
+
+    if (jni_count <= 0) {
+        aws_jni_throw_illegal_argument_exception(env, "HttpClientConnectionManager.prewarm: count must be > 0");
+        return;
+    }
+    if (!java_async_callback) {
+        aws_jni_throw_illegal_argument_exception(env, "HttpClientConnectionManager.prewarm: Invalid async callback");
+        return;
+    }
+
+    size_t count = (size_t)jni_count;
+    struct aws_prewarm_data *prewarm = NULL;
+    struct aws_http_connection **acquired = NULL;
+    if (!aws_mem_acquire_many(
+            aws_jni_get_allocator(),
+            2,
+            &prewarm,
+            sizeof(struct aws_prewarm_data),
+            &acquired,
+            count * sizeof(struct aws_http_connection *))) {
+        aws_jni_throw_runtime_exception(env, "HttpClientConnectionManager.prewarm: out of memory");
+        return;
+    }
+    AWS_ZERO_STRUCT(*prewarm);
+
+    jint jvmresult = (*env)->GetJavaVM(env, &prewarm->jvm);
+    (void)jvmresult;
+    AWS_FATAL_ASSERT(jvmresult == 0);
+    prewarm->java_async_callback = (*env)->NewGlobalRef(env, java_async_callback);
+    AWS_FATAL_ASSERT(prewarm->java_async_callback != NULL);
+    prewarm->manager = conn_manager;
+    aws_mutex_init(&prewarm->lock);
+    prewarm->remaining = count;
+    prewarm->acquired = acquired;
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION, "Prewarming %zu connections on conn_manager: %p", count, (void *)conn_manager);
+
+    for (size_t i = 0; i < count; ++i) {
+        aws_http_connection_manager_acquire_connection(conn_manager, &s_on_prewarm_conn_acquired, (void *)prewarm);
+    }
 }
 
 JNIEXPORT void JNICALL Java_software_amazon_awssdk_crt_http_HttpClientConnection_httpClientConnectionReleaseManaged(
@@ -446,13 +1179,31 @@ JNIEXPORT jobject JNICALL
     struct aws_http_manager_metrics metrics;
     aws_http_connection_manager_fetch_metrics(conn_manager, &metrics);
 
+    /* Streams waiting behind another on a pipelined connection */
+    uint64_t pipelined_streams = 0;
+    aws_mutex_lock(&manager_binding->lock);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&manager_binding->pipelined_connections);
+         node != aws_linked_list_end(&manager_binding->pipelined_connections);
+         node = aws_linked_list_next(node)) {
+
+        struct aws_pipelined_connection *pipelined = AWS_CONTAINER_OF(node, struct aws_pipelined_connection, node);
+        pipelined_streams += pipelined->in_flight - 1;
+    }
+    uint64_t pipeline_failures = manager_binding->pipeline_failures;
+    size_t held_back = aws_linked_list_size(&manager_binding->adaptive_waiters);
+    size_t adaptive_limit = manager_binding->adaptive_target_ns != 0 ? manager_binding->adaptive_limit : 0;
+    aws_mutex_unlock(&manager_binding->lock);
+
     return (*env)->NewObject(
         env,
         http_manager_metrics_properties.http_manager_metrics_class,
-        http_manager_metrics_properties.constructor_method_id,
+        http_manager_metrics_properties.connection_manager_constructor_method_id,
         (jlong)metrics.available_concurrency,
-        (jlong)metrics.pending_concurrency_acquires,
-        (jlong)metrics.leased_concurrency);
+        (jlong)(metrics.pending_concurrency_acquires + held_back),
+        (jlong)metrics.leased_concurrency,
+        (jlong)pipelined_streams,
+        (jlong)pipeline_failures,
+        (jlong)adaptive_limit);
 }
 
 #if UINTPTR_MAX == 0xffffffff
@@ -14,10 +14,13 @@ struct aws_http_proxy_options;
 struct aws_tls_connection_options;
 struct aws_tls_ctx;
 
+struct http_connection_manager_binding;
+
 struct aws_http_connection_binding {
     JavaVM *jvm;
     jobject java_acquire_connection_future;
     struct aws_http_connection_manager *manager;
+    struct http_connection_manager_binding *manager_binding;
     struct aws_http_connection *connection;
 };
 
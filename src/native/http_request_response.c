@@ -5,6 +5,7 @@
 
 #include <jni.h>
 
+#include "body_buffer_pool.h"
 #include "crt.h"
 #include "http_connection_manager.h"
 #include "http_request_response.h"
@@ -61,6 +62,15 @@ void aws_java_http_stream_from_native_delete(JNIEnv *env, jobject jHttpStream) {
     (*env)->DeleteGlobalRef(env, jHttpStream);
 }
 
+/* Released buffers kept around for reuse by each stream that retains response body */
+#define HTTP_MAX_POOLED_RESPONSE_BODY_BUFFERS 4
+
+/* Passed to Java as the HttpResponseBody's native chunk, only valid during the body callback */
+struct http_response_body_chunk {
+    struct aws_byte_cursor body;
+    struct http_stream_binding *binding;
+};
+
 /*******************************************************************************
  * http_stream_binding - Jni native represent of the Java HTTP stream object
  ******************************************************************************/
@@ -78,6 +88,7 @@ static void s_http_stream_binding_destroy(JNIEnv *env, struct http_stream_bindin
     if (binding->native_request) {
         aws_http_message_release(binding->native_request);
     }
+    aws_jni_body_buffer_pool_release(binding->body_buffer_pool);
     aws_byte_buf_clean_up(&binding->headers_buf);
     aws_mem_release(aws_jni_get_allocator(), binding);
 }
@@ -231,6 +242,11 @@ int aws_java_http_stream_on_incoming_body_fn(
 
     int result = AWS_OP_ERR;
 
+    struct http_response_body_chunk body_chunk = {
+        .body = *data,
+        .binding = binding,
+    };
+
     jobject jni_payload = aws_jni_direct_byte_buffer_from_raw_ptr(env, data->ptr, data->len);
 
     jint window_increment = (*env)->CallIntMethod(
@@ -238,7 +254,8 @@ int aws_java_http_stream_on_incoming_body_fn(
         binding->java_http_response_stream_handler,
         http_stream_response_handler_properties.onResponseBody,
         binding->java_http_stream_base,
-        jni_payload);
+        jni_payload,
+        (jlong)&body_chunk);
 
     (*env)->DeleteLocalRef(env, jni_payload);
 
@@ -1208,6 +1225,74 @@ JNIEXPORT void JNICALL
     return;
 }
 
+JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_http_HttpResponseBody_httpResponseBodyRetain(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_body_chunk) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct http_response_body_chunk *body_chunk = (struct http_response_body_chunk *)jni_body_chunk;
+    if (!body_chunk || !body_chunk->binding) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        aws_jni_throw_illegal_argument_exception(
+            env, "HttpResponseBody.httpResponseBodyRetain: Invalid/null body chunk");
+        return (jlong)0;
+    }
+
+    /* Only reached from inside the body callback, so the stream's event loop thread owns the binding here */
+    struct http_stream_binding *binding = body_chunk->binding;
+    if (binding->body_buffer_pool == NULL) {
+        binding->body_buffer_pool =
+            aws_jni_body_buffer_pool_new(aws_jni_get_allocator(), HTTP_MAX_POOLED_RESPONSE_BODY_BUFFERS);
+        if (binding->body_buffer_pool == NULL) {
+            aws_jni_throw_out_of_memory_exception(
+                env, "HttpResponseBody.httpResponseBodyRetain: Failed to create buffer pool");
+            return (jlong)0;
+        }
+    }
+
+    struct aws_jni_retained_body_buffer *retained_buffer =
+        aws_jni_body_buffer_pool_retain_copy(binding->body_buffer_pool, body_chunk->body);
+    if (!retained_buffer) {
+        aws_jni_throw_out_of_memory_exception(env, "HttpResponseBody.httpResponseBodyRetain: Failed to retain body");
+        return (jlong)0;
+    }
+
+    return (jlong)retained_buffer;
+}
+
+JNIEXPORT jobject JNICALL Java_software_amazon_awssdk_crt_http_HttpResponseBody_httpResponseBodyGetBuffer(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_retained_buffer) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_retained_body_buffer *retained_buffer = (struct aws_jni_retained_body_buffer *)jni_retained_buffer;
+    if (!retained_buffer) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        aws_jni_throw_illegal_argument_exception(
+            env, "HttpResponseBody.httpResponseBodyGetBuffer: Invalid/null retained buffer");
+        return NULL;
+    }
+
+    return aws_jni_direct_byte_buffer_from_raw_ptr(env, retained_buffer->buffer.buffer, retained_buffer->buffer.len);
+}
+
+JNIEXPORT void JNICALL Java_software_amazon_awssdk_crt_http_HttpResponseBody_httpResponseBodyRelease(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_retained_buffer) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    aws_jni_retained_body_buffer_release((struct aws_jni_retained_body_buffer *)jni_retained_buffer);
+}
+
 #if UINTPTR_MAX == 0xffffffff
 #    if defined(_MSC_VER)
 #        pragma warning(pop)
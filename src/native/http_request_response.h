@@ -13,6 +13,8 @@ struct aws_http_message;
 struct aws_http_stream;
 struct aws_byte_buf;
 struct aws_atomic_var;
+struct aws_jni_body_buffer_pool;
+struct http_connection_manager_binding;
 
 struct http_stream_binding {
     JavaVM *jvm;
@@ -26,6 +28,12 @@ struct http_stream_binding {
     struct aws_http_stream *native_stream;
     struct aws_byte_buf headers_buf;
     int response_status;
+    /* Created the first time Java retains a chunk of response body, only touched from the body callback */
+    struct aws_jni_body_buffer_pool *body_buffer_pool;
+    /* Set when the connection was acquired on the stream's behalf, it goes back to this manager on completion */
+    struct http_connection_manager_binding *connection_manager_binding;
+    /* The connection may be shared with other pipelined streams */
+    bool pipelined;
     /* For the native http stream and the Java stream object */
     struct aws_atomic_var ref;
 };
@@ -56,5 +64,9 @@ int aws_java_http_stream_on_incoming_body_fn(
     void *user_data);
 void aws_java_http_stream_on_stream_complete_fn(struct aws_http_stream *stream, int error_code, void *user_data);
 void aws_java_http_stream_on_stream_destroy_fn(void *user_data);
+void aws_java_http_stream_on_stream_metrics_fn(
+    struct aws_http_stream *stream,
+    const struct aws_http_stream_metrics *metrics,
+    void *user_data);
 
 #endif /* AWS_JNI_CRT_HTTP_REQUEST_RESPONSE_H */
@@ -285,6 +285,21 @@ static void s_cache_credentials_provider(JNIEnv *env) {
     AWS_FATAL_ASSERT(credentials_provider_properties.on_get_credentials_complete_method_id);
 }
 
+struct java_cached_credentials_provider_properties cached_credentials_provider_properties;
+
+static void s_cache_cached_credentials_provider(JNIEnv *env) {
+    jclass provider_class =
+        (*env)->FindClass(env, "software/amazon/awssdk/crt/auth/credentials/CachedCredentialsProvider");
+    AWS_FATAL_ASSERT(provider_class);
+
+    cached_credentials_provider_properties.on_credentials_refreshed_method_id = (*env)->GetMethodID(
+        env,
+        provider_class,
+        "onCredentialsRefreshed",
+        "(Lsoftware/amazon/awssdk/crt/auth/credentials/Credentials;JJ)V");
+    AWS_FATAL_ASSERT(cached_credentials_provider_properties.on_credentials_refreshed_method_id);
+}
+
 struct java_credentials_properties credentials_properties;
 
 static void s_cache_credentials(JNIEnv *env) {
@@ -516,7 +531,7 @@ static void s_cache_http_stream_response_handler_native_adapter(JNIEnv *env) {
     AWS_FATAL_ASSERT(http_stream_response_handler_properties.onResponseHeadersDone);
 
     http_stream_response_handler_properties.onResponseBody = (*env)->GetMethodID(
-        env, cls, "onResponseBody", "(Lsoftware/amazon/awssdk/crt/http/HttpStreamBase;Ljava/nio/ByteBuffer;)I");
+        env, cls, "onResponseBody", "(Lsoftware/amazon/awssdk/crt/http/HttpStreamBase;Ljava/nio/ByteBuffer;J)I");
     AWS_FATAL_ASSERT(http_stream_response_handler_properties.onResponseBody);
 
     http_stream_response_handler_properties.onResponseComplete =
@@ -638,6 +653,12 @@ static void s_cache_event_stream_server_continuation_handler_properties(JNIEnv *
     event_stream_server_continuation_handler_properties.onContinuationMessage =
         (*env)->GetMethodID(env, cls, "onContinuationMessageShim", "([B[BII)V");
     AWS_FATAL_ASSERT(event_stream_server_continuation_handler_properties.onContinuationMessage);
+    event_stream_server_continuation_handler_properties.onContinuationMessageView =
+        (*env)->GetMethodID(env, cls, "onContinuationMessageViewShim", "(JIII)V");
+    AWS_FATAL_ASSERT(event_stream_server_continuation_handler_properties.onContinuationMessageView);
+    event_stream_server_continuation_handler_properties.isMessageViewEnabled =
+        (*env)->GetMethodID(env, cls, "isMessageViewEnabled", "()Z");
+    AWS_FATAL_ASSERT(event_stream_server_continuation_handler_properties.isMessageViewEnabled);
     event_stream_server_continuation_handler_properties.onContinuationClosed =
         (*env)->GetMethodID(env, cls, "onContinuationClosedShim", "()V");
     AWS_FATAL_ASSERT(event_stream_server_continuation_handler_properties.onContinuationClosed);
@@ -669,6 +690,12 @@ static void s_cache_event_stream_client_continuation_handler_properties(JNIEnv *
     event_stream_client_continuation_handler_properties.onContinuationMessage =
         (*env)->GetMethodID(env, cls, "onContinuationMessageShim", "([B[BII)V");
     AWS_FATAL_ASSERT(event_stream_client_continuation_handler_properties.onContinuationMessage);
+    event_stream_client_continuation_handler_properties.onContinuationMessageView =
+        (*env)->GetMethodID(env, cls, "onContinuationMessageViewShim", "(JIII)V");
+    AWS_FATAL_ASSERT(event_stream_client_continuation_handler_properties.onContinuationMessageView);
+    event_stream_client_continuation_handler_properties.isMessageViewEnabled =
+        (*env)->GetMethodID(env, cls, "isMessageViewEnabled", "()Z");
+    AWS_FATAL_ASSERT(event_stream_client_continuation_handler_properties.isMessageViewEnabled);
     event_stream_client_continuation_handler_properties.onContinuationClosed =
         (*env)->GetMethodID(env, cls, "onContinuationClosedShim", "()V");
     AWS_FATAL_ASSERT(event_stream_client_continuation_handler_properties.onContinuationClosed);
@@ -726,6 +753,10 @@ static void s_cache_s3_meta_request_response_handler_native_adapter_properties(J
         (*env)->GetMethodID(env, cls, "onResponseBody", "([BJJ)I");
     AWS_FATAL_ASSERT(s3_meta_request_response_handler_native_adapter_properties.onResponseBody);
 
+    s3_meta_request_response_handler_native_adapter_properties.onResponseBodyDirect =
+        (*env)->GetMethodID(env, cls, "onResponseBodyDirect", "(Ljava/nio/ByteBuffer;JJJ)I");
+    AWS_FATAL_ASSERT(s3_meta_request_response_handler_native_adapter_properties.onResponseBodyDirect);
+
     s3_meta_request_response_handler_native_adapter_properties.onFinished = (*env)->GetMethodID(
         env, cls, "onFinished", "(II[BLjava/lang/String;IZLjava/lang/Throwable;Ljava/nio/ByteBuffer;)V");
     AWS_FATAL_ASSERT(s3_meta_request_response_handler_native_adapter_properties.onFinished);
@@ -795,6 +826,10 @@ static void s_cache_crt(JNIEnv *env) {
 
     crt_properties.test_jni_exception_method_id = (*env)->GetStaticMethodID(env, cls, "testJniException", "(Z)V");
     AWS_FATAL_ASSERT(crt_properties.test_jni_exception_method_id);
+
+    crt_properties.test_callback_dispatch_method_id =
+        (*env)->GetStaticMethodID(env, cls, "testCallbackDispatch", "()V");
+    AWS_FATAL_ASSERT(crt_properties.test_callback_dispatch_method_id);
 }
 
 struct java_aws_signing_result_properties aws_signing_result_properties;
@@ -834,6 +869,10 @@ static void s_cache_http_manager_metrics(JNIEnv *env) {
 
     http_manager_metrics_properties.constructor_method_id = (*env)->GetMethodID(env, cls, "<init>", "(JJJ)V");
     AWS_FATAL_ASSERT(http_manager_metrics_properties.constructor_method_id);
+
+    http_manager_metrics_properties.connection_manager_constructor_method_id =
+        (*env)->GetMethodID(env, cls, "<init>", "(JJJJJJ)V");
+    AWS_FATAL_ASSERT(http_manager_metrics_properties.connection_manager_constructor_method_id);
 }
 
 struct java_aws_exponential_backoff_retry_options_properties exponential_backoff_retry_options_properties;
@@ -1748,6 +1787,12 @@ static void s_cache_mqtt5_client_options(JNIEnv *env) {
         "publishEvents",
         "Lsoftware/amazon/awssdk/crt/mqtt5/Mqtt5ClientOptions$PublishEvents;");
     AWS_FATAL_ASSERT(mqtt5_client_options_properties.publish_events_field_id);
+    mqtt5_client_options_properties.publish_batch_events_field_id = (*env)->GetFieldID(
+        env,
+        mqtt5_client_options_properties.client_options_class,
+        "publishBatchEvents",
+        "Lsoftware/amazon/awssdk/crt/mqtt5/Mqtt5ClientOptions$PublishBatchEvents;");
+    AWS_FATAL_ASSERT(mqtt5_client_options_properties.publish_batch_events_field_id);
     mqtt5_client_options_properties.lifecycle_events_field_id = (*env)->GetFieldID(
         env,
         mqtt5_client_options_properties.client_options_class,
@@ -1825,6 +1870,10 @@ static void s_cache_mqtt5_client_properties(JNIEnv *env) {
     mqtt5_client_properties.client_set_is_connected =
         (*env)->GetMethodID(env, mqtt5_client_properties.client_class, "setIsConnected", "(Z)V");
     AWS_FATAL_ASSERT(mqtt5_client_properties.client_set_is_connected);
+
+    mqtt5_client_properties.client_on_publish_batch_received_id = (*env)->GetMethodID(
+        env, mqtt5_client_properties.client_class, "onPublishBatchReceived", "(Ljava/nio/ByteBuffer;I)V");
+    AWS_FATAL_ASSERT(mqtt5_client_properties.client_on_publish_batch_received_id);
     // Field IDs
     mqtt5_client_properties.websocket_handshake_field_id = (*env)->GetFieldID(
         env, mqtt5_client_properties.client_class, "websocketHandshakeTransform", "Ljava/util/function/Consumer;");
@@ -2717,6 +2766,7 @@ static void s_cache_java_class_ids(void *user_data) {
     s_cache_mqtt_client_connection_operation_statistics(env);
     s_cache_byte_buffer(env);
     s_cache_credentials_provider(env);
+    s_cache_cached_credentials_provider(env);
     s_cache_credentials(env);
     s_cache_credentials_handler(env);
     s_cache_async_callback(env);
@@ -124,6 +124,12 @@ struct java_credentials_provider_properties {
 };
 extern struct java_credentials_provider_properties credentials_provider_properties;
 
+/* CachedCredentialsProvider */
+struct java_cached_credentials_provider_properties {
+    jmethodID on_credentials_refreshed_method_id;
+};
+extern struct java_cached_credentials_provider_properties cached_credentials_provider_properties;
+
 /* Credentials */
 struct java_credentials_properties {
     jclass credentials_class;
@@ -284,6 +290,8 @@ extern struct java_event_stream_server_connection_handler_properties event_strea
 
 struct java_event_stream_server_continuation_handler_properties {
     jmethodID onContinuationMessage;
+    jmethodID onContinuationMessageView;
+    jmethodID isMessageViewEnabled;
     jmethodID onContinuationClosed;
 };
 extern struct java_event_stream_server_continuation_handler_properties
@@ -298,6 +306,8 @@ extern struct java_event_stream_client_connection_handler_properties event_strea
 
 struct java_event_stream_client_continuation_handler_properties {
     jmethodID onContinuationMessage;
+    jmethodID onContinuationMessageView;
+    jmethodID isMessageViewEnabled;
     jmethodID onContinuationClosed;
 };
 extern struct java_event_stream_client_continuation_handler_properties
@@ -328,6 +338,7 @@ extern struct java_s3_meta_request_properties s3_meta_request_properties;
 /* S3MetaRequestResponseHandlerNativeAdapter */
 struct java_s3_meta_request_response_handler_native_adapter_properties {
     jmethodID onResponseBody;
+    jmethodID onResponseBodyDirect;
     jmethodID onFinished;
     jmethodID onResponseHeaders;
     jmethodID onProgress;
@@ -365,6 +376,7 @@ extern struct java_ecc_key_pair_properties ecc_key_pair_properties;
 struct java_crt_properties {
     jclass crt_class;
     jmethodID test_jni_exception_method_id;
+    jmethodID test_callback_dispatch_method_id;
 };
 extern struct java_crt_properties crt_properties;
 
@@ -388,6 +400,7 @@ extern struct java_http_header_properties http_header_properties;
 struct java_http_manager_metrics_properties {
     jclass http_manager_metrics_class;
     jmethodID constructor_method_id;
+    jmethodID connection_manager_constructor_method_id;
 };
 extern struct java_http_manager_metrics_properties http_manager_metrics_properties;
 
@@ -726,6 +739,7 @@ struct java_aws_mqtt5_client_options_properties {
     jfieldID connack_timeout_ms_field_id;
     jfieldID ack_timeout_seconds_field_id;
     jfieldID publish_events_field_id;
+    jfieldID publish_batch_events_field_id;
     jfieldID lifecycle_events_field_id;
     jfieldID topic_aliasing_options_field_id;
     jfieldID disable_metrics_field_id;
@@ -738,6 +752,7 @@ struct java_aws_mqtt5_client_properties {
     jclass client_class;
     jmethodID client_on_websocket_handshake_id;
     jmethodID client_set_is_connected;
+    jmethodID client_on_publish_batch_received_id;
     jfieldID websocket_handshake_field_id;
 };
 extern struct java_aws_mqtt5_client_properties mqtt5_client_properties;
@@ -4,7 +4,11 @@
  */
 #include <aws/mqtt/v5/mqtt5_client.h>
 
+#include <aws/common/array_list.h>
+#include <aws/common/mutex.h>
+#include <aws/common/ref_count.h>
 #include <aws/http/proxy.h>
+#include <aws/io/channel_bootstrap.h>
 #include <aws/io/event_loop.h>
 #include <aws/io/socket.h>
 #include <aws/io/tls_channel_handler.h>
@@ -238,6 +242,455 @@ on_error:
     return NULL;
 }
 
+/*******************************************************************************
+ * BATCHED PUBLISH DELIVERY
+ ******************************************************************************/
+
+/*
+ * When the client options carry PublishBatchEvents, incoming publishes are not turned into PublishPacket objects one
+ * at a time. They are appended to a compact native buffer instead, and handed to Mqtt5Client.onPublishBatchReceived in
+ * a single JNI call once the current event loop tick is done (or sooner, if the buffer grows past the flush threshold).
+ *
+ * Every record is laid out as follows, integers are big-endian. PublishBatch.java decodes it lazily.
+ *
+ *   u32 record length, not counting this field
+ *   u8  qos
+ *   u8  flags (see aws_mqtt5_publish_batch_record_flags)
+ *   u8  payload format indicator
+ *   u8  reserved
+ *   u32 message expiry interval in seconds
+ *   u16 topic alias
+ *   u16 topic length
+ *   u32 payload length
+ *   u16 response topic length
+ *   u16 correlation data length
+ *   u16 content type length
+ *   u16 reserved
+ *   u32 subscription identifier count
+ *   u32 user property count
+ *   topic, payload, response topic, correlation data and content type bytes
+ *   u32 per subscription identifier
+ *   u16 name length, name, u16 value length, value per user property
+ */
+#define AWS_MQTT5_PUBLISH_BATCH_RECORD_HEADER_SIZE 32
+#define AWS_MQTT5_PUBLISH_BATCH_INITIAL_SIZE 4096
+#define AWS_MQTT5_PUBLISH_BATCH_FLUSH_THRESHOLD (256 * 1024)
+
+enum aws_mqtt5_publish_batch_record_flags {
+    AWS_MQTT5_PBRF_RETAIN = 0x01,
+    AWS_MQTT5_PBRF_PAYLOAD_FORMAT = 0x02,
+    AWS_MQTT5_PBRF_MESSAGE_EXPIRY_INTERVAL = 0x04,
+    AWS_MQTT5_PBRF_TOPIC_ALIAS = 0x08,
+    AWS_MQTT5_PBRF_RESPONSE_TOPIC = 0x10,
+    AWS_MQTT5_PBRF_CORRELATION_DATA = 0x20,
+    AWS_MQTT5_PBRF_CONTENT_TYPE = 0x40,
+};
+
+struct aws_mqtt5_client_java_publish_batch {
+    struct aws_allocator *allocator;
+    struct aws_ref_count ref_count;
+
+    JavaVM *jvm;
+    /* The batch holds its own global ref, since a pending flush task can outlive the java_client */
+    jobject jni_client;
+
+    /* Used to find the event loop the client is running on. The batch holds a reference for its final flush task */
+    struct aws_event_loop_group *event_loop_group;
+    struct aws_task flush_task;
+
+    struct aws_mutex lock;
+    /* Everything below is protected by the lock */
+    /* Cleared once the client starts terminating, after which acknowledgements are no longer sent */
+    struct aws_mqtt5_client *client;
+    struct aws_byte_buf records;
+    /* Buffer of the last delivered batch, kept around for reuse */
+    struct aws_byte_buf spare_records;
+    /* uint64_t publish acknowledgement control ids for the QoS 1 records, sent once Java has seen the batch */
+    struct aws_array_list control_ids;
+    jint record_count;
+    bool flush_scheduled;
+    bool terminated;
+};
+
+static void s_aws_mqtt5_client_java_publish_batch_destroy(void *user_data) {
+    struct aws_mqtt5_client_java_publish_batch *batch = user_data;
+
+    /********** JNI ENV ACQUIRE **********/
+    JavaVM *jvm = batch->jvm;
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env != NULL) {
+        (*env)->DeleteGlobalRef(env, batch->jni_client);
+        /********** JNI ENV RELEASE **********/
+        aws_jni_release_thread_env(jvm, &jvm_env_context);
+    }
+
+    aws_byte_buf_clean_up(&batch->records);
+    aws_byte_buf_clean_up(&batch->spare_records);
+    aws_array_list_clean_up(&batch->control_ids);
+    aws_mutex_clean_up(&batch->lock);
+    aws_event_loop_group_release(batch->event_loop_group);
+    aws_mem_release(batch->allocator, batch);
+}
+
+static void s_aws_mqtt5_client_java_publish_batch_flush_task(
+    struct aws_task *task,
+    void *arg,
+    enum aws_task_status status);
+
+static struct aws_mqtt5_client_java_publish_batch *s_aws_mqtt5_client_java_publish_batch_new(
+    JNIEnv *env,
+    struct aws_allocator *allocator,
+    JavaVM *jvm,
+    jobject jni_client,
+    struct aws_event_loop_group *event_loop_group) {
+
+    struct aws_mqtt5_client_java_publish_batch *batch =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_mqtt5_client_java_publish_batch));
+    batch->allocator = allocator;
+    batch->jvm = jvm;
+    aws_task_init(&batch->flush_task, s_aws_mqtt5_client_java_publish_batch_flush_task, batch, "mqtt5_publish_batch");
+
+    if (aws_mutex_init(&batch->lock)) {
+        aws_mem_release(allocator, batch);
+        return NULL;
+    }
+    /* Nothing is allocated until the first QoS 1 record, so this can't fail */
+    aws_array_list_init_dynamic(&batch->control_ids, allocator, 0, sizeof(uint64_t));
+
+    batch->event_loop_group = aws_event_loop_group_acquire(event_loop_group);
+    batch->jni_client = (*env)->NewGlobalRef(env, jni_client);
+    aws_ref_count_init(&batch->ref_count, batch, s_aws_mqtt5_client_java_publish_batch_destroy);
+
+    return batch;
+}
+
+static void s_aws_mqtt5_client_java_publish_batch_release(struct aws_mqtt5_client_java_publish_batch *batch) {
+    if (batch != NULL) {
+        aws_ref_count_release(&batch->ref_count);
+    }
+}
+
+static int s_aws_mqtt5_publish_batch_add_u16_length(size_t *record_size, size_t length) {
+    if (length > UINT16_MAX) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    *record_size += length;
+    return AWS_OP_SUCCESS;
+}
+
+/* Must be called with the lock held */
+static int s_aws_mqtt5_publish_batch_append_record(
+    struct aws_mqtt5_client_java_publish_batch *batch,
+    const struct aws_mqtt5_packet_publish_view *publish) {
+
+    uint8_t flags = publish->retain ? AWS_MQTT5_PBRF_RETAIN : 0;
+    size_t record_size = AWS_MQTT5_PUBLISH_BATCH_RECORD_HEADER_SIZE + publish->payload.len;
+
+    if (s_aws_mqtt5_publish_batch_add_u16_length(&record_size, publish->topic.len)) {
+        return AWS_OP_ERR;
+    }
+    if (publish->payload_format != NULL) {
+        flags |= AWS_MQTT5_PBRF_PAYLOAD_FORMAT;
+    }
+    if (publish->message_expiry_interval_seconds != NULL) {
+        flags |= AWS_MQTT5_PBRF_MESSAGE_EXPIRY_INTERVAL;
+    }
+    if (publish->topic_alias != NULL) {
+        flags |= AWS_MQTT5_PBRF_TOPIC_ALIAS;
+    }
+    if (publish->response_topic != NULL) {
+        flags |= AWS_MQTT5_PBRF_RESPONSE_TOPIC;
+        if (s_aws_mqtt5_publish_batch_add_u16_length(&record_size, publish->response_topic->len)) {
+            return AWS_OP_ERR;
+        }
+    }
+    if (publish->correlation_data != NULL) {
+        flags |= AWS_MQTT5_PBRF_CORRELATION_DATA;
+        if (s_aws_mqtt5_publish_batch_add_u16_length(&record_size, publish->correlation_data->len)) {
+            return AWS_OP_ERR;
+        }
+    }
+    if (publish->content_type != NULL) {
+        flags |= AWS_MQTT5_PBRF_CONTENT_TYPE;
+        if (s_aws_mqtt5_publish_batch_add_u16_length(&record_size, publish->content_type->len)) {
+            return AWS_OP_ERR;
+        }
+    }
+    record_size += publish->subscription_identifier_count * sizeof(uint32_t);
+    for (size_t i = 0; i < publish->user_property_count; ++i) {
+        const struct aws_mqtt5_user_property *property = &publish->user_properties[i];
+        record_size += 2 * sizeof(uint16_t);
+        if (s_aws_mqtt5_publish_batch_add_u16_length(&record_size, property->name.len) ||
+            s_aws_mqtt5_publish_batch_add_u16_length(&record_size, property->value.len)) {
+            return AWS_OP_ERR;
+        }
+    }
+    if (record_size > UINT32_MAX) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct aws_byte_buf *records = &batch->records;
+    size_t needed = sizeof(uint32_t) + record_size;
+    if (records->buffer == NULL) {
+        if (aws_byte_buf_init(records, batch->allocator, aws_max_size(AWS_MQTT5_PUBLISH_BATCH_INITIAL_SIZE, needed))) {
+            return AWS_OP_ERR;
+        }
+    } else if (aws_byte_buf_reserve_smart_relative(records, needed)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Space is reserved up front, so none of the writes below can fail */
+    aws_byte_buf_write_be32(records, (uint32_t)record_size);
+    aws_byte_buf_write_u8(records, (uint8_t)publish->qos);
+    aws_byte_buf_write_u8(records, flags);
+    aws_byte_buf_write_u8(records, publish->payload_format != NULL ? (uint8_t)*publish->payload_format : 0);
+    aws_byte_buf_write_u8(records, 0);
+    aws_byte_buf_write_be32(
+        records, publish->message_expiry_interval_seconds != NULL ? *publish->message_expiry_interval_seconds : 0);
+    aws_byte_buf_write_be16(records, publish->topic_alias != NULL ? *publish->topic_alias : 0);
+    aws_byte_buf_write_be16(records, (uint16_t)publish->topic.len);
+    aws_byte_buf_write_be32(records, (uint32_t)publish->payload.len);
+    aws_byte_buf_write_be16(records, publish->response_topic != NULL ? (uint16_t)publish->response_topic->len : 0);
+    aws_byte_buf_write_be16(records, publish->correlation_data != NULL ? (uint16_t)publish->correlation_data->len : 0);
+    aws_byte_buf_write_be16(records, publish->content_type != NULL ? (uint16_t)publish->content_type->len : 0);
+    aws_byte_buf_write_be16(records, 0);
+    aws_byte_buf_write_be32(records, (uint32_t)publish->subscription_identifier_count);
+    aws_byte_buf_write_be32(records, (uint32_t)publish->user_property_count);
+
+    aws_byte_buf_write_from_whole_cursor(records, publish->topic);
+    aws_byte_buf_write_from_whole_cursor(records, publish->payload);
+    if (publish->response_topic != NULL) {
+        aws_byte_buf_write_from_whole_cursor(records, *publish->response_topic);
+    }
+    if (publish->correlation_data != NULL) {
+        aws_byte_buf_write_from_whole_cursor(records, *publish->correlation_data);
+    }
+    if (publish->content_type != NULL) {
+        aws_byte_buf_write_from_whole_cursor(records, *publish->content_type);
+    }
+    for (size_t i = 0; i < publish->subscription_identifier_count; ++i) {
+        aws_byte_buf_write_be32(records, publish->subscription_identifiers[i]);
+    }
+    for (size_t i = 0; i < publish->user_property_count; ++i) {
+        const struct aws_mqtt5_user_property *property = &publish->user_properties[i];
+        aws_byte_buf_write_be16(records, (uint16_t)property->name.len);
+        aws_byte_buf_write_from_whole_cursor(records, property->name);
+        aws_byte_buf_write_be16(records, (uint16_t)property->value.len);
+        aws_byte_buf_write_from_whole_cursor(records, property->value);
+    }
+
+    ++batch->record_count;
+    return AWS_OP_SUCCESS;
+}
+
+/* Returns true only if the Java callback ran and returned normally */
+static bool s_aws_mqtt5_publish_batch_deliver(
+    struct aws_mqtt5_client_java_publish_batch *batch,
+    const struct aws_byte_buf *records,
+    jint record_count) {
+
+    /********** JNI ENV ACQUIRE **********/
+    JavaVM *jvm = batch->jvm;
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env == NULL) {
+        /* If we can't get an environment, then the JVM is probably shutting down.  Don't crash. */
+        AWS_LOGF_ERROR(AWS_LS_MQTT5_CLIENT, "publishBatchReceived function: could not get env");
+        return false;
+    }
+
+    bool delivered = false;
+
+    /* The buffer points straight at native memory, and is only valid until the Java callback returns */
+    jobject jni_records = aws_jni_direct_byte_buffer_from_raw_ptr(env, records->buffer, records->len);
+    if (jni_records != NULL) {
+        (*env)->CallVoidMethod(
+            env,
+            batch->jni_client,
+            mqtt5_client_properties.client_on_publish_batch_received_id,
+            jni_records,
+            record_count);
+        delivered = !(*env)->ExceptionCheck(env);
+        (*env)->DeleteLocalRef(env, jni_records);
+    }
+    aws_jni_check_and_clear_exception(env); /* To hide JNI warning */
+
+    /********** JNI ENV RELEASE **********/
+    aws_jni_release_thread_env(jvm, &jvm_env_context);
+
+    return delivered;
+}
+
+/*
+ * Takes all pending records and hands them to Java. QoS 1 publishes are only acknowledged after the callback returns
+ * normally; if it throws, or the client is going away, their control ids are dropped. The broker does not redeliver
+ * those publishes on the same connection: they stay unacknowledged, holding receive maximum slots, until reconnect.
+ */
+static void s_aws_mqtt5_publish_batch_flush(struct aws_mqtt5_client_java_publish_batch *batch, bool from_task) {
+    aws_mutex_lock(&batch->lock);
+    struct aws_byte_buf records = batch->records;
+    struct aws_array_list control_ids = batch->control_ids;
+    jint record_count = batch->record_count;
+    bool deliver = record_count > 0;
+    batch->records = batch->spare_records;
+    AWS_ZERO_STRUCT(batch->spare_records);
+    aws_array_list_init_dynamic(&batch->control_ids, batch->allocator, 0, sizeof(uint64_t));
+    batch->record_count = 0;
+    if (from_task) {
+        batch->flush_scheduled = false;
+    }
+    aws_mutex_unlock(&batch->lock);
+
+    bool delivered = deliver && s_aws_mqtt5_publish_batch_deliver(batch, &records, record_count);
+
+    size_t control_id_count = aws_array_list_length(&control_ids);
+    if (delivered && control_id_count > 0) {
+        aws_mutex_lock(&batch->lock);
+        if (batch->client != NULL) {
+            for (size_t i = 0; i < control_id_count; ++i) {
+                uint64_t control_id = 0;
+                aws_array_list_get_at(&control_ids, &control_id, i);
+                aws_mqtt5_client_invoke_publish_acknowledgement(batch->client, control_id, NULL);
+            }
+        }
+        aws_mutex_unlock(&batch->lock);
+    }
+    aws_array_list_clean_up(&control_ids);
+
+    aws_mutex_lock(&batch->lock);
+    if (batch->spare_records.buffer == NULL) {
+        aws_byte_buf_reset(&records, false);
+        batch->spare_records = records;
+        AWS_ZERO_STRUCT(records);
+    }
+    aws_mutex_unlock(&batch->lock);
+
+    aws_byte_buf_clean_up(&records);
+}
+
+static void s_aws_mqtt5_client_java_publish_batch_flush_task(
+    struct aws_task *task,
+    void *arg,
+    enum aws_task_status status) {
+    (void)task;
+    struct aws_mqtt5_client_java_publish_batch *batch = arg;
+
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        s_aws_mqtt5_publish_batch_flush(batch, true);
+    }
+
+    /* Release the reference taken when the task was scheduled */
+    s_aws_mqtt5_client_java_publish_batch_release(batch);
+}
+
+static struct aws_event_loop *s_aws_mqtt5_publish_batch_find_callers_event_loop(
+    struct aws_mqtt5_client_java_publish_batch *batch) {
+    size_t loop_count = aws_event_loop_group_get_loop_count(batch->event_loop_group);
+    for (size_t i = 0; i < loop_count; ++i) {
+        struct aws_event_loop *loop = aws_event_loop_group_get_loop_at(batch->event_loop_group, i);
+        if (loop != NULL && aws_event_loop_thread_is_callers_thread(loop)) {
+            return loop;
+        }
+    }
+    return NULL;
+}
+
+static void s_aws_mqtt5_publish_batch_on_publish_received(
+    struct aws_mqtt5_client_java_publish_batch *batch,
+    const struct aws_mqtt5_packet_publish_view *publish) {
+
+    bool flush_now = false;
+    bool schedule_flush = false;
+
+    aws_mutex_lock(&batch->lock);
+    if (batch->terminated) {
+        aws_mutex_unlock(&batch->lock);
+        return;
+    }
+
+    /*
+     * Taking the acknowledgement control stops the client from sending the PUBACK as soon as this handler returns.
+     * It is taken even if the record can't be added, so a publish Java never sees is never acknowledged either.
+     */
+    uint64_t control_id = 0;
+    if (publish->qos == AWS_MQTT5_QOS_AT_LEAST_ONCE && batch->client != NULL) {
+        control_id = aws_mqtt5_client_acquire_publish_acknowledgement(batch->client, publish);
+    }
+
+    bool control_id_added = false;
+    if (control_id != 0) {
+        control_id_added = aws_array_list_push_back(&batch->control_ids, &control_id) == AWS_OP_SUCCESS;
+    }
+
+    if ((control_id != 0 && !control_id_added) || s_aws_mqtt5_publish_batch_append_record(batch, publish)) {
+        int error_code = aws_last_error();
+        if (control_id_added) {
+            aws_array_list_pop_back(&batch->control_ids);
+        }
+        aws_mutex_unlock(&batch->lock);
+        AWS_LOGF_ERROR(
+            AWS_LS_MQTT5_CLIENT,
+            "publishBatchReceived function: could not add publish to batch, error %d (%s)",
+            error_code,
+            aws_error_str(error_code));
+        return;
+    }
+    if (batch->records.len >= AWS_MQTT5_PUBLISH_BATCH_FLUSH_THRESHOLD) {
+        flush_now = true;
+    } else if (!batch->flush_scheduled) {
+        batch->flush_scheduled = true;
+        schedule_flush = true;
+    }
+    aws_mutex_unlock(&batch->lock);
+
+    if (schedule_flush) {
+        /* Publishes arrive on the client's event loop, so a task scheduled "now" runs once the current read is done */
+        struct aws_event_loop *loop = s_aws_mqtt5_publish_batch_find_callers_event_loop(batch);
+        if (loop != NULL) {
+            aws_ref_count_acquire(&batch->ref_count);
+            aws_event_loop_schedule_task_now(loop, &batch->flush_task);
+        } else {
+            aws_mutex_lock(&batch->lock);
+            batch->flush_scheduled = false;
+            aws_mutex_unlock(&batch->lock);
+            flush_now = true;
+        }
+    }
+
+    if (flush_now) {
+        s_aws_mqtt5_publish_batch_flush(batch, false);
+    }
+}
+
+/*
+ * Drops anything that arrives from now on and hands whatever is still pending to Java, without acknowledging it, from
+ * an event loop task rather than on the terminating thread.
+ */
+static void s_aws_mqtt5_publish_batch_terminate(struct aws_mqtt5_client_java_publish_batch *batch) {
+    bool schedule_flush = false;
+
+    aws_mutex_lock(&batch->lock);
+    batch->client = NULL;
+    batch->terminated = true;
+    /* An already scheduled flush task picks up the pending records */
+    if (batch->record_count > 0 && !batch->flush_scheduled) {
+        batch->flush_scheduled = true;
+        schedule_flush = true;
+    }
+    aws_mutex_unlock(&batch->lock);
+
+    if (schedule_flush) {
+        struct aws_event_loop *loop = aws_event_loop_group_get_next_loop(batch->event_loop_group);
+        if (loop != NULL) {
+            aws_ref_count_acquire(&batch->ref_count);
+            aws_event_loop_schedule_task_now(loop, &batch->flush_task);
+        } else {
+            s_aws_mqtt5_publish_batch_flush(batch, true);
+        }
+    }
+}
+
 /*******************************************************************************
  * HELPER FUNCTIONS
  ******************************************************************************/
@@ -262,6 +715,7 @@ static void aws_mqtt5_client_java_destroy(
     if (java_client->jni_lifecycle_events) {
         (*env)->DeleteGlobalRef(env, java_client->jni_lifecycle_events);
     }
+    s_aws_mqtt5_client_java_publish_batch_release(java_client->publish_batch);
 
     aws_tls_connection_options_clean_up(&java_client->tls_options);
     aws_tls_connection_options_clean_up(&java_client->http_proxy_tls_options);
@@ -523,6 +977,11 @@ static void s_aws_mqtt5_client_java_publish_received(
         return;
     }
 
+    if (java_client->publish_batch != NULL) {
+        s_aws_mqtt5_publish_batch_on_publish_received(java_client->publish_batch, publish);
+        return;
+    }
+
     /********** JNI ENV ACQUIRE **********/
     JavaVM *jvm = java_client->jvm;
     struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
@@ -1116,6 +1575,10 @@ static void s_aws_mqtt5_client_java_termination(void *complete_ctx) {
         return;
     }
 
+    if (java_client->publish_batch != NULL) {
+        s_aws_mqtt5_publish_batch_terminate(java_client->publish_batch);
+    }
+
     (*env)->CallVoidMethod(env, java_client->jni_client, crt_resource_properties.release_references);
     java_client->client = NULL;
 
@@ -2135,6 +2598,23 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_mqtt5_Mqtt5Client_mqtt5C
         java_client->jni_publish_events = (*env)->NewGlobalRef(env, jni_publish_events);
     }
 
+    jobject jni_publish_batch_events =
+        (*env)->GetObjectField(env, jni_options, mqtt5_client_options_properties.publish_batch_events_field_id);
+    if (aws_jni_check_and_clear_exception(env)) {
+        s_aws_mqtt5_client_log_and_throw_exception(
+            env, "MQTT5 client new: error getting publish batch events", AWS_ERROR_INVALID_STATE);
+        goto clean_up;
+    }
+    if (jni_publish_batch_events != NULL) {
+        java_client->publish_batch = s_aws_mqtt5_client_java_publish_batch_new(
+            env, allocator, java_client->jvm, jni_client, bootstrap->event_loop_group);
+        if (java_client->publish_batch == NULL) {
+            s_aws_mqtt5_client_log_and_throw_exception(
+                env, "MQTT5 client new: could not create publish batch", aws_last_error());
+            goto clean_up;
+        }
+    }
+
     jobject jni_lifecycle_events =
         (*env)->GetObjectField(env, jni_options, mqtt5_client_options_properties.lifecycle_events_field_id);
     if (aws_jni_check_and_clear_exception(env)) {
@@ -2189,6 +2669,11 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_mqtt5_Mqtt5Client_mqtt5C
             AWS_ERROR_MQTT5_CLIENT_OPTIONS_VALIDATION);
         goto clean_up;
     }
+    if (java_client->publish_batch != NULL) {
+        aws_mutex_lock(&java_client->publish_batch->lock);
+        java_client->publish_batch->client = java_client->client;
+        aws_mutex_unlock(&java_client->publish_batch->lock);
+    }
     goto clean_up;
 
 clean_up:
@@ -10,6 +10,7 @@
 #include <aws/io/tls_channel_handler.h>
 
 struct aws_mqtt5_client;
+struct aws_mqtt5_client_java_publish_batch;
 
 struct aws_mqtt5_client_java_jni {
     struct aws_mqtt5_client *client;
@@ -21,6 +22,9 @@ struct aws_mqtt5_client_java_jni {
 
     jobject jni_publish_events;
     jobject jni_lifecycle_events;
+
+    /* Only set when the options carry PublishBatchEvents; publishes are then delivered in batches */
+    struct aws_mqtt5_client_java_publish_batch *publish_batch;
 };
 
 #endif /* AWS_JNI_CLIENT_H */
@@ -1035,6 +1035,219 @@ error_cleanup:
     return 0;
 }
 
+/*******************************************************************************
+ * publish batch
+ ******************************************************************************/
+/*
+ * Shared by every publish of one batch. One reference per publish that was queued, plus one held by the JNI call
+ * while it queues them, so the ack can't be delivered before the whole batch has been submitted.
+ */
+struct mqtt_jni_publish_batch {
+    struct mqtt_jni_connection *connection;
+    jobject async_callback;
+    struct aws_atomic_var ref_count;
+    struct aws_atomic_var error_code; /* first error seen by any publish in the batch */
+};
+
+static void s_publish_batch_record_error(struct mqtt_jni_publish_batch *batch, int error_code) {
+    size_t expected = 0;
+    aws_atomic_compare_exchange_int(&batch->error_code, &expected, (size_t)error_code);
+}
+
+static void s_publish_batch_release(struct mqtt_jni_publish_batch *batch, JNIEnv *env) {
+    if (aws_atomic_fetch_sub(&batch->ref_count, 1) != 1) {
+        return;
+    }
+
+    int error_code = (int)aws_atomic_load_int(&batch->error_code);
+    if (error_code) {
+        jobject jni_reason = s_new_mqtt_exception(env, error_code);
+        (*env)->CallVoidMethod(env, batch->async_callback, async_callback_properties.on_failure, jni_reason);
+        (*env)->DeleteLocalRef(env, jni_reason);
+    } else {
+        (*env)->CallVoidMethod(env, batch->async_callback, async_callback_properties.on_success);
+    }
+    AWS_FATAL_ASSERT(!aws_jni_check_and_clear_exception(env));
+
+    (*env)->DeleteGlobalRef(env, batch->async_callback);
+    aws_mem_release(aws_jni_get_allocator(), batch);
+}
+
+/*
+ * Drops the JNI call's reference while a Java exception is pending. If no publish was queued the ack is never
+ * invoked, since Java can't be called into until the exception is handled; the exception reaches the caller instead.
+ */
+static void s_publish_batch_abandon(struct mqtt_jni_publish_batch *batch, JNIEnv *env) {
+    s_publish_batch_record_error(batch, AWS_ERROR_INVALID_ARGUMENT);
+    if (aws_atomic_fetch_sub(&batch->ref_count, 1) != 1) {
+        return;
+    }
+
+    (*env)->DeleteGlobalRef(env, batch->async_callback);
+    aws_mem_release(aws_jni_get_allocator(), batch);
+}
+
+static void s_on_publish_batch_op_complete(
+    struct aws_mqtt_client_connection *connection,
+    uint16_t packet_id,
+    int error_code,
+    void *user_data) {
+    AWS_FATAL_ASSERT(connection);
+    (void)packet_id;
+
+    struct mqtt_jni_publish_batch *batch = user_data;
+    if (error_code) {
+        s_publish_batch_record_error(batch, error_code);
+    }
+
+    /********** JNI ENV ACQUIRE **********/
+    JavaVM *jvm = batch->connection->jvm;
+    struct aws_jvm_env_context jvm_env_context = aws_jni_acquire_thread_env(jvm);
+    JNIEnv *env = jvm_env_context.env;
+    if (env == NULL) {
+        return;
+    }
+
+    s_publish_batch_release(batch, env);
+
+    aws_jni_release_thread_env(jvm, &jvm_env_context);
+    /********** JNI ENV RELEASE **********/
+}
+
+JNIEXPORT
+jshortArray JNICALL Java_software_amazon_awssdk_crt_mqtt_MqttClientConnection_mqttClientConnectionPublishBatch(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_connection,
+    jobjectArray jni_topics,
+    jintArray jni_qos,
+    jbooleanArray jni_retain,
+    jobjectArray jni_payloads,
+    jobject jni_ack) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct mqtt_jni_connection *connection = (struct mqtt_jni_connection *)jni_connection;
+    if (!connection) {
+        aws_jni_throw_runtime_exception(env, "MqttClientConnection.mqtt_publish_batch: Invalid connection");
+        return NULL;
+    }
+
+    if (!jni_topics || !jni_qos || !jni_retain || !jni_payloads || !jni_ack) {
+        aws_jni_throw_illegal_argument_exception(env, "MqttClientConnection.mqtt_publish_batch: Invalid arguments");
+        return NULL;
+    }
+
+    jsize count = (*env)->GetArrayLength(env, jni_topics);
+    if ((*env)->GetArrayLength(env, jni_qos) != count || (*env)->GetArrayLength(env, jni_retain) != count ||
+        (*env)->GetArrayLength(env, jni_payloads) != count) {
+        aws_jni_throw_illegal_argument_exception(
+            env, "MqttClientConnection.mqtt_publish_batch: Message field arrays differ in length");
+        return NULL;
+    }
+
+    jshortArray jni_packet_ids = (*env)->NewShortArray(env, count);
+    if (jni_packet_ids == NULL) {
+        return NULL;
+    }
+
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    struct mqtt_jni_publish_batch *batch = aws_mem_calloc(allocator, 1, sizeof(struct mqtt_jni_publish_batch));
+    batch->connection = connection;
+    batch->async_callback = (*env)->NewGlobalRef(env, jni_ack);
+    aws_atomic_init_int(&batch->ref_count, 1);
+    aws_atomic_init_int(&batch->error_code, 0);
+
+    jint *qos_values = (*env)->GetIntArrayElements(env, jni_qos, NULL);
+    jboolean *retain_values = (*env)->GetBooleanArrayElements(env, jni_retain, NULL);
+    jshort *packet_ids = (*env)->GetShortArrayElements(env, jni_packet_ids, NULL);
+    bool exception_pending = qos_values == NULL || retain_values == NULL || packet_ids == NULL;
+
+    for (jsize i = 0; i < count && !exception_pending; ++i) {
+        jstring jni_topic = (*env)->GetObjectArrayElement(env, jni_topics, i);
+        jbyteArray jni_payload = (*env)->GetObjectArrayElement(env, jni_payloads, i);
+        if (jni_topic == NULL) {
+            /* rejected up front by the Java side, only reachable if the arrays were changed concurrently */
+            s_publish_batch_record_error(batch, AWS_ERROR_INVALID_ARGUMENT);
+            (*env)->DeleteLocalRef(env, jni_payload);
+            break;
+        }
+
+        /* Either acquire throws if the JVM can't hand out the string or array, nothing else is queued after that */
+        struct aws_byte_cursor topic = aws_jni_byte_cursor_from_jstring_acquire(env, jni_topic);
+        if (topic.ptr == NULL) {
+            (*env)->DeleteLocalRef(env, jni_topic);
+            (*env)->DeleteLocalRef(env, jni_payload);
+            exception_pending = true;
+            break;
+        }
+
+        struct aws_byte_cursor payload;
+        AWS_ZERO_STRUCT(payload);
+        if (jni_payload != NULL) {
+            payload = aws_jni_byte_cursor_from_jbyteArray_acquire(env, jni_payload);
+            if (payload.ptr == NULL) {
+                aws_jni_byte_cursor_from_jstring_release(env, jni_topic, topic);
+                (*env)->DeleteLocalRef(env, jni_topic);
+                (*env)->DeleteLocalRef(env, jni_payload);
+                exception_pending = true;
+                break;
+            }
+        }
+
+        aws_atomic_fetch_add(&batch->ref_count, 1);
+        uint16_t msg_id = aws_mqtt_client_connection_publish(
+            connection->client_connection,
+            &topic,
+            (enum aws_mqtt_qos)qos_values[i],
+            retain_values[i] != 0,
+            &payload,
+            s_on_publish_batch_op_complete,
+            batch);
+
+        aws_jni_byte_cursor_from_jstring_release(env, jni_topic, topic);
+        if (jni_payload != NULL) {
+            aws_jni_byte_cursor_from_jbyteArray_release(env, jni_payload, payload);
+        }
+
+        /* one batch can hold more messages than the JVM guarantees local references for */
+        (*env)->DeleteLocalRef(env, jni_topic);
+        (*env)->DeleteLocalRef(env, jni_payload);
+
+        if (msg_id == 0) {
+            /*
+             * Publishes already queued can't be taken back, so stop here and fail the whole batch through the
+             * ack once they complete. The ids of the messages that were never queued stay 0.
+             */
+            int error_code = aws_last_error();
+            aws_atomic_fetch_sub(&batch->ref_count, 1);
+            s_publish_batch_record_error(batch, error_code ? error_code : AWS_ERROR_UNKNOWN);
+            break;
+        }
+
+        packet_ids[i] = (jshort)msg_id;
+    }
+
+    if (packet_ids != NULL) {
+        (*env)->ReleaseShortArrayElements(env, jni_packet_ids, packet_ids, 0);
+    }
+    if (retain_values != NULL) {
+        (*env)->ReleaseBooleanArrayElements(env, jni_retain, retain_values, JNI_ABORT);
+    }
+    if (qos_values != NULL) {
+        (*env)->ReleaseIntArrayElements(env, jni_qos, qos_values, JNI_ABORT);
+    }
+
+    if (exception_pending) {
+        s_publish_batch_abandon(batch, env);
+        return NULL;
+    }
+
+    s_publish_batch_release(batch, env);
+
+    return jni_packet_ids;
+}
+
 JNIEXPORT jboolean JNICALL Java_software_amazon_awssdk_crt_mqtt_MqttClientConnection_mqttClientConnectionSetWill(
     JNIEnv *env,
     jclass jni_class,
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 #include "aws_signing.h"
+#include "body_buffer_pool.h"
 #include "credentials.h"
 #include "crt.h"
 #include "http_request_utils.h"
@@ -50,8 +51,22 @@ struct s3_client_make_meta_request_callback_data {
     struct aws_input_stream *input_stream;
     struct aws_signing_config_data signing_config_data;
     jthrowable java_exception;
+    /* Set when the response body is delivered as direct ByteBuffers over native memory */
+    struct aws_jni_body_buffer_pool *body_buffer_pool;
 };
 
+/*
+ * A response body chunk being delivered to Java in direct body mode. Lives on the stack of the body callback, so the
+ * address handed to Java is only valid until the callback returns.
+ */
+struct s3_response_body_chunk {
+    struct aws_byte_cursor body;
+    struct aws_jni_body_buffer_pool *pool;
+};
+
+/* Released response bodies kept around for reuse by each meta request */
+#define S3_MAX_POOLED_RESPONSE_BODY_BUFFERS 16
+
 static void s_on_s3_client_shutdown_complete_callback(void *user_data);
 static void s_on_s3_meta_request_shutdown_complete_callback(void *user_data);
 
@@ -623,7 +638,17 @@ static int s_on_s3_meta_request_body_callback(
         return AWS_OP_ERR;
     }
 
-    jobject jni_payload = aws_jni_byte_array_from_cursor(env, body);
+    struct s3_response_body_chunk body_chunk = {
+        .body = *body,
+        .pool = callback_data->body_buffer_pool,
+    };
+
+    jobject jni_payload = NULL;
+    if (callback_data->body_buffer_pool != NULL) {
+        jni_payload = (*env)->NewDirectByteBuffer(env, (void *)body->ptr, (jlong)body->len);
+    } else {
+        jni_payload = aws_jni_byte_array_from_cursor(env, body);
+    }
     if (jni_payload == NULL) {
         /* JVM is out of memory, but native code can still have memory available, handle it and don't crash. */
         aws_jni_check_and_clear_exception(env);
@@ -635,13 +660,24 @@ static int s_on_s3_meta_request_body_callback(
     jint body_response_result = 0;
 
     if (callback_data->java_s3_meta_request_response_handler_native_adapter != NULL) {
-        body_response_result = (*env)->CallIntMethod(
-            env,
-            callback_data->java_s3_meta_request_response_handler_native_adapter,
-            s3_meta_request_response_handler_native_adapter_properties.onResponseBody,
-            jni_payload,
-            range_start,
-            range_end);
+        if (callback_data->body_buffer_pool != NULL) {
+            body_response_result = (*env)->CallIntMethod(
+                env,
+                callback_data->java_s3_meta_request_response_handler_native_adapter,
+                s3_meta_request_response_handler_native_adapter_properties.onResponseBodyDirect,
+                jni_payload,
+                (jlong)&body_chunk,
+                range_start,
+                range_end);
+        } else {
+            body_response_result = (*env)->CallIntMethod(
+                env,
+                callback_data->java_s3_meta_request_response_handler_native_adapter,
+                s3_meta_request_response_handler_native_adapter_properties.onResponseBody,
+                jni_payload,
+                range_start,
+                range_end);
+        }
 
         if (aws_jni_get_and_clear_exception(env, &(callback_data->java_exception))) {
             AWS_LOGF_ERROR(
@@ -1204,6 +1240,7 @@ static void s_s3_meta_request_callback_cleanup(
         (*env)->DeleteGlobalRef(env, callback_data->java_s3_meta_request_response_handler_native_adapter);
         (*env)->DeleteGlobalRef(env, callback_data->java_exception);
         aws_signing_config_data_clean_up(&callback_data->signing_config_data, env);
+        aws_jni_body_buffer_pool_release(callback_data->body_buffer_pool);
         aws_mem_release(aws_jni_get_allocator(), callback_data);
     }
 }
@@ -1284,7 +1321,8 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_s3_S3Client_s3ClientMake
     jboolean fio_options_set,
     jboolean should_stream,
     jdouble disk_throughput_gbps,
-    jboolean direct_io) {
+    jboolean direct_io,
+    jboolean direct_response_body) {
     (void)jni_class;
     aws_cache_jni_ids(env);
 
@@ -1327,6 +1365,16 @@ JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_s3_S3Client_s3ClientMake
         (*env)->NewGlobalRef(env, java_response_handler_jobject);
     AWS_FATAL_ASSERT(callback_data->java_s3_meta_request_response_handler_native_adapter != NULL);
 
+    if (direct_response_body) {
+        callback_data->body_buffer_pool =
+            aws_jni_body_buffer_pool_new(allocator, S3_MAX_POOLED_RESPONSE_BODY_BUFFERS);
+        if (callback_data->body_buffer_pool == NULL) {
+            aws_jni_throw_runtime_exception(
+                env, "S3Client.aws_s3_client_make_meta_request: failed to create response body buffer pool");
+            goto done;
+        }
+    }
+
     request_message = aws_http_message_new_request(allocator);
     AWS_FATAL_ASSERT(request_message);
 
@@ -1619,6 +1667,62 @@ JNIEXPORT void JNICALL Java_software_amazon_awssdk_crt_s3_S3MetaRequest_s3MetaRe
     aws_s3_meta_request_increment_read_window(meta_request, (uint64_t)increment);
 }
 
+JNIEXPORT jlong JNICALL Java_software_amazon_awssdk_crt_s3_S3ResponseBody_s3ResponseBodyRetain(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_body_chunk) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct s3_response_body_chunk *body_chunk = (struct s3_response_body_chunk *)jni_body_chunk;
+    if (!body_chunk || !body_chunk->pool) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        aws_jni_throw_illegal_argument_exception(env, "S3ResponseBody.s3ResponseBodyRetain: Invalid/null body chunk");
+        return (jlong)0;
+    }
+
+    struct aws_jni_retained_body_buffer *retained_buffer =
+        aws_jni_body_buffer_pool_retain_copy(body_chunk->pool, body_chunk->body);
+    if (!retained_buffer) {
+        aws_jni_throw_out_of_memory_exception(env, "S3ResponseBody.s3ResponseBodyRetain: Failed to retain body");
+        return (jlong)0;
+    }
+
+    return (jlong)retained_buffer;
+}
+
+JNIEXPORT jobject JNICALL Java_software_amazon_awssdk_crt_s3_S3ResponseBody_s3ResponseBodyGetBuffer(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_retained_buffer) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct aws_jni_retained_body_buffer *retained_buffer = (struct aws_jni_retained_body_buffer *)jni_retained_buffer;
+    if (!retained_buffer) {
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        aws_jni_throw_illegal_argument_exception(
+            env, "S3ResponseBody.s3ResponseBodyGetBuffer: Invalid/null retained buffer");
+        return NULL;
+    }
+
+    return (*env)->NewDirectByteBuffer(
+        env, (void *)retained_buffer->buffer.buffer, (jlong)retained_buffer->buffer.len);
+}
+
+JNIEXPORT void JNICALL Java_software_amazon_awssdk_crt_s3_S3ResponseBody_s3ResponseBodyRelease(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong jni_retained_buffer) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    aws_jni_retained_body_buffer_release((struct aws_jni_retained_body_buffer *)jni_retained_buffer);
+}
+
 #if UINTPTR_MAX == 0xffffffff
 #    if defined(_MSC_VER)
 #        pragma warning(pop)
@@ -0,0 +1,713 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "sigv4_signer.h"
+
+#include "http_request_utils.h"
+
+#include <aws/auth/credentials.h>
+#include <aws/auth/private/aws_signing.h>
+#include <aws/auth/signable.h>
+#include <aws/auth/signing_config.h>
+#include <aws/auth/signing_result.h>
+#include <aws/cal/hash.h>
+#include <aws/cal/hmac.h>
+#include <aws/common/date_time.h>
+#include <aws/common/encoding.h>
+#include <aws/common/mutex.h>
+#include <aws/common/string.h>
+#include <aws/common/uri.h>
+#include <aws/http/request_response.h>
+#include <aws/io/stream.h>
+
+#define SIGV4_SHA256_LENGTH 32
+#define SIGV4_DATE_LENGTH 8
+
+/* The cache is direct mapped, a colliding scope just replaces the entry in its slot */
+#define SIGV4_KEY_CACHE_SIZE 64
+#define SIGV4_KEY_CACHE_MAX_FIELD_LENGTH 64
+
+static const struct aws_byte_cursor s_algorithm = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("AWS4-HMAC-SHA256");
+static const struct aws_byte_cursor s_key_prefix = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("AWS4");
+static const struct aws_byte_cursor s_scope_terminator = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("aws4_request");
+
+static const struct aws_byte_cursor s_authorization_name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("Authorization");
+static const struct aws_byte_cursor s_amz_date_name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Date");
+static const struct aws_byte_cursor s_security_token_name =
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Security-Token");
+static const struct aws_byte_cursor s_content_sha256_name =
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Content-Sha256");
+static const struct aws_byte_cursor s_signature_param = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("&X-Amz-Signature=");
+
+static const struct aws_byte_cursor s_credential_prefix = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(" Credential=");
+static const struct aws_byte_cursor s_signed_headers_prefix = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(", SignedHeaders=");
+static const struct aws_byte_cursor s_signature_prefix = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(", Signature=");
+
+/* Query params that presigning adds, a caller-supplied one would end up in the URL twice */
+static const struct aws_byte_cursor s_presign_params[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Algorithm"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Credential"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Expires"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Security-Token"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-Signature"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("X-Amz-SignedHeaders"),
+};
+
+/*******************************************************************************
+ * Signing key cache
+ ******************************************************************************/
+
+/* Entries are keyed by a digest of the secret rather than the secret itself, so no secrets are kept around */
+struct sigv4_key_cache_entry {
+    bool in_use;
+    uint8_t secret_digest[SIGV4_SHA256_LENGTH];
+    uint8_t date[SIGV4_DATE_LENGTH];
+    uint8_t region[SIGV4_KEY_CACHE_MAX_FIELD_LENGTH];
+    size_t region_len;
+    uint8_t service[SIGV4_KEY_CACHE_MAX_FIELD_LENGTH];
+    size_t service_len;
+    uint8_t signing_key[AWS_JNI_SIGV4_SIGNING_KEY_LENGTH];
+};
+
+static struct aws_mutex s_key_cache_lock = AWS_MUTEX_INIT;
+static struct sigv4_key_cache_entry s_key_cache[SIGV4_KEY_CACHE_SIZE];
+
+static uint64_t s_fnv1a(uint64_t hash, struct aws_byte_cursor data) {
+    for (size_t i = 0; i < data.len; ++i) {
+        hash ^= data.ptr[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static size_t s_key_cache_slot(
+    const uint8_t *secret_digest,
+    struct aws_byte_cursor date,
+    struct aws_byte_cursor region,
+    struct aws_byte_cursor service) {
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = s_fnv1a(hash, aws_byte_cursor_from_array(secret_digest, sizeof(uint64_t)));
+    hash = s_fnv1a(hash, date);
+    hash = s_fnv1a(hash, region);
+    hash = s_fnv1a(hash, service);
+    return (size_t)(hash % SIGV4_KEY_CACHE_SIZE);
+}
+
+static bool s_key_cache_entry_matches(
+    const struct sigv4_key_cache_entry *entry,
+    const uint8_t *secret_digest,
+    struct aws_byte_cursor date,
+    struct aws_byte_cursor region,
+    struct aws_byte_cursor service) {
+
+    struct aws_byte_cursor entry_region = aws_byte_cursor_from_array(entry->region, entry->region_len);
+    struct aws_byte_cursor entry_service = aws_byte_cursor_from_array(entry->service, entry->service_len);
+
+    return entry->in_use && memcmp(entry->secret_digest, secret_digest, SIGV4_SHA256_LENGTH) == 0 &&
+           memcmp(entry->date, date.ptr, SIGV4_DATE_LENGTH) == 0 && aws_byte_cursor_eq(&region, &entry_region) &&
+           aws_byte_cursor_eq(&service, &entry_service);
+}
+
+static int s_hmac_sha256(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor key,
+    struct aws_byte_cursor data,
+    uint8_t *output) {
+
+    struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output, SIGV4_SHA256_LENGTH);
+    return aws_sha256_hmac_compute(allocator, &key, &data, &output_buf, 0);
+}
+
+static int s_derive_signing_key(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor secret,
+    struct aws_byte_cursor date,
+    struct aws_byte_cursor region,
+    struct aws_byte_cursor service,
+    uint8_t *signing_key) {
+
+    int result = AWS_OP_ERR;
+    uint8_t date_key[SIGV4_SHA256_LENGTH];
+    uint8_t region_key[SIGV4_SHA256_LENGTH];
+    uint8_t service_key[SIGV4_SHA256_LENGTH];
+
+    struct aws_byte_buf secret_key;
+    if (aws_byte_buf_init(&secret_key, allocator, s_key_prefix.len + secret.len)) {
+        return AWS_OP_ERR;
+    }
+    aws_byte_buf_write_from_whole_cursor(&secret_key, s_key_prefix);
+    aws_byte_buf_write_from_whole_cursor(&secret_key, secret);
+
+    if (s_hmac_sha256(allocator, aws_byte_cursor_from_buf(&secret_key), date, date_key) ||
+        s_hmac_sha256(allocator, aws_byte_cursor_from_array(date_key, SIGV4_SHA256_LENGTH), region, region_key) ||
+        s_hmac_sha256(allocator, aws_byte_cursor_from_array(region_key, SIGV4_SHA256_LENGTH), service, service_key) ||
+        s_hmac_sha256(
+            allocator, aws_byte_cursor_from_array(service_key, SIGV4_SHA256_LENGTH), s_scope_terminator, signing_key)) {
+        goto done;
+    }
+
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_secure_zero(date_key, sizeof(date_key));
+    aws_secure_zero(region_key, sizeof(region_key));
+    aws_secure_zero(service_key, sizeof(service_key));
+    aws_byte_buf_clean_up_secure(&secret_key);
+    return result;
+}
+
+static int s_get_signing_key(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor secret,
+    struct aws_byte_cursor date,
+    struct aws_byte_cursor region,
+    struct aws_byte_cursor service,
+    uint8_t *signing_key) {
+
+    if (region.len > SIGV4_KEY_CACHE_MAX_FIELD_LENGTH || service.len > SIGV4_KEY_CACHE_MAX_FIELD_LENGTH) {
+        return s_derive_signing_key(allocator, secret, date, region, service, signing_key);
+    }
+
+    uint8_t secret_digest[SIGV4_SHA256_LENGTH];
+    struct aws_byte_buf digest_buf = aws_byte_buf_from_empty_array(secret_digest, sizeof(secret_digest));
+    if (aws_sha256_compute(allocator, &secret, &digest_buf, 0)) {
+        return AWS_OP_ERR;
+    }
+
+    size_t slot = s_key_cache_slot(secret_digest, date, region, service);
+    struct sigv4_key_cache_entry *entry = &s_key_cache[slot];
+
+    bool found = false;
+    aws_mutex_lock(&s_key_cache_lock);
+    if (s_key_cache_entry_matches(entry, secret_digest, date, region, service)) {
+        memcpy(signing_key, entry->signing_key, AWS_JNI_SIGV4_SIGNING_KEY_LENGTH);
+        found = true;
+    }
+    aws_mutex_unlock(&s_key_cache_lock);
+
+    if (found) {
+        return AWS_OP_SUCCESS;
+    }
+
+    /* Derive outside the lock, racing threads just derive the same key */
+    if (s_derive_signing_key(allocator, secret, date, region, service, signing_key)) {
+        return AWS_OP_ERR;
+    }
+
+    aws_mutex_lock(&s_key_cache_lock);
+    entry->in_use = true;
+    memcpy(entry->secret_digest, secret_digest, SIGV4_SHA256_LENGTH);
+    memcpy(entry->date, date.ptr, SIGV4_DATE_LENGTH);
+    memcpy(entry->region, region.ptr, region.len);
+    entry->region_len = region.len;
+    memcpy(entry->service, service.ptr, service.len);
+    entry->service_len = service.len;
+    memcpy(entry->signing_key, signing_key, AWS_JNI_SIGV4_SIGNING_KEY_LENGTH);
+    aws_mutex_unlock(&s_key_cache_lock);
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_jni_sigv4_key_cache_clean_up(void) {
+    /* Entries hold derived signing keys, don't leave them behind in freed or swapped-out memory */
+    aws_mutex_lock(&s_key_cache_lock);
+    aws_secure_zero(s_key_cache, sizeof(s_key_cache));
+    aws_mutex_unlock(&s_key_cache_lock);
+}
+
+/*******************************************************************************
+ * Context and scratch
+ ******************************************************************************/
+
+int aws_jni_sigv4_context_init(
+    struct aws_jni_sigv4_context *context,
+    struct aws_allocator *allocator,
+    const struct aws_signing_config_aws *config) {
+
+    AWS_ZERO_STRUCT(*context);
+    context->allocator = allocator;
+    context->config = config;
+
+    if (config->algorithm != AWS_SIGNING_ALGORITHM_V4 ||
+        (config->signature_type != AWS_ST_HTTP_REQUEST_HEADERS &&
+         config->signature_type != AWS_ST_HTTP_REQUEST_QUERY_PARAMS &&
+         config->signature_type != AWS_ST_HTTP_REQUEST_CHUNK &&
+         config->signature_type != AWS_ST_HTTP_REQUEST_TRAILING_HEADERS) ||
+        config->credentials == NULL || aws_credentials_is_anonymous(config->credentials) || config->region.len == 0 ||
+        config->service.len == 0) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    context->access_key_id = aws_credentials_get_access_key_id(config->credentials);
+    context->session_token = aws_credentials_get_session_token(config->credentials);
+
+    if (aws_byte_buf_init(&context->amz_date, allocator, AWS_DATE_TIME_STR_MAX_LEN) ||
+        aws_date_time_to_utc_time_str(&config->date, AWS_DATE_FORMAT_ISO_8601_BASIC, &context->amz_date) ||
+        context->amz_date.len < SIGV4_DATE_LENGTH) {
+        goto on_error;
+    }
+
+    struct aws_byte_cursor date = aws_byte_cursor_from_array(context->amz_date.buffer, SIGV4_DATE_LENGTH);
+    struct aws_byte_cursor slash = aws_byte_cursor_from_c_str("/");
+
+    if (aws_byte_buf_init(&context->credential, allocator, 128) ||
+        aws_byte_buf_append_dynamic(&context->credential, &context->access_key_id) ||
+        aws_byte_buf_append_dynamic(&context->credential, &slash) ||
+        aws_byte_buf_append_dynamic(&context->credential, &date) ||
+        aws_byte_buf_append_dynamic(&context->credential, &slash) ||
+        aws_byte_buf_append_dynamic(&context->credential, &config->region) ||
+        aws_byte_buf_append_dynamic(&context->credential, &slash) ||
+        aws_byte_buf_append_dynamic(&context->credential, &config->service) ||
+        aws_byte_buf_append_dynamic(&context->credential, &slash) ||
+        aws_byte_buf_append_dynamic(&context->credential, &s_scope_terminator)) {
+        goto on_error;
+    }
+
+    if (s_get_signing_key(
+            allocator,
+            aws_credentials_get_secret_access_key(config->credentials),
+            date,
+            config->region,
+            config->service,
+            context->signing_key)) {
+        goto on_error;
+    }
+
+    return AWS_OP_SUCCESS;
+
+on_error:
+    aws_jni_sigv4_context_clean_up(context);
+    return AWS_OP_ERR;
+}
+
+void aws_jni_sigv4_context_clean_up(struct aws_jni_sigv4_context *context) {
+    aws_byte_buf_clean_up(&context->amz_date);
+    aws_byte_buf_clean_up(&context->credential);
+    aws_secure_zero(context->signing_key, sizeof(context->signing_key));
+}
+
+int aws_jni_sigv4_scratch_init(struct aws_jni_sigv4_scratch *scratch, struct aws_allocator *allocator) {
+    AWS_ZERO_STRUCT(*scratch);
+
+    if (aws_byte_buf_init(&scratch->signature, allocator, 2 * SIGV4_SHA256_LENGTH) ||
+        aws_byte_buf_init(&scratch->authorization, allocator, 256)) {
+        aws_jni_sigv4_scratch_clean_up(scratch);
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_jni_sigv4_scratch_clean_up(struct aws_jni_sigv4_scratch *scratch) {
+    aws_byte_buf_clean_up(&scratch->signature);
+    aws_byte_buf_clean_up(&scratch->authorization);
+}
+
+/*******************************************************************************
+ * Request parsing
+ ******************************************************************************/
+
+static int s_read_marshalled_field(struct aws_byte_cursor *blob, struct aws_byte_cursor *field) {
+    uint32_t field_len = 0;
+    if (!aws_byte_cursor_read_be32(blob, &field_len) || field_len > blob->len) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    *field = aws_byte_cursor_advance(blob, field_len);
+    return AWS_OP_SUCCESS;
+}
+
+int aws_jni_sigv4_request_from_marshalled(struct aws_jni_sigv4_request *request, struct aws_byte_cursor marshalled) {
+    AWS_ZERO_STRUCT(*request);
+
+    uint32_t version = 0;
+    if (!aws_byte_cursor_read_be32(&marshalled, &version) || version == AWS_HTTP_VERSION_2) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (s_read_marshalled_field(&marshalled, &request->method) ||
+        s_read_marshalled_field(&marshalled, &request->path)) {
+        return AWS_OP_ERR;
+    }
+
+    request->marshalled_headers = marshalled;
+    return AWS_OP_SUCCESS;
+}
+
+/* Signing must not silently replace anything the caller already set */
+static bool s_conflicts_with_signing(const struct aws_jni_sigv4_context *context, struct aws_byte_cursor name) {
+    const struct aws_signing_config_aws *config = context->config;
+    bool via_headers = config->signature_type == AWS_ST_HTTP_REQUEST_HEADERS;
+    bool adds_content_sha256 = via_headers && config->signed_body_header == AWS_SBHT_X_AMZ_CONTENT_SHA256;
+
+    return aws_byte_cursor_eq_ignore_case(&name, &s_authorization_name) ||
+           (via_headers && aws_byte_cursor_eq_ignore_case(&name, &s_amz_date_name)) ||
+           (via_headers && context->session_token.len > 0 &&
+            aws_byte_cursor_eq_ignore_case(&name, &s_security_token_name)) ||
+           (adds_content_sha256 && aws_byte_cursor_eq_ignore_case(&name, &s_content_sha256_name));
+}
+
+/* Presigning adds its own X-Amz-* params, the caller's query must not already have any of them */
+static int s_check_presign_query(struct aws_byte_cursor path) {
+    const uint8_t *question_mark = path.len > 0 ? memchr(path.ptr, '?', path.len) : NULL;
+    if (question_mark == NULL) {
+        return AWS_OP_SUCCESS;
+    }
+
+    struct aws_byte_cursor query =
+        aws_byte_cursor_from_array(question_mark + 1, path.len - (size_t)(question_mark - path.ptr) - 1);
+    struct aws_byte_cursor param;
+    AWS_ZERO_STRUCT(param);
+    while (aws_byte_cursor_next_split(&query, '&', &param)) {
+        struct aws_byte_cursor name = param;
+        const uint8_t *equals = param.len > 0 ? memchr(param.ptr, '=', param.len) : NULL;
+        if (equals != NULL) {
+            name.len = (size_t)(equals - param.ptr);
+        }
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(s_presign_params); ++i) {
+            if (aws_byte_cursor_eq_ignore_case(&name, &s_presign_params[i])) {
+                return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static struct aws_http_message *s_new_http_message(
+    const struct aws_jni_sigv4_context *context,
+    const struct aws_jni_sigv4_request *request) {
+
+    if (context->config->signature_type == AWS_ST_HTTP_REQUEST_QUERY_PARAMS && s_check_presign_query(request->path)) {
+        return NULL;
+    }
+
+    struct aws_http_message *message = aws_http_message_new_request(context->allocator);
+    if (message == NULL) {
+        return NULL;
+    }
+
+    if (aws_http_message_set_request_method(message, request->method) ||
+        aws_http_message_set_request_path(message, request->path)) {
+        goto on_error;
+    }
+
+    struct aws_byte_cursor headers = request->marshalled_headers;
+    while (headers.len > 0) {
+        struct aws_http_header header;
+        AWS_ZERO_STRUCT(header);
+        if (s_read_marshalled_field(&headers, &header.name) || s_read_marshalled_field(&headers, &header.value)) {
+            goto on_error;
+        }
+        if (s_conflicts_with_signing(context, header.name)) {
+            aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            goto on_error;
+        }
+        if (aws_http_message_add_header(message, header)) {
+            goto on_error;
+        }
+    }
+
+    return message;
+
+on_error:
+    aws_http_message_release(message);
+    return NULL;
+}
+
+static struct aws_http_headers *s_new_http_headers(
+    struct aws_allocator *allocator,
+    struct aws_byte_cursor marshalled_headers) {
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    if (headers == NULL) {
+        return NULL;
+    }
+
+    while (marshalled_headers.len > 0) {
+        struct aws_byte_cursor name;
+        struct aws_byte_cursor value;
+        if (s_read_marshalled_field(&marshalled_headers, &name) ||
+            s_read_marshalled_field(&marshalled_headers, &value)) {
+            aws_http_headers_release(headers);
+            return NULL;
+        }
+        /* Headers with an empty name are skipped, as HttpHeader.marshalHeadersForJni does */
+        if (name.len > 0 && aws_http_headers_add(headers, name, value)) {
+            aws_http_headers_release(headers);
+            return NULL;
+        }
+    }
+
+    return headers;
+}
+
+/*******************************************************************************
+ * Signing
+ ******************************************************************************/
+
+int aws_jni_sigv4_sign_string(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_byte_cursor string_to_sign,
+    struct aws_byte_buf *signature) {
+
+    uint8_t digest[SIGV4_SHA256_LENGTH];
+    if (s_hmac_sha256(
+            context->allocator,
+            aws_byte_cursor_from_array(context->signing_key, AWS_JNI_SIGV4_SIGNING_KEY_LENGTH),
+            string_to_sign,
+            digest)) {
+        return AWS_OP_ERR;
+    }
+
+    struct aws_byte_cursor digest_cursor = aws_byte_cursor_from_array(digest, sizeof(digest));
+    return aws_hex_encode_append_dynamic(&digest_cursor, signature);
+}
+
+/*
+ * aws-c-auth canonicalizes the signable and builds the string to sign, exactly as the asynchronous signer does. Only
+ * the final HMAC is done here, with the cached signing key, instead of deriving the key all over again.
+ */
+static struct aws_signing_state_aws *s_new_signing_state(
+    const struct aws_jni_sigv4_context *context,
+    enum aws_signature_type signature_type,
+    const struct aws_signable *signable,
+    struct aws_byte_buf *signature) {
+
+    struct aws_signing_config_aws config = *context->config;
+    config.signature_type = signature_type;
+
+    struct aws_signing_state_aws *state = aws_signing_state_new(context->allocator, &config, signable, NULL, NULL);
+    if (state == NULL) {
+        return NULL;
+    }
+
+    if (aws_signing_build_canonical_request(state) || aws_signing_build_string_to_sign(state) ||
+        aws_jni_sigv4_sign_string(context, aws_byte_cursor_from_buf(&state->string_to_sign), signature)) {
+        aws_signing_state_destroy(state);
+        return NULL;
+    }
+
+    return state;
+}
+
+static int s_append_added_query_params(
+    const struct aws_jni_sigv4_context *context,
+    const struct aws_signing_state_aws *state,
+    struct aws_byte_cursor signature,
+    struct aws_byte_buf *output) {
+
+    /* Values come out of aws-c-auth already encoded */
+    struct aws_array_list *params = NULL;
+    aws_signing_result_get_property_list(&state->result, g_aws_http_query_params_property_list_name, &params);
+
+    size_t param_count = params != NULL ? aws_array_list_length(params) : 0;
+    for (size_t i = 0; i < param_count; ++i) {
+        struct aws_signing_result_property param;
+        AWS_ZERO_STRUCT(param);
+        aws_array_list_get_at(params, &param, i);
+
+        struct aws_byte_cursor name = aws_byte_cursor_from_string(param.name);
+        struct aws_byte_cursor value = aws_byte_cursor_from_string(param.value);
+        if ((i > 0 && aws_byte_buf_append_byte_dynamic(output, '&')) || aws_byte_buf_append_dynamic(output, &name) ||
+            aws_byte_buf_append_byte_dynamic(output, '=') || aws_byte_buf_append_dynamic(output, &value)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    if (aws_byte_buf_append_dynamic(output, &s_signature_param) || aws_byte_buf_append_dynamic(output, &signature)) {
+        return AWS_OP_ERR;
+    }
+
+    /* An omitted session token goes on the request unsigned, after the signature */
+    if (context->session_token.len > 0 && context->config->flags.omit_session_token) {
+        if (aws_byte_buf_append_byte_dynamic(output, '&') ||
+            aws_byte_buf_append_dynamic(output, &s_security_token_name) ||
+            aws_byte_buf_append_byte_dynamic(output, '=') ||
+            aws_byte_buf_append_encoding_uri_param(output, &context->session_token)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+#define SIGV4_MAX_ADDED_HEADERS 8
+
+static int s_append_added_headers(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    const struct aws_signing_state_aws *state,
+    struct aws_byte_buf *output) {
+
+    struct aws_byte_buf *authorization = &scratch->authorization;
+    struct aws_byte_cursor credential = aws_byte_cursor_from_buf(&context->credential);
+    struct aws_byte_cursor signed_headers = aws_byte_cursor_from_buf(&state->signed_headers);
+    struct aws_byte_cursor signature = aws_byte_cursor_from_buf(&scratch->signature);
+    aws_byte_buf_reset(authorization, false);
+    if (aws_byte_buf_append_dynamic(authorization, &s_algorithm) ||
+        aws_byte_buf_append_dynamic(authorization, &s_credential_prefix) ||
+        aws_byte_buf_append_dynamic(authorization, &credential) ||
+        aws_byte_buf_append_dynamic(authorization, &s_signed_headers_prefix) ||
+        aws_byte_buf_append_dynamic(authorization, &signed_headers) ||
+        aws_byte_buf_append_dynamic(authorization, &s_signature_prefix) ||
+        aws_byte_buf_append_dynamic(authorization, &signature)) {
+        return AWS_OP_ERR;
+    }
+
+    struct aws_array_list *headers = NULL;
+    aws_signing_result_get_property_list(&state->result, g_aws_http_headers_property_list_name, &headers);
+
+    struct aws_http_header added_headers[SIGV4_MAX_ADDED_HEADERS];
+    AWS_ZERO_ARRAY(added_headers);
+    size_t added_count = 0;
+
+    /* X-Amz-Date, and the signed session token and content hash when there are any */
+    size_t header_count = headers != NULL ? aws_array_list_length(headers) : 0;
+    if (header_count > SIGV4_MAX_ADDED_HEADERS - 2) {
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+    for (size_t i = 0; i < header_count; ++i) {
+        struct aws_signing_result_property header;
+        AWS_ZERO_STRUCT(header);
+        aws_array_list_get_at(headers, &header, i);
+        added_headers[added_count].name = aws_byte_cursor_from_string(header.name);
+        added_headers[added_count++].value = aws_byte_cursor_from_string(header.value);
+    }
+
+    if (context->session_token.len > 0 && context->config->flags.omit_session_token) {
+        added_headers[added_count].name = s_security_token_name;
+        added_headers[added_count++].value = context->session_token;
+    }
+    added_headers[added_count].name = s_authorization_name;
+    added_headers[added_count++].value = aws_byte_cursor_from_buf(authorization);
+
+    return aws_marshal_http_headers_array_to_dynamic_buffer(output, added_headers, added_count);
+}
+
+int aws_jni_sigv4_sign_request(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    const struct aws_jni_sigv4_request *request,
+    struct aws_byte_buf *output) {
+
+    const struct aws_signing_config_aws *config = context->config;
+    if (config->signature_type != AWS_ST_HTTP_REQUEST_HEADERS &&
+        config->signature_type != AWS_ST_HTTP_REQUEST_QUERY_PARAMS) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* Hashing a body stream means reading it, which this signer never does */
+    if (config->signed_body_value.len == 0 && request->has_body) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    int result = AWS_OP_ERR;
+    struct aws_signable *signable = NULL;
+    struct aws_signing_state_aws *state = NULL;
+
+    struct aws_http_message *message = s_new_http_message(context, request);
+    if (message == NULL) {
+        goto done;
+    }
+
+    signable = aws_signable_new_http_request(context->allocator, message);
+    if (signable == NULL) {
+        goto done;
+    }
+
+    aws_byte_buf_reset(&scratch->signature, false);
+    state = s_new_signing_state(context, config->signature_type, signable, &scratch->signature);
+    if (state == NULL) {
+        goto done;
+    }
+
+    if (config->signature_type == AWS_ST_HTTP_REQUEST_QUERY_PARAMS) {
+        result = s_append_added_query_params(context, state, aws_byte_cursor_from_buf(&scratch->signature), output);
+    } else {
+        result = s_append_added_headers(context, scratch, state, output);
+    }
+
+done:
+    if (state != NULL) {
+        aws_signing_state_destroy(state);
+    }
+    aws_signable_destroy(signable);
+    aws_http_message_release(message);
+    return result;
+}
+
+int aws_jni_sigv4_sign_chunk(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    struct aws_byte_cursor previous_signature,
+    struct aws_byte_cursor chunk,
+    struct aws_byte_buf *signature) {
+
+    (void)scratch;
+
+    int result = AWS_OP_ERR;
+    struct aws_signable *signable = NULL;
+
+    struct aws_input_stream *chunk_stream = aws_input_stream_new_from_cursor(context->allocator, &chunk);
+    if (chunk_stream == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    signable = aws_signable_new_chunk(context->allocator, chunk_stream, previous_signature);
+    if (signable == NULL) {
+        goto done;
+    }
+
+    struct aws_signing_state_aws *state =
+        s_new_signing_state(context, AWS_ST_HTTP_REQUEST_CHUNK, signable, signature);
+    if (state == NULL) {
+        goto done;
+    }
+    aws_signing_state_destroy(state);
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_signable_destroy(signable);
+    aws_input_stream_release(chunk_stream);
+    return result;
+}
+
+int aws_jni_sigv4_sign_trailing_headers(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    struct aws_byte_cursor previous_signature,
+    struct aws_byte_cursor marshalled_headers,
+    struct aws_byte_buf *signature) {
+
+    (void)scratch;
+
+    int result = AWS_OP_ERR;
+    struct aws_signable *signable = NULL;
+
+    struct aws_http_headers *headers = s_new_http_headers(context->allocator, marshalled_headers);
+    if (headers == NULL) {
+        return AWS_OP_ERR;
+    }
+
+    signable = aws_signable_new_trailing_headers(context->allocator, headers, previous_signature);
+    if (signable == NULL) {
+        goto done;
+    }
+
+    struct aws_signing_state_aws *state =
+        s_new_signing_state(context, AWS_ST_HTTP_REQUEST_TRAILING_HEADERS, signable, signature);
+    if (state == NULL) {
+        goto done;
+    }
+    aws_signing_state_destroy(state);
+    result = AWS_OP_SUCCESS;
+
+done:
+    aws_signable_destroy(signable);
+    aws_http_headers_release(headers);
+    return result;
+}
@@ -0,0 +1,125 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#ifndef AWS_JNI_CRT_SIGV4_SIGNER_H
+#define AWS_JNI_CRT_SIGV4_SIGNER_H
+
+#include <aws/common/byte_buf.h>
+
+struct aws_signing_config_aws;
+
+#define AWS_JNI_SIGV4_SIGNING_KEY_LENGTH 32
+
+/*
+ * Synchronous SigV4 (HMAC-SHA256) signing, for callers that hold static credentials and can't afford the
+ * asynchronous aws_sign_request_aws() round trip. Everything runs on the calling thread. The derived signing key
+ * is cached process-wide per (secret, date, region, service), so signing many requests with the same credentials
+ * costs two hashes per request.
+ *
+ * Requests can be signed via headers or query params, and aws-chunked bodies chunk by chunk, with a trailer.
+ * Canonicalization is aws-c-auth's, so the result matches aws_sign_request_aws() exactly.
+ */
+struct aws_jni_sigv4_context {
+    struct aws_allocator *allocator;
+    const struct aws_signing_config_aws *config;
+    struct aws_byte_cursor access_key_id;
+    struct aws_byte_cursor session_token;
+
+    /* 20150830T123600Z */
+    struct aws_byte_buf amz_date;
+    /* AKIDEXAMPLE/20150830/us-east-1/service/aws4_request */
+    struct aws_byte_buf credential;
+
+    uint8_t signing_key[AWS_JNI_SIGV4_SIGNING_KEY_LENGTH];
+};
+
+/* Working memory for one request at a time, reused across requests so a batch only allocates as buffers grow */
+struct aws_jni_sigv4_scratch {
+    struct aws_byte_buf signature;
+    struct aws_byte_buf authorization;
+};
+
+/* A request as marshalled by HttpRequestBase.marshalForJni(), HTTP/1.1 only */
+struct aws_jni_sigv4_request {
+    struct aws_byte_cursor method;
+    /* Path and query, as they will be sent */
+    struct aws_byte_cursor path;
+    /* The marshalled headers that follow method and path */
+    struct aws_byte_cursor marshalled_headers;
+    bool has_body;
+};
+
+/*******************************************************************************
+ * aws_jni_sigv4_context_init - Validates the config and derives (or looks up) the signing key. The config and its
+ * credentials must outlive the context. Raises AWS_ERROR_INVALID_ARGUMENT for configs this signer can't handle.
+ * Signing a request needs a header or query-param signature type, chunks and trailers can use any SigV4 config.
+ ******************************************************************************/
+int aws_jni_sigv4_context_init(
+    struct aws_jni_sigv4_context *context,
+    struct aws_allocator *allocator,
+    const struct aws_signing_config_aws *config);
+
+void aws_jni_sigv4_context_clean_up(struct aws_jni_sigv4_context *context);
+
+int aws_jni_sigv4_scratch_init(struct aws_jni_sigv4_scratch *scratch, struct aws_allocator *allocator);
+
+void aws_jni_sigv4_scratch_clean_up(struct aws_jni_sigv4_scratch *scratch);
+
+/*******************************************************************************
+ * aws_jni_sigv4_key_cache_clean_up - Wipes every cached signing key. Called at library clean-up.
+ ******************************************************************************/
+void aws_jni_sigv4_key_cache_clean_up(void);
+
+/*******************************************************************************
+ * aws_jni_sigv4_request_from_marshalled - Splits a marshalled HTTP/1.1 request into method, path and headers
+ * without copying.
+ ******************************************************************************/
+int aws_jni_sigv4_request_from_marshalled(struct aws_jni_sigv4_request *request, struct aws_byte_cursor marshalled);
+
+/*******************************************************************************
+ * aws_jni_sigv4_sign_request - Signs a request and appends only what signing adds to it to output.
+ * For header signing that is the added headers, marshalled the same way as response headers. For query-param
+ * signing that is the added query params, encoded and joined with '&', without a leading separator.
+ * Raises AWS_ERROR_INVALID_ARGUMENT if the request already has a header or query param that signing adds.
+ ******************************************************************************/
+int aws_jni_sigv4_sign_request(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    const struct aws_jni_sigv4_request *request,
+    struct aws_byte_buf *output);
+
+/*******************************************************************************
+ * aws_jni_sigv4_sign_chunk - Appends the hex signature of one aws-chunked body chunk to signature. The previous
+ * signature is the seed (request) signature for the first chunk, and the previous chunk's signature after that.
+ * An empty chunk is the final one.
+ ******************************************************************************/
+int aws_jni_sigv4_sign_chunk(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    struct aws_byte_cursor previous_signature,
+    struct aws_byte_cursor chunk,
+    struct aws_byte_buf *signature);
+
+/*******************************************************************************
+ * aws_jni_sigv4_sign_trailing_headers - Appends the hex signature of an aws-chunked trailer, given as marshalled
+ * headers, to signature. The previous signature is the final chunk's.
+ ******************************************************************************/
+int aws_jni_sigv4_sign_trailing_headers(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_jni_sigv4_scratch *scratch,
+    struct aws_byte_cursor previous_signature,
+    struct aws_byte_cursor marshalled_headers,
+    struct aws_byte_buf *signature);
+
+/*******************************************************************************
+ * aws_jni_sigv4_sign_string - Appends the lowercase hex HMAC-SHA256 of string_to_sign, keyed by the context's
+ * signing key, to signature.
+ ******************************************************************************/
+int aws_jni_sigv4_sign_string(
+    const struct aws_jni_sigv4_context *context,
+    struct aws_byte_cursor string_to_sign,
+    struct aws_byte_buf *signature);
+
+#endif /* AWS_JNI_CRT_SIGV4_SIGNER_H */
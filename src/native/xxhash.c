@@ -125,6 +125,73 @@ on_done:
     return hash;
 }
 
+/* Must match the hash types in XXHash */
+enum xxhash_jni_type {
+    XXHASH_JNI_64 = 0,
+    XXHASH_JNI_3_64 = 1,
+    XXHASH_JNI_3_128 = 2,
+};
+
+#define XXHASH_JNI_MAX_DIGEST_SIZE 16
+
+/*
+ * The native handle held by a streaming XXHash. aws-checksums has no way to reset a hash, so reset swaps in a new
+ * aws_xxhash behind the same handle instead, leaving the Java object and its handle reusable.
+ */
+struct xxhash_jni_state {
+    struct aws_allocator *allocator;
+    enum xxhash_jni_type type;
+    uint64_t seed;
+    struct aws_xxhash *hash;
+};
+
+static struct aws_xxhash *s_xxhash_new(struct aws_allocator *allocator, enum xxhash_jni_type type, uint64_t seed) {
+    switch (type) {
+        case XXHASH_JNI_64:
+            return aws_xxhash64_new(allocator, seed);
+        case XXHASH_JNI_3_64:
+            return aws_xxhash3_64_new(allocator, seed);
+        case XXHASH_JNI_3_128:
+            return aws_xxhash3_128_new(allocator, seed);
+        default:
+            aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            return NULL;
+    }
+}
+
+static int s_xxhash_compute(
+    enum xxhash_jni_type type,
+    uint64_t seed,
+    struct aws_byte_cursor input,
+    struct aws_byte_buf *out) {
+    switch (type) {
+        case XXHASH_JNI_64:
+            return aws_xxhash64_compute(seed, input, out);
+        case XXHASH_JNI_3_64:
+            return aws_xxhash3_64_compute(seed, input, out);
+        case XXHASH_JNI_3_128:
+            return aws_xxhash3_128_compute(seed, input, out);
+        default:
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+}
+
+static jlong s_xxhash_state_new(JNIEnv *env, enum xxhash_jni_type type, uint64_t seed, const char *error_message) {
+    struct aws_allocator *allocator = aws_jni_get_allocator();
+    struct xxhash_jni_state *state = aws_mem_calloc(allocator, 1, sizeof(struct xxhash_jni_state));
+    state->allocator = allocator;
+    state->type = type;
+    state->seed = seed;
+    state->hash = s_xxhash_new(allocator, type, seed);
+    if (state->hash == NULL) {
+        aws_mem_release(allocator, state);
+        aws_jni_throw_runtime_exception(env, error_message);
+        return (jlong)0;
+    }
+
+    return (jlong)state;
+}
+
 JNIEXPORT
 jlong JNICALL
     Java_software_amazon_awssdk_crt_checksums_XXHash_xxHash64Create(JNIEnv *env, jclass jni_class, jlong seed) {
@@ -132,13 +199,8 @@ jlong JNICALL
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = aws_xxhash64_new(aws_jni_get_allocator(), seed);
-    if (hash == NULL) {
-        aws_jni_throw_runtime_exception(env, "XXHash.XXHash64Create: create xxhash64 instance failed");
-        return (jlong)0;
-    }
-
-    return (jlong)hash;
+    return s_xxhash_state_new(
+        env, XXHASH_JNI_64, (uint64_t)seed, "XXHash.XXHash64Create: create xxhash64 instance failed");
 }
 
 JNIEXPORT
@@ -148,13 +210,8 @@ jlong JNICALL
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = aws_xxhash3_64_new(aws_jni_get_allocator(), seed);
-    if (hash == NULL) {
-        aws_jni_throw_runtime_exception(env, "XXHash.XXHash3_64Create: create xxhash3_64 instance failed");
-        return (jlong)0;
-    }
-
-    return (jlong)hash;
+    return s_xxhash_state_new(
+        env, XXHASH_JNI_3_64, (uint64_t)seed, "XXHash.XXHash3_64Create: create xxhash3_64 instance failed");
 }
 
 JNIEXPORT
@@ -164,13 +221,8 @@ jlong JNICALL
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = aws_xxhash3_128_new(aws_jni_get_allocator(), seed);
-    if (hash == NULL) {
-        aws_jni_throw_runtime_exception(env, "XXHash.XXHash3_128Create: create xxhash3_128 instance failed");
-        return (jlong)0;
-    }
-
-    return (jlong)hash;
+    return s_xxhash_state_new(
+        env, XXHASH_JNI_3_128, (uint64_t)seed, "XXHash.XXHash3_128Create: create xxhash3_128 instance failed");
 }
 
 JNIEXPORT
@@ -179,9 +231,39 @@ void JNICALL
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = (struct aws_xxhash *)hash_ptr;
+    struct xxhash_jni_state *state = (struct xxhash_jni_state *)hash_ptr;
+    if (state == NULL) {
+        return;
+    }
+
+    if (state->hash != NULL) {
+        aws_xxhash_destroy(state->hash);
+    }
+    aws_mem_release(state->allocator, state);
+}
+
+JNIEXPORT
+void JNICALL Java_software_amazon_awssdk_crt_checksums_XXHash_xxHashReset(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong hash_ptr,
+    jlong seed) {
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct xxhash_jni_state *state = (struct xxhash_jni_state *)hash_ptr;
+
+    struct aws_xxhash *hash = s_xxhash_new(state->allocator, state->type, (uint64_t)seed);
+    if (hash == NULL) {
+        aws_jni_throw_runtime_exception(env, "XXHash.xxHashReset: failed to reset hash");
+        return;
+    }
 
-    aws_xxhash_destroy(hash);
+    if (state->hash != NULL) {
+        aws_xxhash_destroy(state->hash);
+    }
+    state->hash = hash;
+    state->seed = (uint64_t)seed;
 }
 
 JNIEXPORT
@@ -196,7 +278,7 @@ void JNICALL Java_software_amazon_awssdk_crt_checksums_XXHash_xxHashUpdate(
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = (struct aws_xxhash *)hash_ptr;
+    struct xxhash_jni_state *state = (struct xxhash_jni_state *)hash_ptr;
 
     struct aws_byte_cursor c_byte_array = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, input);
     if (AWS_UNLIKELY(c_byte_array.ptr == NULL)) {
@@ -205,7 +287,7 @@ void JNICALL Java_software_amazon_awssdk_crt_checksums_XXHash_xxHashUpdate(
         struct aws_byte_cursor cursor = c_byte_array;
         aws_byte_cursor_advance(&cursor, offset);
         cursor.len = aws_min_size(length, cursor.len);
-        if (aws_xxhash_update(hash, cursor)) {
+        if (aws_xxhash_update(state->hash, cursor)) {
             aws_jni_throw_runtime_exception(env, "XXHash.xxHashUpdate: failed to update hash");
         }
 
@@ -220,26 +302,142 @@ jbyteArray JNICALL
     (void)jni_class;
     aws_cache_jni_ids(env);
 
-    struct aws_xxhash *hash = (struct aws_xxhash *)hash_ptr;
+    struct xxhash_jni_state *state = (struct xxhash_jni_state *)hash_ptr;
 
-    struct aws_byte_buf hash_buffer;
-    AWS_ZERO_STRUCT(hash_buffer);
-
-    aws_byte_buf_init(&hash_buffer, aws_jni_get_allocator(), 16);
+    uint8_t digest_storage[XXHASH_JNI_MAX_DIGEST_SIZE];
+    struct aws_byte_buf hash_buffer = aws_byte_buf_from_empty_array(digest_storage, sizeof(digest_storage));
 
     jbyteArray hash_out = NULL;
-    if (aws_xxhash_finalize(hash, &hash_buffer)) {
+    if (aws_xxhash_finalize(state->hash, &hash_buffer)) {
         aws_jni_throw_runtime_exception(env, "XXHash.xxHashFinalize: failed to finalize hash");
     } else {
         struct aws_byte_cursor hash_cursor = aws_byte_cursor_from_buf(&hash_buffer);
         hash_out = aws_jni_byte_array_from_cursor(env, &hash_cursor);
     }
 
-    aws_byte_buf_clean_up(&hash_buffer);
-
     return hash_out;
 }
 
+/*
+ * Writes the digest into a caller supplied array rather than allocating one. The Java side checks that the digest
+ * fits at offset.
+ */
+JNIEXPORT
+jint JNICALL Java_software_amazon_awssdk_crt_checksums_XXHash_xxHashFinalizeInto(
+    JNIEnv *env,
+    jclass jni_class,
+    jlong hash_ptr,
+    jbyteArray out,
+    jint offset) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    struct xxhash_jni_state *state = (struct xxhash_jni_state *)hash_ptr;
+
+    uint8_t digest_storage[XXHASH_JNI_MAX_DIGEST_SIZE];
+    struct aws_byte_buf hash_buffer = aws_byte_buf_from_empty_array(digest_storage, sizeof(digest_storage));
+
+    if (aws_xxhash_finalize(state->hash, &hash_buffer)) {
+        aws_jni_throw_runtime_exception(env, "XXHash.xxHashFinalizeInto: failed to finalize hash");
+        return 0;
+    }
+
+    (*env)->SetByteArrayRegion(env, out, offset, (jsize)hash_buffer.len, (const jbyte *)hash_buffer.buffer);
+    return (jint)hash_buffer.len;
+}
+
+/*
+ * Hashes count (offset, length) slices of one input in a single call. The input is either a byte[] or a direct
+ * ByteBuffer, the other is null. 64-bit hashes write one long per slice to out, XXH3-128 writes two, high half first.
+ */
+JNIEXPORT
+void JNICALL Java_software_amazon_awssdk_crt_checksums_XXHash_xxHashComputeBatch(
+    JNIEnv *env,
+    jclass jni_class,
+    jint type,
+    jbyteArray input_array,
+    jobject input_buffer,
+    jintArray offsets,
+    jintArray lengths,
+    jlong seed,
+    jlongArray out) {
+
+    (void)jni_class;
+    aws_cache_jni_ids(env);
+
+    jsize count = (*env)->GetArrayLength(env, offsets);
+    jint *c_offsets = (*env)->GetIntArrayElements(env, offsets, NULL);
+    jint *c_lengths = (*env)->GetIntArrayElements(env, lengths, NULL);
+    jlong *c_out = (*env)->GetLongArrayElements(env, out, NULL);
+    struct aws_byte_cursor c_input;
+    AWS_ZERO_STRUCT(c_input);
+    bool success = false;
+
+    if (c_offsets == NULL || c_lengths == NULL || c_out == NULL) {
+        aws_jni_throw_out_of_memory_exception(env, "XXHash.xxHashComputeBatch: failed to acquire slices");
+        goto done;
+    }
+
+    /* No JNI calls are allowed while the array is held critical, so everything else is acquired first */
+    if (input_array != NULL) {
+        c_input = aws_jni_byte_cursor_from_jbyteArray_critical_acquire(env, input_array);
+    } else {
+        c_input = aws_jni_byte_cursor_from_direct_byte_buffer(env, input_buffer);
+    }
+    if (c_input.ptr == NULL) {
+        /* the acquire helpers throw on failure, an empty input with no slices is fine */
+        if (!(*env)->ExceptionCheck(env)) {
+            if (count > 0) {
+                aws_jni_throw_runtime_exception(env, "XXHash.xxHashComputeBatch: failed to access input bytes");
+            } else {
+                success = true;
+            }
+        }
+        goto done;
+    }
+
+    int digest_longs = type == XXHASH_JNI_3_128 ? 2 : 1;
+    bool hashed = true;
+    for (jsize i = 0; i < count && hashed; ++i) {
+        struct aws_byte_cursor slice = c_input;
+        aws_byte_cursor_advance(&slice, (size_t)c_offsets[i]);
+        slice.len = aws_min_size((size_t)c_lengths[i], slice.len);
+
+        uint8_t digest_storage[XXHASH_JNI_MAX_DIGEST_SIZE];
+        struct aws_byte_buf digest = aws_byte_buf_from_empty_array(digest_storage, sizeof(digest_storage));
+        hashed = s_xxhash_compute((enum xxhash_jni_type)type, (uint64_t)seed, slice, &digest) == AWS_OP_SUCCESS;
+
+        struct aws_byte_cursor digest_cursor = aws_byte_cursor_from_buf(&digest);
+        for (int j = 0; j < digest_longs && hashed; ++j) {
+            uint64_t value = 0;
+            hashed = aws_byte_cursor_read_be64(&digest_cursor, &value);
+            c_out[i * digest_longs + j] = (jlong)value;
+        }
+    }
+
+    if (input_array != NULL) {
+        aws_jni_byte_cursor_from_jbyteArray_critical_release(env, input_array, c_input);
+    }
+
+    if (!hashed) {
+        aws_jni_throw_runtime_exception(env, "XXHash.xxHashComputeBatch: failed to compute hash");
+        goto done;
+    }
+    success = true;
+
+done:
+    if (c_offsets != NULL) {
+        (*env)->ReleaseIntArrayElements(env, offsets, c_offsets, JNI_ABORT);
+    }
+    if (c_lengths != NULL) {
+        (*env)->ReleaseIntArrayElements(env, lengths, c_lengths, JNI_ABORT);
+    }
+    if (c_out != NULL) {
+        (*env)->ReleaseLongArrayElements(env, out, c_out, success ? 0 : JNI_ABORT);
+    }
+}
+
 #if UINTPTR_MAX == 0xffffffff
 #    if defined(_MSC_VER)
 #        pragma warning(pop)
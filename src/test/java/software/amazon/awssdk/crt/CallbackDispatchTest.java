@@ -0,0 +1,107 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+package software.amazon.awssdk.crt;
+
+import org.junit.Assert;
+import org.junit.Assume;
+import org.junit.Test;
+import software.amazon.awssdk.crt.test.CrtTestFixture;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/* In the CRT package, since the dispatch measurement hook is package-private */
+public class CallbackDispatchTest extends CrtTestFixture {
+    public CallbackDispatchTest() {}
+
+    @Test
+    public void testCallbackDispatchFromNativeThreads() {
+        long elapsedNs = CRT.measureCallbackDispatch(4, 1000);
+        Assert.assertTrue(elapsedNs > 0);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCallbackDispatchInvalidThreadCount() {
+        CRT.measureCallbackDispatch(0, 1);
+    }
+
+    /*
+     * Invalidates the cached JNIEnvs while one callback is held in Java. The invalidation has to wait for it, while the
+     * other dispatching threads finish theirs and exit, destroying their caches, which must not wait on the
+     * invalidation in turn.
+     */
+    @Test
+    public void testInvalidateWhileCallbackInFlight() throws Exception {
+        final int threadCount = 4;
+        final AtomicInteger callbacksEntered = new AtomicInteger(0);
+        final CountDownLatch callbackHeld = new CountDownLatch(1);
+        final CountDownLatch releaseCallback = new CountDownLatch(1);
+
+        CRT.callbackDispatchHook = () -> {
+            if (callbacksEntered.incrementAndGet() != 1) {
+                return;
+            }
+
+            try {
+                /* every thread has made its cached acquire before the invalidation starts */
+                while (callbacksEntered.get() < threadCount) {
+                    Thread.sleep(1);
+                }
+                callbackHeld.countDown();
+                releaseCallback.await();
+            } catch (InterruptedException ex) {
+                Thread.currentThread().interrupt();
+            }
+        };
+
+        ExecutorService executor = Executors.newFixedThreadPool(2);
+        try {
+            Future<Long> dispatch = executor.submit(() -> CRT.measureCallbackDispatch(threadCount, 1));
+            Assert.assertTrue(callbackHeld.await(10, TimeUnit.SECONDS));
+
+            Future<?> invalidation = executor.submit(CRT::invalidateThreadEnvCaches);
+            Thread.sleep(200);
+            Assert.assertFalse(invalidation.isDone());
+
+            releaseCallback.countDown();
+            invalidation.get(10, TimeUnit.SECONDS);
+            Assert.assertTrue(dispatch.get(10, TimeUnit.SECONDS) > 0);
+
+            /* later callbacks fall back to the JVM table and re-cache their env */
+            Assert.assertTrue(CRT.measureCallbackDispatch(threadCount, 10) > 0);
+        } finally {
+            CRT.callbackDispatchHook = null;
+            releaseCallback.countDown();
+            executor.shutdownNow();
+        }
+    }
+
+    /*
+     * Reports the average cost of a native-to-Java callback as the number of concurrently dispatching threads grows.
+     * Run with -Daws.crt.jni.benchmark, optionally -Daws.crt.jni.benchmark.threads and .callbacks
+     */
+    @Test
+    public void benchmarkCallbackDispatch() {
+        Assume.assumeNotNull(System.getProperty("aws.crt.jni.benchmark"));
+
+        final int maxThreads = Integer.parseInt(System.getProperty("aws.crt.jni.benchmark.threads",
+                Integer.toString(Runtime.getRuntime().availableProcessors())));
+        final int callbacksPerThread = Integer.parseInt(
+                System.getProperty("aws.crt.jni.benchmark.callbacks", "1000000"));
+
+        /* warm up the JIT for the callback path */
+        CRT.measureCallbackDispatch(1, callbacksPerThread);
+
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            long elapsedNs = CRT.measureCallbackDispatch(threads, callbacksPerThread);
+            double nsPerCallback = elapsedNs / ((double) threads * callbacksPerThread);
+            System.out.println(String.format("%3d threads: %.1f ns per callback", threads, nsPerCallback));
+        }
+    }
+}
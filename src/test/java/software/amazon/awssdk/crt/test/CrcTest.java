@@ -8,6 +8,19 @@ package software.amazon.awssdk.crt.test;
 import org.junit.Test;
 import static org.junit.Assert.*;
 
+import java.nio.ByteBuffer;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Random;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.zip.Checksum;
+
+import software.amazon.awssdk.crt.checksums.CRC32;
+import software.amazon.awssdk.crt.checksums.CRC32C;
+import software.amazon.awssdk.crt.checksums.CRC64NVME;
+import software.amazon.awssdk.crt.checksums.ParallelChecksum;
+
 public class CrcTest extends CrtTestFixture {
     public CrcTest() {
     }
@@ -213,4 +226,178 @@ public class CrcTest extends CrtTestFixture {
         long expected = 0xB9D9D4A8492CBD7FL;
         assertEquals(expected, crc64.getValue());
     }
+
+    private static byte[] randomBytes(int size) {
+        byte[] data = new byte[size];
+        new Random(size).nextBytes(data);
+        return data;
+    }
+
+    private static ByteBuffer directCopy(byte[] data, int offset, int length) {
+        ByteBuffer buffer = ByteBuffer.allocateDirect(length);
+        buffer.put(data, offset, length);
+        buffer.flip();
+        return buffer;
+    }
+
+    @Test
+    public void testCrcByteBufferMatchesArray() {
+        byte[] data = randomBytes(100_000);
+        Checksum[][] checksums = new Checksum[][] {
+            { new CRC32(), new CRC32(), new CRC32(), new CRC32() },
+            { new CRC32C(), new CRC32C(), new CRC32C(), new CRC32C() },
+            { new CRC64NVME(), new CRC64NVME(), new CRC64NVME(), new CRC64NVME() },
+        };
+
+        for (Checksum[] variants : checksums) {
+            variants[0].update(data, 0, data.length);
+
+            ByteBuffer direct = directCopy(data, 0, data.length);
+            update(variants[1], direct);
+            assertFalse(direct.hasRemaining());
+
+            ByteBuffer heap = ByteBuffer.wrap(data);
+            update(variants[2], heap);
+            assertFalse(heap.hasRemaining());
+
+            ByteBuffer readOnly = ByteBuffer.wrap(data).asReadOnlyBuffer();
+            update(variants[3], readOnly);
+            assertFalse(readOnly.hasRemaining());
+
+            assertEquals(variants[0].getValue(), variants[1].getValue());
+            assertEquals(variants[0].getValue(), variants[2].getValue());
+            assertEquals(variants[0].getValue(), variants[3].getValue());
+        }
+    }
+
+    @Test
+    public void testCrcByteBufferRespectsPositionAndLimit() {
+        byte[] data = randomBytes(4096);
+        java.util.zip.CRC32 crcj = new java.util.zip.CRC32();
+        crcj.update(data, 100, 1000);
+
+        ByteBuffer direct = directCopy(data, 0, data.length);
+        direct.position(100);
+        direct.limit(1100);
+        CRC32 crcc = new CRC32();
+        crcc.update(direct);
+
+        assertEquals(crcj.getValue(), crcc.getValue());
+        assertEquals(1100, direct.position());
+    }
+
+    @Test
+    public void testCrcByteBufferArray() {
+        byte[] data = randomBytes(300_000);
+        CRC64NVME expected = new CRC64NVME();
+        expected.update(data);
+
+        ByteBuffer[] direct = new ByteBuffer[] {
+            directCopy(data, 0, 1),
+            directCopy(data, 1, 0),
+            directCopy(data, 1, 150_000),
+            directCopy(data, 150_001, data.length - 150_001),
+        };
+        CRC64NVME scattered = new CRC64NVME();
+        scattered.update(direct);
+        assertEquals(expected.getValue(), scattered.getValue());
+        for (ByteBuffer buffer : direct) {
+            assertFalse(buffer.hasRemaining());
+        }
+
+        ByteBuffer[] mixed = new ByteBuffer[] {
+            directCopy(data, 0, 1000),
+            ByteBuffer.wrap(data, 1000, data.length - 1000),
+        };
+        CRC64NVME mixedChecksum = new CRC64NVME();
+        mixedChecksum.update(mixed);
+        assertEquals(expected.getValue(), mixedChecksum.getValue());
+    }
+
+    @Test
+    public void testCrcLargeArrayIsChunked() {
+        /* Bigger than the native critical section chunk, with an offset that doesn't line up with it */
+        byte[] data = randomBytes(5 * 1024 * 1024 + 17);
+        java.util.zip.CRC32 crcj = new java.util.zip.CRC32();
+        crcj.update(data, 3, data.length - 3);
+        CRC32 crcc = new CRC32();
+        crcc.update(data, 3, data.length - 3);
+        assertEquals(crcj.getValue(), crcc.getValue());
+    }
+
+    @Test
+    public void testCrcCombine() {
+        byte[] data = randomBytes(10_000);
+        int[] splits = { 0, 1, 4096, 9_999, 10_000 };
+
+        for (int split : splits) {
+            java.util.zip.CRC32 whole = new java.util.zip.CRC32();
+            whole.update(data, 0, data.length);
+
+            CRC32 crc32A = new CRC32();
+            crc32A.update(data, 0, split);
+            CRC32 crc32B = new CRC32();
+            crc32B.update(data, split, data.length - split);
+            assertEquals(whole.getValue(),
+                    CRC32.combine(crc32A.getValue(), crc32B.getValue(), data.length - split));
+
+            CRC32C crc32cWhole = new CRC32C();
+            crc32cWhole.update(data);
+            CRC32C crc32cA = new CRC32C();
+            crc32cA.update(data, 0, split);
+            CRC32C crc32cB = new CRC32C();
+            crc32cB.update(data, split, data.length - split);
+            assertEquals(crc32cWhole.getValue(),
+                    CRC32C.combine(crc32cA.getValue(), crc32cB.getValue(), data.length - split));
+
+            CRC64NVME crc64Whole = new CRC64NVME();
+            crc64Whole.update(data);
+            CRC64NVME crc64A = new CRC64NVME();
+            crc64A.update(data, 0, split);
+            CRC64NVME crc64B = new CRC64NVME();
+            crc64B.update(data, split, data.length - split);
+            assertEquals(crc64Whole.getValue(),
+                    CRC64NVME.combine(crc64A.getValue(), crc64B.getValue(), data.length - split));
+        }
+    }
+
+    @Test
+    public void testParallelChecksum() throws Exception {
+        byte[] data = randomBytes(1_000_003);
+        CRC32C expectedCrc32c = new CRC32C();
+        expectedCrc32c.update(data);
+        CRC64NVME expectedCrc64 = new CRC64NVME();
+        expectedCrc64.update(data);
+
+        ExecutorService executor = Executors.newFixedThreadPool(4);
+        Path file = Files.createTempFile("crc-parallel", ".bin");
+        try {
+            ByteBuffer direct = directCopy(data, 0, data.length);
+            assertEquals(expectedCrc32c.getValue(),
+                    ParallelChecksum.checksum(ParallelChecksum.Algorithm.CRC32C, direct, 65536, executor));
+            assertFalse(direct.hasRemaining());
+
+            assertEquals(expectedCrc64.getValue(), ParallelChecksum.checksum(ParallelChecksum.Algorithm.CRC64NVME,
+                    ByteBuffer.wrap(data), 100_000, executor));
+
+            Files.write(file, data);
+            assertEquals(expectedCrc64.getValue(),
+                    ParallelChecksum.checksum(ParallelChecksum.Algorithm.CRC64NVME, file, 65536, executor));
+
+            assertEquals(0, ParallelChecksum.checksum(ParallelChecksum.Algorithm.CRC32, ByteBuffer.allocate(0)));
+        } finally {
+            executor.shutdown();
+            Files.delete(file);
+        }
+    }
+
+    private static void update(Checksum checksum, ByteBuffer buffer) {
+        if (checksum instanceof CRC32) {
+            ((CRC32) checksum).update(buffer);
+        } else if (checksum instanceof CRC32C) {
+            ((CRC32C) checksum).update(buffer);
+        } else {
+            ((CRC64NVME) checksum).update(buffer);
+        }
+    }
 }
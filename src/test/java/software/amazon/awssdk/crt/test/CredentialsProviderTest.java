@@ -24,6 +24,7 @@ import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.List;
 import java.util.concurrent.*;
+import java.util.concurrent.atomic.AtomicInteger;
 
 import software.amazon.awssdk.crt.Log;
 
@@ -158,6 +159,74 @@ public class CredentialsProviderTest extends CrtTestFixture {
         }
     }
 
+    @Test
+    public void testStaticCredentialsIdentityReused() {
+        StaticCredentialsProvider.StaticCredentialsProviderBuilder builder = new StaticCredentialsProvider.StaticCredentialsProviderBuilder();
+        builder.withAccessKeyId(ACCESS_KEY_ID.getBytes());
+        builder.withSecretAccessKey(SECRET_ACCESS_KEY.getBytes());
+        builder.withSessionToken(SESSION_TOKEN.getBytes());
+
+        try (StaticCredentialsProvider provider = builder.build()) {
+            Credentials first = provider.getCredentials().get();
+            Credentials second = provider.getCredentials().get();
+            assertSame(first, second);
+            assertTrue(Arrays.equals(second.getSecretAccessKey(), SECRET_ACCESS_KEY.getBytes()));
+        } catch (Exception ex) {
+            fail(ex.getMessage());
+        }
+    }
+
+    @Test
+    public void testCacheRefreshAheadFromGetCredentialsNow() {
+        final AtomicInteger fetchCount = new AtomicInteger(0);
+        DelegateCredentialsProvider.DelegateCredentialsProviderBuilder builder = new DelegateCredentialsProvider.DelegateCredentialsProviderBuilder();
+        builder.withHandler(new DelegateCredentialsHandler() {
+            @Override
+            public Credentials getCredentials() {
+                int fetch = fetchCount.incrementAndGet();
+                /*
+                 * The first credentials expire sooner than the refresh lead time, so they are due for refresh halfway
+                 * through their lifetime, and still valid for at least half a second after that.
+                 */
+                long lifetimeSecs = fetch == 1 ? 2 : 3600;
+                String accessKeyId = ACCESS_KEY_ID + fetch;
+                return new Credentials(accessKeyId.getBytes(), SECRET_ACCESS_KEY.getBytes(),
+                        SESSION_TOKEN.getBytes(), System.currentTimeMillis() / 1000 + lifetimeSecs);
+            }
+        });
+
+        try (DelegateCredentialsProvider provider = builder.build()) {
+            CachedCredentialsProvider.CachedCredentialsProviderBuilder cachedBuilder = new CachedCredentialsProvider.CachedCredentialsProviderBuilder();
+            cachedBuilder.withCachingDurationInSeconds(900);
+            cachedBuilder.withRefreshBeforeExpiryInSeconds(3600);
+            cachedBuilder.withCachedProvider(provider);
+
+            try (CachedCredentialsProvider cachedProvider = cachedBuilder.build()) {
+                assertNull(cachedProvider.getCredentialsNow());
+
+                Credentials credentials = cachedProvider.getCredentials().get();
+                assertTrue(Arrays.equals(credentials.getAccessKeyId(), (ACCESS_KEY_ID + "1").getBytes()));
+                assertEquals(1, fetchCount.get());
+
+                // Only getCredentialsNow() is called from here on, so it has to start the refresh itself
+                long deadline = System.currentTimeMillis() + 10000;
+                do {
+                    credentials = cachedProvider.getCredentialsNow();
+                    assertNotNull(credentials);
+                    if (Arrays.equals(credentials.getAccessKeyId(), (ACCESS_KEY_ID + "2").getBytes())) {
+                        break;
+                    }
+                    Thread.sleep(10);
+                } while (System.currentTimeMillis() < deadline);
+
+                assertTrue(Arrays.equals(credentials.getAccessKeyId(), (ACCESS_KEY_ID + "2").getBytes()));
+                assertEquals(2, fetchCount.get());
+            }
+        } catch (Exception ex) {
+            fail(ex.getMessage());
+        }
+    }
+
     @Test
     public void testDelegate() {
         final long expireTime = 123456;
@@ -8,8 +8,10 @@ import software.amazon.awssdk.crt.io.ServerBootstrap;
 import software.amazon.awssdk.crt.io.SocketOptions;
 
 import java.io.IOException;
+import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
+import java.util.Collections;
 import java.util.List;
 import java.util.concurrent.*;
 import java.util.concurrent.locks.Condition;
@@ -659,4 +661,594 @@ public class EventStreamClientConnectionTest extends CrtTestFixture {
         elGroup.getShutdownCompleteFuture().get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
         socketOptions.close();
     }
+
+    @Test
+    public void testContinuationDirectMessageHandling() throws ExecutionException, InterruptedException, IOException, TimeoutException {
+        SocketOptions socketOptions = new SocketOptions();
+        socketOptions.connectTimeoutMs = 3000;
+        socketOptions.domain = SocketOptions.SocketDomain.IPv4;
+        socketOptions.type = SocketOptions.SocketType.STREAM;
+
+        EventLoopGroup elGroup = new EventLoopGroup(1);
+        ServerBootstrap bootstrap = new ServerBootstrap(elGroup);
+        ClientBootstrap clientBootstrap = new ClientBootstrap(elGroup, null);
+
+        final String[] receivedContinuationPayload = new String[]{null};
+        final List<Header>[] receivedHeadersServer = new List[]{null};
+
+        Header serverStrHeader = Header.createHeader("serverStrHeaderName", "serverStrHeaderValue");
+        Header serverIntHeader = Header.createHeader("serverIntHeaderName", 25);
+        List<Header> responseHeaderList = new ArrayList<>();
+        responseHeaderList.add(serverStrHeader);
+        responseHeaderList.add(serverIntHeader);
+        MessageHeaders responseHeaders = new MessageHeaders(responseHeaderList);
+
+        final byte[] responsePayload = "{ \"message\": \"this is a response message\" }".getBytes(StandardCharsets.UTF_8);
+        /* offset into the buffer, to check only the remaining bytes are sent */
+        final ByteBuffer responseBuffer = ByteBuffer.allocateDirect(responsePayload.length + 4);
+        responseBuffer.position(4);
+        responseBuffer.put(responsePayload);
+        responseBuffer.position(4);
+
+        final ServerConnection[] serverConnections = {null};
+        Lock semaphoreLock = new ReentrantLock();
+        Condition semaphore = semaphoreLock.newCondition();
+
+        ServerListener listener = new ServerListener("127.0.0.1", (short)8044, socketOptions, null, bootstrap, new ServerListenerHandler() {
+            private ServerConnectionHandler connectionHandler = null;
+
+            public ServerConnectionHandler onNewConnection(ServerConnection serverConnection, int errorCode) {
+                serverConnections[0] = serverConnection;
+                connectionHandler = new ServerConnectionHandler(serverConnection) {
+
+                    @Override
+                    protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                        connection.sendProtocolMessage(null, null, MessageType.ConnectAck, MessageFlags.ConnectionAccepted.getByteValue());
+                    }
+
+                    @Override
+                    protected ServerConnectionContinuationHandler onIncomingStream(ServerConnectionContinuation continuation, String operationName) {
+                        return new ServerConnectionContinuationHandler(continuation) {
+                            @Override
+                            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                                receivedContinuationPayload[0] = new String(payload, StandardCharsets.UTF_8);
+
+                                continuation.sendMessageDirect(responseHeaders, responseBuffer,
+                                        MessageType.ApplicationMessage,
+                                        MessageFlags.TerminateStream.getByteValue())
+                                        .whenComplete((res, ex) ->  {
+                                            connection.closeConnection(0);
+                                            this.close();
+                                        });
+                            }
+                        };
+                    }
+                };
+
+                semaphoreLock.lock();
+                semaphore.signal();
+                semaphoreLock.unlock();
+                return connectionHandler;
+            }
+
+            public void onConnectionShutdown(ServerConnection serverConnection, int errorCode) {
+            }
+        });
+
+        final ClientConnection[] clientConnectionArray = {null};
+        final List<Header>[] clientReceivedMessageHeaders = new List[]{null};
+        final byte[][] clientReceivedPayload = {null};
+        final boolean[] clientContinuationClosed = {false};
+
+        CompletableFuture<Void> connectFuture = ClientConnection.connect("127.0.0.1", (short)8044, socketOptions, null, clientBootstrap, new ClientConnectionHandler() {
+            @Override
+            protected void onConnectionSetup(ClientConnection connection, int errorCode) {
+                clientConnectionArray[0] = connection;
+            }
+
+            @Override
+            protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                semaphoreLock.lock();
+                semaphore.signal();
+                semaphoreLock.unlock();
+            }
+        });
+
+        connectFuture.get(1, TimeUnit.SECONDS);
+        assertNotNull(clientConnectionArray[0]);
+        semaphoreLock.lock();
+        semaphore.await(1, TimeUnit.SECONDS);
+        assertNotNull(serverConnections[0]);
+        clientConnectionArray[0].sendProtocolMessage(null, null, MessageType.Connect, 0);
+        semaphore.await(1, TimeUnit.SECONDS);
+
+        ClientConnectionContinuation continuation = clientConnectionArray[0].newStream(new ClientConnectionContinuationHandler() {
+            @Override
+            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                semaphoreLock.lock();
+                clientReceivedMessageHeaders[0] = headers;
+                clientReceivedPayload[0] = payload;
+                semaphoreLock.unlock();
+            }
+
+            @Override
+            protected void onContinuationClosed() {
+                semaphoreLock.lock();
+                clientContinuationClosed[0] = true;
+                semaphore.signal();
+                semaphoreLock.unlock();
+                super.onContinuationClosed();
+            }
+        });
+        assertNotNull(continuation);
+
+        /* closed headers are rejected before anything reaches native code */
+        MessageHeaders closedHeaders = new MessageHeaders(responseHeaderList);
+        closedHeaders.close();
+        try {
+            continuation.sendMessageDirect(closedHeaders, null, MessageType.ApplicationMessage, 0);
+            fail("sendMessageDirect must reject closed MessageHeaders");
+        } catch (IllegalStateException expected) {
+        }
+
+        final byte[] operationPayload = "{\"message\": \"message payload\"}".getBytes(StandardCharsets.UTF_8);
+        continuation.activate("testOperation", null, operationPayload, MessageType.ApplicationMessage, 0).get(1, TimeUnit.SECONDS);
+        semaphore.await(1, TimeUnit.SECONDS);
+
+        assertArrayEquals(responsePayload, clientReceivedPayload[0]);
+        assertEquals(4, responseBuffer.position());
+        assertNotNull(clientReceivedMessageHeaders[0]);
+        assertEquals(serverStrHeader.getName(), clientReceivedMessageHeaders[0].get(0).getName());
+        assertEquals(serverStrHeader.getValueAsString(), clientReceivedMessageHeaders[0].get(0).getValueAsString());
+        assertEquals(serverIntHeader.getName(), clientReceivedMessageHeaders[0].get(1).getName());
+        assertEquals(serverIntHeader.getValueAsInt(), clientReceivedMessageHeaders[0].get(1).getValueAsInt());
+        assertTrue(clientContinuationClosed[0]);
+
+        clientConnectionArray[0].getClosedFuture().get(1, TimeUnit.SECONDS);
+        serverConnections[0].getClosedFuture().get(1, TimeUnit.SECONDS);
+        semaphoreLock.unlock();
+        assertEquals(new String(operationPayload, StandardCharsets.UTF_8), receivedContinuationPayload[0]);
+        responseHeaders.close();
+        listener.close();
+        listener.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        bootstrap.close();
+        clientBootstrap.close();
+        clientBootstrap.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        elGroup.close();
+        elGroup.getShutdownCompleteFuture().get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        socketOptions.close();
+    }
+
+    @Test
+    public void testContinuationMessageViewHandling() throws ExecutionException, InterruptedException, IOException, TimeoutException {
+        SocketOptions socketOptions = new SocketOptions();
+        socketOptions.connectTimeoutMs = 3000;
+        socketOptions.domain = SocketOptions.SocketDomain.IPv4;
+        socketOptions.type = SocketOptions.SocketType.STREAM;
+
+        EventLoopGroup elGroup = new EventLoopGroup(1);
+        ServerBootstrap bootstrap = new ServerBootstrap(elGroup);
+        ClientBootstrap clientBootstrap = new ClientBootstrap(elGroup, null);
+
+        final String[] receivedContinuationPayload = new String[]{null};
+        final Header[] receivedHeaderServer = new Header[]{null};
+        final boolean[] missingHeaderServer = {false};
+        final MessageView[] escapedView = {null};
+
+        Header serverStrHeader = Header.createHeader("serverStrHeaderName", "serverStrHeaderValue");
+        Header serverIntHeader = Header.createHeader("serverIntHeaderName", 25);
+
+        final byte[] responsePayload = "{ \"message\": \"this is a response message\" }".getBytes(StandardCharsets.UTF_8);
+        final ServerConnection[] serverConnections = {null};
+        Lock semaphoreLock = new ReentrantLock();
+        Condition semaphore = semaphoreLock.newCondition();
+
+        ServerListener listener = new ServerListener("127.0.0.1", (short)8045, socketOptions, null, bootstrap, new ServerListenerHandler() {
+            private ServerConnectionHandler connectionHandler = null;
+
+            public ServerConnectionHandler onNewConnection(ServerConnection serverConnection, int errorCode) {
+                serverConnections[0] = serverConnection;
+                connectionHandler = new ServerConnectionHandler(serverConnection) {
+
+                    @Override
+                    protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                        connection.sendProtocolMessage(null, null, MessageType.ConnectAck, MessageFlags.ConnectionAccepted.getByteValue());
+                    }
+
+                    @Override
+                    protected ServerConnectionContinuationHandler onIncomingStream(ServerConnectionContinuation continuation, String operationName) {
+                        return new ServerConnectionContinuationHandler(continuation) {
+                            @Override
+                            protected boolean isMessageViewEnabled() {
+                                return true;
+                            }
+
+                            @Override
+                            protected void onContinuationMessage(MessageView message) {
+                                receivedHeaderServer[0] = message.getHeader("clientStrHeaderName");
+                                missingHeaderServer[0] = message.getHeader("notAHeader") == null;
+                                receivedContinuationPayload[0] = StandardCharsets.UTF_8.decode(message.getPayload()).toString();
+                                escapedView[0] = message;
+
+                                List<Header> responseHeaders = new ArrayList<>();
+                                responseHeaders.add(serverStrHeader);
+                                responseHeaders.add(serverIntHeader);
+                                continuation.sendMessage(responseHeaders, responsePayload,
+                                        MessageType.ApplicationMessage,
+                                        MessageFlags.TerminateStream.getByteValue())
+                                        .whenComplete((res, ex) ->  {
+                                            connection.closeConnection(0);
+                                            this.close();
+                                        });
+                            }
+
+                            @Override
+                            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                                fail("message view handler should not receive marshalled messages");
+                            }
+                        };
+                    }
+                };
+
+                semaphoreLock.lock();
+                semaphore.signal();
+                semaphoreLock.unlock();
+                return connectionHandler;
+            }
+
+            public void onConnectionShutdown(ServerConnection serverConnection, int errorCode) {
+            }
+        });
+
+        final ClientConnection[] clientConnectionArray = {null};
+        final List<Header>[] clientReceivedMessageHeaders = new List[]{null};
+        final byte[][] clientReceivedPayload = {null};
+        final boolean[] clientContinuationClosed = {false};
+
+        CompletableFuture<Void> connectFuture = ClientConnection.connect("127.0.0.1", (short)8045, socketOptions, null, clientBootstrap, new ClientConnectionHandler() {
+            @Override
+            protected void onConnectionSetup(ClientConnection connection, int errorCode) {
+                clientConnectionArray[0] = connection;
+            }
+
+            @Override
+            protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                semaphoreLock.lock();
+                semaphore.signal();
+                semaphoreLock.unlock();
+            }
+        });
+
+        connectFuture.get(1, TimeUnit.SECONDS);
+        assertNotNull(clientConnectionArray[0]);
+        semaphoreLock.lock();
+        semaphore.await(1, TimeUnit.SECONDS);
+        assertNotNull(serverConnections[0]);
+        clientConnectionArray[0].sendProtocolMessage(null, null, MessageType.Connect, 0);
+        semaphore.await(1, TimeUnit.SECONDS);
+
+        /* the client opts in too, but relies on the default forwarding to the List<Header> callback */
+        ClientConnectionContinuation continuation = clientConnectionArray[0].newStream(new ClientConnectionContinuationHandler() {
+            @Override
+            protected boolean isMessageViewEnabled() {
+                return true;
+            }
+
+            @Override
+            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                semaphoreLock.lock();
+                clientReceivedMessageHeaders[0] = headers;
+                clientReceivedPayload[0] = payload;
+                semaphoreLock.unlock();
+            }
+
+            @Override
+            protected void onContinuationClosed() {
+                semaphoreLock.lock();
+                clientContinuationClosed[0] = true;
+                semaphore.signal();
+                semaphoreLock.unlock();
+                super.onContinuationClosed();
+            }
+        });
+        assertNotNull(continuation);
+
+        final byte[] operationPayload = "{\"message\": \"message payload\"}".getBytes(StandardCharsets.UTF_8);
+        Header clientStrHeader = Header.createHeader("clientStrHeaderName", "clientStrHeaderValue");
+        List<Header> clientHeaders = new ArrayList<>();
+        clientHeaders.add(Header.createHeader("clientIntHeaderName", 35));
+        clientHeaders.add(clientStrHeader);
+        continuation.activate("testOperation", clientHeaders, operationPayload, MessageType.ApplicationMessage, 0).get(1, TimeUnit.SECONDS);
+        semaphore.await(1, TimeUnit.SECONDS);
+
+        assertArrayEquals(responsePayload, clientReceivedPayload[0]);
+        assertNotNull(clientReceivedMessageHeaders[0]);
+        assertEquals(serverStrHeader.getName(), clientReceivedMessageHeaders[0].get(0).getName());
+        assertEquals(serverStrHeader.getValueAsString(), clientReceivedMessageHeaders[0].get(0).getValueAsString());
+        assertEquals(serverIntHeader.getName(), clientReceivedMessageHeaders[0].get(1).getName());
+        assertEquals(serverIntHeader.getValueAsInt(), clientReceivedMessageHeaders[0].get(1).getValueAsInt());
+        assertTrue(clientContinuationClosed[0]);
+
+        clientConnectionArray[0].getClosedFuture().get(1, TimeUnit.SECONDS);
+        serverConnections[0].getClosedFuture().get(1, TimeUnit.SECONDS);
+        semaphoreLock.unlock();
+        assertNotNull(receivedHeaderServer[0]);
+        assertEquals(clientStrHeader.getValueAsString(), receivedHeaderServer[0].getValueAsString());
+        assertTrue(missingHeaderServer[0]);
+        assertEquals(new String(operationPayload, StandardCharsets.UTF_8), receivedContinuationPayload[0]);
+        assertNotNull(escapedView[0]);
+        try {
+            escapedView[0].getPayload();
+            fail("a MessageView must not be usable after its callback");
+        } catch (IllegalStateException ex) {
+        }
+        listener.close();
+        listener.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        bootstrap.close();
+        clientBootstrap.close();
+        clientBootstrap.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        elGroup.close();
+        elGroup.getShutdownCompleteFuture().get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        socketOptions.close();
+    }
+
+    @Test
+    public void testContinuationDispatcherOrdering() throws Exception {
+        SocketOptions socketOptions = new SocketOptions();
+        socketOptions.connectTimeoutMs = 3000;
+        socketOptions.domain = SocketOptions.SocketDomain.IPv4;
+        socketOptions.type = SocketOptions.SocketType.STREAM;
+
+        EventLoopGroup elGroup = new EventLoopGroup(1);
+        ServerBootstrap bootstrap = new ServerBootstrap(elGroup);
+        ClientBootstrap clientBootstrap = new ClientBootstrap(elGroup, null);
+        ContinuationDispatcher dispatcher = new ContinuationDispatcher(4, 2);
+
+        final int messageCount = 20;
+        final List<String> receivedServer = Collections.synchronizedList(new ArrayList<>());
+        final boolean[] ranOnPool = {true};
+        final CompletableFuture<Void> serverClosed = new CompletableFuture<>();
+
+        ServerListener listener = new ServerListener("127.0.0.1", (short)8046, socketOptions, null, bootstrap, new ServerListenerHandler() {
+            public ServerConnectionHandler onNewConnection(ServerConnection serverConnection, int errorCode) {
+                return new ServerConnectionHandler(serverConnection, dispatcher) {
+                    @Override
+                    protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                        connection.sendProtocolMessage(null, null, MessageType.ConnectAck, MessageFlags.ConnectionAccepted.getByteValue());
+                    }
+
+                    @Override
+                    protected ServerConnectionContinuationHandler onIncomingStream(ServerConnectionContinuation continuation, String operationName) {
+                        return new ServerConnectionContinuationHandler(continuation) {
+                            @Override
+                            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                                if (!(Thread.currentThread() instanceof ForkJoinWorkerThread)) {
+                                    ranOnPool[0] = false;
+                                }
+                                /* slow handler, so the later messages queue up behind it */
+                                try {
+                                    Thread.sleep(5);
+                                } catch (InterruptedException ex) {
+                                    Thread.currentThread().interrupt();
+                                }
+                                receivedServer.add(new String(payload, StandardCharsets.UTF_8));
+
+                                if ((messageFlags & MessageFlags.TerminateStream.getByteValue()) != 0) {
+                                    continuation.sendMessage(null, null, MessageType.ApplicationMessage,
+                                            MessageFlags.TerminateStream.getByteValue());
+                                }
+                            }
+
+                            @Override
+                            protected void onContinuationClosed() {
+                                super.onContinuationClosed();
+                                serverClosed.complete(null);
+                            }
+                        };
+                    }
+                };
+            }
+
+            public void onConnectionShutdown(ServerConnection serverConnection, int errorCode) {
+            }
+        });
+
+        final ClientConnection[] clientConnectionArray = {null};
+        final CompletableFuture<Void> connectAck = new CompletableFuture<>();
+        ClientConnection.connect("127.0.0.1", (short)8046, socketOptions, null, clientBootstrap, new ClientConnectionHandler() {
+            @Override
+            protected void onConnectionSetup(ClientConnection connection, int errorCode) {
+                clientConnectionArray[0] = connection;
+            }
+
+            @Override
+            protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                connectAck.complete(null);
+            }
+        }).get(1, TimeUnit.SECONDS);
+        clientConnectionArray[0].sendProtocolMessage(null, null, MessageType.Connect, 0);
+        connectAck.get(1, TimeUnit.SECONDS);
+
+        final CompletableFuture<Void> clientClosed = new CompletableFuture<>();
+        ClientConnectionContinuation continuation = clientConnectionArray[0].newStream(new ClientConnectionContinuationHandler() {
+            @Override
+            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+            }
+
+            @Override
+            protected void onContinuationClosed() {
+                super.onContinuationClosed();
+                clientClosed.complete(null);
+            }
+        });
+
+        /* everything is sent without waiting for the server, so the backlog runs well past the high-water mark of 2 */
+        List<String> sent = new ArrayList<>();
+        sent.add("0");
+        continuation.activate("testOperation", null, "0".getBytes(StandardCharsets.UTF_8), MessageType.ApplicationMessage, 0);
+        for (int i = 1; i < messageCount; ++i) {
+            sent.add(Integer.toString(i));
+            int flags = i == messageCount - 1 ? MessageFlags.TerminateStream.getByteValue() : 0;
+            continuation.sendMessage(null, Integer.toString(i).getBytes(StandardCharsets.UTF_8), MessageType.ApplicationMessage, flags);
+        }
+
+        clientClosed.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        serverClosed.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        assertEquals(sent, receivedServer);
+        assertTrue(ranOnPool[0]);
+        assertEquals(0, dispatcher.getQueuedMessageCount());
+        assertFalse(dispatcher.isAboveHighWater());
+
+        clientConnectionArray[0].closeConnection(0);
+        clientConnectionArray[0].getClosedFuture().get(1, TimeUnit.SECONDS);
+        listener.close();
+        listener.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        assertTrue(dispatcher.shutdown(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS));
+        bootstrap.close();
+        clientBootstrap.close();
+        clientBootstrap.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        elGroup.close();
+        elGroup.getShutdownCompleteFuture().get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        socketOptions.close();
+    }
+
+    private static ClientConnection connectAndAck(short port, SocketOptions socketOptions,
+                                                  ClientBootstrap clientBootstrap) throws Exception {
+        final ClientConnection[] clientConnectionArray = {null};
+        final CompletableFuture<Void> connectAck = new CompletableFuture<>();
+        ClientConnection.connect("127.0.0.1", port, socketOptions, null, clientBootstrap, new ClientConnectionHandler() {
+            @Override
+            protected void onConnectionSetup(ClientConnection connection, int errorCode) {
+                clientConnectionArray[0] = connection;
+            }
+
+            @Override
+            protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                connectAck.complete(null);
+            }
+        }).get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        clientConnectionArray[0].sendProtocolMessage(null, null, MessageType.Connect, 0);
+        connectAck.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        return clientConnectionArray[0];
+    }
+
+    /* A stalled dispatcher must not stop the event loop from serving the other connections it owns */
+    @Test
+    public void testContinuationDispatcherDoesNotBlockEventLoop() throws Exception {
+        SocketOptions socketOptions = new SocketOptions();
+        socketOptions.connectTimeoutMs = 3000;
+        socketOptions.domain = SocketOptions.SocketDomain.IPv4;
+        socketOptions.type = SocketOptions.SocketType.STREAM;
+
+        /* one event loop, shared by the listener and every connection on both sides */
+        EventLoopGroup elGroup = new EventLoopGroup(1);
+        ServerBootstrap bootstrap = new ServerBootstrap(elGroup);
+        ClientBootstrap clientBootstrap = new ClientBootstrap(elGroup, null);
+
+        final CompletableFuture<Integer> highWater = new CompletableFuture<>();
+        final CompletableFuture<Integer> lowWater = new CompletableFuture<>();
+        ContinuationDispatcher dispatcher = new ContinuationDispatcher(1, 2, new ContinuationDispatcher.QueueListener() {
+            @Override
+            public void onHighWater(int queuedMessages) {
+                highWater.complete(queuedMessages);
+            }
+
+            @Override
+            public void onLowWater(int queuedMessages) {
+                lowWater.complete(queuedMessages);
+            }
+        });
+
+        final short port = 8047;
+        final int messageCount = 6;
+        final CountDownLatch unblockHandler = new CountDownLatch(1);
+        final List<String> receivedServer = Collections.synchronizedList(new ArrayList<>());
+        final CompletableFuture<Void> serverClosed = new CompletableFuture<>();
+
+        ServerListener listener = new ServerListener("127.0.0.1", port, socketOptions, null, bootstrap, new ServerListenerHandler() {
+            public ServerConnectionHandler onNewConnection(ServerConnection serverConnection, int errorCode) {
+                return new ServerConnectionHandler(serverConnection, dispatcher) {
+                    @Override
+                    protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                        connection.sendProtocolMessage(null, null, MessageType.ConnectAck, MessageFlags.ConnectionAccepted.getByteValue());
+                    }
+
+                    @Override
+                    protected ServerConnectionContinuationHandler onIncomingStream(ServerConnectionContinuation continuation, String operationName) {
+                        return new ServerConnectionContinuationHandler(continuation) {
+                            @Override
+                            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+                                /* stall the only pool thread until the test has checked the event loop */
+                                try {
+                                    unblockHandler.await();
+                                } catch (InterruptedException ex) {
+                                    Thread.currentThread().interrupt();
+                                }
+                                receivedServer.add(new String(payload, StandardCharsets.UTF_8));
+                            }
+
+                            @Override
+                            protected void onContinuationClosed() {
+                                super.onContinuationClosed();
+                                serverClosed.complete(null);
+                            }
+                        };
+                    }
+                };
+            }
+
+            public void onConnectionShutdown(ServerConnection serverConnection, int errorCode) {
+            }
+        });
+
+        ClientConnection busyConnection = connectAndAck(port, socketOptions, clientBootstrap);
+        ClientConnectionContinuation continuation = busyConnection.newStream(new ClientConnectionContinuationHandler() {
+            @Override
+            protected void onContinuationMessage(List<Header> headers, byte[] payload, MessageType messageType, int messageFlags) {
+            }
+        });
+
+        List<String> sent = new ArrayList<>();
+        sent.add("0");
+        continuation.activate("testOperation", null, "0".getBytes(StandardCharsets.UTF_8), MessageType.ApplicationMessage, 0);
+        for (int i = 1; i < messageCount; ++i) {
+            sent.add(Integer.toString(i));
+            int flags = i == messageCount - 1 ? MessageFlags.TerminateStream.getByteValue() : 0;
+            continuation.sendMessage(null, Integer.toString(i).getBytes(StandardCharsets.UTF_8), MessageType.ApplicationMessage, flags).get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        }
+
+        assertTrue(highWater.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS) >= 2);
+        assertTrue(dispatcher.isAboveHighWater());
+
+        /* the backlog is past the high-water mark and the pool is stuck, yet the event loop still sets up and answers a new connection */
+        ClientConnection otherConnection = connectAndAck(port, socketOptions, clientBootstrap);
+
+        long deadline = System.nanoTime() + TimeUnit.SECONDS.toNanos(TEST_TIMEOUT_SECONDS);
+        while (dispatcher.getQueuedMessageCount() < messageCount && System.nanoTime() < deadline) {
+            Thread.sleep(10);
+        }
+        assertEquals(messageCount, dispatcher.getQueuedMessageCount());
+        assertTrue(receivedServer.isEmpty());
+
+        unblockHandler.countDown();
+        serverClosed.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        assertTrue(lowWater.get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS) <= 1);
+        assertEquals(sent, receivedServer);
+        assertEquals(0, dispatcher.getQueuedMessageCount());
+        assertFalse(dispatcher.isAboveHighWater());
+
+        otherConnection.closeConnection(0);
+        otherConnection.getClosedFuture().get(1, TimeUnit.SECONDS);
+        busyConnection.closeConnection(0);
+        busyConnection.getClosedFuture().get(1, TimeUnit.SECONDS);
+        listener.close();
+        listener.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        assertTrue(dispatcher.shutdown(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS));
+        bootstrap.close();
+        clientBootstrap.close();
+        clientBootstrap.getShutdownCompleteFuture().get(1, TimeUnit.SECONDS);
+        elGroup.close();
+        elGroup.getShutdownCompleteFuture().get(TEST_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        socketOptions.close();
+    }
 }
@@ -0,0 +1,402 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import software.amazon.awssdk.crt.CRT;
+import software.amazon.awssdk.crt.eventstream.ClientConnection;
+import software.amazon.awssdk.crt.eventstream.ClientConnectionContinuation;
+import software.amazon.awssdk.crt.eventstream.ClientConnectionContinuationHandler;
+import software.amazon.awssdk.crt.eventstream.ClientConnectionHandler;
+import software.amazon.awssdk.crt.eventstream.ContinuationDispatcher;
+import software.amazon.awssdk.crt.eventstream.Header;
+import software.amazon.awssdk.crt.eventstream.MessageFlags;
+import software.amazon.awssdk.crt.eventstream.MessageFlushCallback;
+import software.amazon.awssdk.crt.eventstream.MessageType;
+import software.amazon.awssdk.crt.eventstream.ServerConnection;
+import software.amazon.awssdk.crt.eventstream.ServerConnectionContinuation;
+import software.amazon.awssdk.crt.eventstream.ServerConnectionContinuationHandler;
+import software.amazon.awssdk.crt.eventstream.ServerConnectionHandler;
+import software.amazon.awssdk.crt.eventstream.ServerListener;
+import software.amazon.awssdk.crt.eventstream.ServerListenerHandler;
+import software.amazon.awssdk.crt.io.ClientBootstrap;
+import software.amazon.awssdk.crt.io.EventLoopGroup;
+import software.amazon.awssdk.crt.io.ServerBootstrap;
+import software.amazon.awssdk.crt.io.SocketOptions;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * Runs an in-process event-stream RPC echo server and drives it over loopback with N client connections of M
+ * continuations each. Every continuation sends its messages one at a time and waits for each echo, so the
+ * measured latency is the round trip through both bindings. Reports messages/s, latency percentiles and a latency
+ * histogram, and peak native memory.
+ * <p>
+ * Native memory is sampled from CRT.nativeMemory(), which only reports anything with memory tracing enabled
+ * (-Daws.crt.memory.tracing=1 or 2).
+ * </p>
+ */
+public class EventStreamLoadGenerator implements AutoCloseable {
+
+    private static final long MEMORY_SAMPLE_INTERVAL_MS = 10;
+    private static final long RUN_TIMEOUT_SECONDS = 600;
+    private static final long SHUTDOWN_TIMEOUT_SECONDS = 10;
+    private static final String OPERATION_NAME = "benchmark#Echo";
+    private static final MessageFlushCallback IGNORE_FLUSH = errorCode -> { };
+
+    /**
+     * Outcome of one run
+     */
+    public static class Result {
+        public final int connections;
+        public final int continuations;
+        public final int payloadSize;
+        /* round trips that completed */
+        public final int messages;
+        public final int failures;
+        public final double seconds;
+        /* 0 without memory tracing */
+        public final long peakNativeMemory;
+        private final long[] sortedLatenciesNs;
+
+        Result(int connections, int continuations, int payloadSize, int failures, double seconds,
+                long peakNativeMemory, long[] sortedLatenciesNs) {
+            this.connections = connections;
+            this.continuations = continuations;
+            this.payloadSize = payloadSize;
+            this.messages = sortedLatenciesNs.length;
+            this.failures = failures;
+            this.seconds = seconds;
+            this.peakNativeMemory = peakNativeMemory;
+            this.sortedLatenciesNs = sortedLatenciesNs;
+        }
+
+        public double messagesPerSecond() {
+            return seconds > 0 ? messages / seconds : 0;
+        }
+
+        /**
+         * @return payload bytes per second in each direction
+         */
+        public double megabytesPerSecond() {
+            return messagesPerSecond() * payloadSize / (1024.0 * 1024.0);
+        }
+
+        /**
+         * @param percentile 0 to 100
+         * @return round trip latency at percentile, in microseconds, 0 if nothing completed
+         */
+        public double latencyPercentileUs(double percentile) {
+            if (sortedLatenciesNs.length == 0) {
+                return 0;
+            }
+            int index = (int) Math.ceil(percentile / 100.0 * sortedLatenciesNs.length) - 1;
+            index = Math.min(Math.max(index, 0), sortedLatenciesNs.length - 1);
+            return sortedLatenciesNs[index] / 1000.0;
+        }
+
+        /**
+         * @return round trip latencies counted in power of two microsecond buckets, one "&lt;= bound: count" per line
+         */
+        public String latencyHistogram() {
+            StringBuilder histogram = new StringBuilder();
+            int index = 0;
+            for (long boundUs = 1; index < sortedLatenciesNs.length; boundUs *= 2) {
+                int count = 0;
+                while (index < sortedLatenciesNs.length && sortedLatenciesNs[index] <= boundUs * 1000) {
+                    ++count;
+                    ++index;
+                }
+                if (count > 0) {
+                    histogram.append(String.format("  <= %8dus: %d%n", boundUs, count));
+                }
+            }
+            return histogram.toString();
+        }
+
+        @Override
+        public String toString() {
+            return String.format("%d connections x %d continuations, %d byte payloads: %d/%d round trips ok in "
+                    + "%.2fs, %.0f msg/s, %.2f MB/s each way, latency p50 %.0fus p90 %.0fus p99 %.0fus max %.0fus, "
+                    + "peak native %.1f MB",
+                    connections, continuations, payloadSize, messages, messages + failures, seconds,
+                    messagesPerSecond(), megabytesPerSecond(), latencyPercentileUs(50), latencyPercentileUs(90),
+                    latencyPercentileUs(99), latencyPercentileUs(100), peakNativeMemory / (1024.0 * 1024.0));
+        }
+    }
+
+    private final EventLoopGroup elGroup;
+    private final ServerBootstrap serverBootstrap;
+    private final ClientBootstrap clientBootstrap;
+    private final SocketOptions socketOptions;
+    private final ServerListener listener;
+    private final String host;
+
+    /**
+     * Starts the echo server on an ephemeral port
+     * @param host address to listen on and connect to, e.g. "127.0.0.1"
+     * @param numThreads event loop threads, shared by the server and the clients, 0 for one per core
+     */
+    public EventStreamLoadGenerator(String host, int numThreads) {
+        this(host, numThreads, null);
+    }
+
+    /**
+     * Starts the echo server on an ephemeral port, echoing from a dispatcher's pool
+     * @param host address to listen on and connect to, e.g. "127.0.0.1"
+     * @param numThreads event loop threads, shared by the server and the clients, 0 for one per core
+     * @param dispatcher dispatcher for the server's continuations, or null to echo on the event loops
+     */
+    public EventStreamLoadGenerator(String host, int numThreads, ContinuationDispatcher dispatcher) {
+        this.host = host;
+        socketOptions = new SocketOptions();
+        socketOptions.connectTimeoutMs = 3000;
+        socketOptions.domain = SocketOptions.SocketDomain.IPv4;
+        socketOptions.type = SocketOptions.SocketType.STREAM;
+
+        elGroup = new EventLoopGroup(numThreads);
+        serverBootstrap = new ServerBootstrap(elGroup);
+        clientBootstrap = new ClientBootstrap(elGroup, null);
+        listener = new ServerListener(host, 0, socketOptions, null, serverBootstrap, new EchoListenerHandler(dispatcher));
+    }
+
+    /**
+     * Connects the clients, runs every continuation to completion and disconnects again
+     * @param connections number of client connections
+     * @param continuationsPerConnection concurrent continuations on each connection
+     * @param messagesPerContinuation round trips each continuation makes, at least 1
+     * @param payloadSize payload size of every message, in both directions
+     * @return the run's result
+     */
+    public Result run(int connections, int continuationsPerConnection, int messagesPerContinuation,
+            int payloadSize) throws Exception {
+        byte[] payload = new byte[payloadSize];
+        for (int i = 0; i < payload.length; ++i) {
+            payload[i] = (byte) i;
+        }
+
+        List<ClientConnection> clientConnections = new ArrayList<>(connections);
+        for (int i = 0; i < connections; ++i) {
+            clientConnections.add(connect());
+        }
+
+        AtomicLong peakNativeMemory = new AtomicLong(CRT.nativeMemory());
+        ScheduledExecutorService sampler = Executors.newSingleThreadScheduledExecutor(runnable -> {
+            Thread thread = new Thread(runnable, "EventStreamLoadGenerator-memory");
+            thread.setDaemon(true);
+            return thread;
+        });
+        sampler.scheduleAtFixedRate(() -> peakNativeMemory.accumulateAndGet(CRT.nativeMemory(), Math::max), 0,
+                MEMORY_SAMPLE_INTERVAL_MS, TimeUnit.MILLISECONDS);
+
+        List<EchoStream> streams = new ArrayList<>(connections * continuationsPerConnection);
+        long startNs = System.nanoTime();
+        try {
+            for (ClientConnection connection : clientConnections) {
+                for (int i = 0; i < continuationsPerConnection; ++i) {
+                    EchoStream stream = new EchoStream(payload, messagesPerContinuation);
+                    streams.add(stream);
+                    stream.start(connection);
+                }
+            }
+
+            long deadlineNs = startNs + TimeUnit.SECONDS.toNanos(RUN_TIMEOUT_SECONDS);
+            for (EchoStream stream : streams) {
+                try {
+                    stream.done.get(Math.max(deadlineNs - System.nanoTime(), 0), TimeUnit.NANOSECONDS);
+                } catch (Exception ex) {
+                    /* counted as failures below */
+                }
+            }
+        } finally {
+            sampler.shutdownNow();
+        }
+
+        double seconds = (System.nanoTime() - startNs) / 1e9;
+        peakNativeMemory.accumulateAndGet(CRT.nativeMemory(), Math::max);
+
+        for (ClientConnection connection : clientConnections) {
+            connection.closeConnection(0);
+            connection.getClosedFuture().get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+            connection.close();
+        }
+
+        int failures = 0;
+        int completed = 0;
+        for (EchoStream stream : streams) {
+            synchronized (stream) {
+                completed += stream.received;
+                failures += messagesPerContinuation - stream.received;
+            }
+        }
+
+        long[] latencies = new long[completed];
+        int offset = 0;
+        for (EchoStream stream : streams) {
+            synchronized (stream) {
+                System.arraycopy(stream.latenciesNs, 0, latencies, offset, stream.received);
+                offset += stream.received;
+            }
+        }
+        Arrays.sort(latencies);
+
+        return new Result(connections, continuationsPerConnection, payloadSize, failures, seconds,
+                peakNativeMemory.get(), latencies);
+    }
+
+    @Override
+    public void close() throws Exception {
+        listener.close();
+        listener.getShutdownCompleteFuture().get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        serverBootstrap.close();
+        clientBootstrap.close();
+        clientBootstrap.getShutdownCompleteFuture().get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        elGroup.close();
+        elGroup.getShutdownCompleteFuture().get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        socketOptions.close();
+    }
+
+    /* Connects and completes the event-stream connect handshake */
+    private ClientConnection connect() throws Exception {
+        CompletableFuture<Void> connectAck = new CompletableFuture<>();
+        ClientConnection[] clientConnection = {null};
+
+        ClientConnection.connect(host, listener.getBoundPort(), socketOptions, null, clientBootstrap,
+                new ClientConnectionHandler() {
+                    @Override
+                    protected void onConnectionSetup(ClientConnection connection, int errorCode) {
+                        clientConnection[0] = connection;
+                    }
+
+                    @Override
+                    protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType,
+                            int messageFlags) {
+                        if (messageType == MessageType.ConnectAck) {
+                            connectAck.complete(null);
+                        }
+                    }
+                }).get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+
+        clientConnection[0].sendProtocolMessage(null, null, MessageType.Connect, 0);
+        connectAck.get(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        return clientConnection[0];
+    }
+
+    /*
+     * One client continuation. The first message activates it, each echo sends the next one, and the last is sent
+     * with TerminateStream so the server's echo closes the continuation.
+     */
+    private static class EchoStream extends ClientConnectionContinuationHandler {
+        final CompletableFuture<Void> done = new CompletableFuture<>();
+        final long[] latenciesNs;
+        private final byte[] payload;
+        /* a failed send never gets its echo, so give up on the stream rather than wait for the timeout */
+        private final MessageFlushCallback onFlushed = errorCode -> {
+            if (errorCode != 0) {
+                done.complete(null);
+            }
+        };
+        int received;
+        private long sentNs;
+
+        EchoStream(byte[] payload, int messages) {
+            this.payload = payload;
+            this.latenciesNs = new long[messages];
+        }
+
+        void start(ClientConnection connection) {
+            ClientConnectionContinuation continuation = connection.newStream(this);
+            synchronized (this) {
+                sentNs = System.nanoTime();
+            }
+            try {
+                continuation.activate(OPERATION_NAME, null, payload, MessageType.ApplicationMessage,
+                        flagsFor(0), onFlushed);
+            } catch (RuntimeException ex) {
+                done.complete(null);
+                close();
+            }
+        }
+
+        private int flagsFor(int index) {
+            return index == latenciesNs.length - 1 ? MessageFlags.TerminateStream.getByteValue() : 0;
+        }
+
+        @Override
+        protected void onContinuationMessage(List<Header> headers, byte[] echo, MessageType messageType,
+                int messageFlags) {
+            int next;
+            synchronized (this) {
+                latenciesNs[received] = System.nanoTime() - sentNs;
+                next = ++received;
+                if (next < latenciesNs.length) {
+                    sentNs = System.nanoTime();
+                }
+            }
+
+            if (next < latenciesNs.length && continuation != null) {
+                try {
+                    continuation.sendMessage(null, payload, MessageType.ApplicationMessage, flagsFor(next),
+                            onFlushed);
+                } catch (RuntimeException ex) {
+                    done.complete(null);
+                }
+            }
+        }
+
+        @Override
+        protected void onContinuationClosed() {
+            super.onContinuationClosed();
+            done.complete(null);
+        }
+    }
+
+    /* Echoes every continuation message back, including its TerminateStream flag */
+    private static class EchoListenerHandler extends ServerListenerHandler {
+        private final ContinuationDispatcher dispatcher;
+
+        EchoListenerHandler(ContinuationDispatcher dispatcher) {
+            this.dispatcher = dispatcher;
+        }
+
+        @Override
+        protected ServerConnectionHandler onNewConnection(ServerConnection serverConnection, int errorCode) {
+            return new ServerConnectionHandler(serverConnection, dispatcher) {
+                @Override
+                protected void onProtocolMessage(List<Header> headers, byte[] payload, MessageType messageType,
+                        int messageFlags) {
+                    if (messageType == MessageType.Connect) {
+                        connection.sendProtocolMessage(null, null, MessageType.ConnectAck,
+                                MessageFlags.ConnectionAccepted.getByteValue());
+                    }
+                }
+
+                @Override
+                protected ServerConnectionContinuationHandler onIncomingStream(
+                        ServerConnectionContinuation continuation, String operationName) {
+                    return new ServerConnectionContinuationHandler(continuation) {
+                        @Override
+                        protected void onContinuationMessage(List<Header> headers, byte[] payload,
+                                MessageType messageType, int messageFlags) {
+                            continuation.sendMessage(null, payload, MessageType.ApplicationMessage,
+                                    messageFlags & MessageFlags.TerminateStream.getByteValue(), IGNORE_FLUSH);
+                        }
+                    };
+                }
+            };
+        }
+
+        @Override
+        protected void onConnectionShutdown(ServerConnection serverConnection, int errorCode) {
+        }
+    }
+}
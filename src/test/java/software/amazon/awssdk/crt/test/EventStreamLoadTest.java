@@ -0,0 +1,81 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import org.junit.Assume;
+import org.junit.Test;
+
+import software.amazon.awssdk.crt.eventstream.ContinuationDispatcher;
+
+import static org.junit.Assert.assertEquals;
+
+/**
+ * Event-stream RPC client and server under concurrent load, through a loopback {@link EventStreamLoadGenerator}.
+ */
+public class EventStreamLoadTest extends CrtTestFixture {
+
+    public EventStreamLoadTest() {
+    }
+
+    @Test
+    public void testManyConnectionsAndContinuations() throws Exception {
+        skipIfAndroid();
+        try (EventStreamLoadGenerator generator = new EventStreamLoadGenerator("127.0.0.1", 2)) {
+            EventStreamLoadGenerator.Result result = generator.run(4, 8, 10, 1024);
+
+            assertEquals(0, result.failures);
+            assertEquals(4 * 8 * 10, result.messages);
+        }
+    }
+
+    @Test
+    public void testManyContinuationsWithDispatcher() throws Exception {
+        skipIfAndroid();
+        try (ContinuationDispatcher dispatcher = new ContinuationDispatcher(2, 8);
+                EventStreamLoadGenerator generator = new EventStreamLoadGenerator("127.0.0.1", 2, dispatcher)) {
+            EventStreamLoadGenerator.Result result = generator.run(4, 8, 10, 1024);
+
+            assertEquals(0, result.failures);
+            assertEquals(4 * 8 * 10, result.messages);
+        }
+    }
+
+    /*
+     * Loopback event-stream RPC benchmark, sweeping payload sizes. Configure with -D on the mvn command line, e.g.
+     * -Daws.crt.eventstream.benchmark=1 -Daws.crt.memory.tracing=1 -Daws.crt.eventstream.benchmark.connections=200
+     */
+    @Test
+    public void benchmarkEventStreamServer() throws Exception {
+        Assume.assumeNotNull(System.getProperty("aws.crt.eventstream.benchmark"));
+        skipIfAndroid();
+
+        final int threadCount = Integer.parseInt(System.getProperty("aws.crt.eventstream.benchmark.threads", "0"));
+        final int connections = Integer.parseInt(
+                System.getProperty("aws.crt.eventstream.benchmark.connections", "100"));
+        final int continuations = Integer.parseInt(
+                System.getProperty("aws.crt.eventstream.benchmark.continuations", "4"));
+        final int messages = Integer.parseInt(System.getProperty("aws.crt.eventstream.benchmark.messages", "1000"));
+        /* 0 echoes on the event loops, otherwise the number of ContinuationDispatcher threads */
+        final int dispatcherThreads = Integer.parseInt(
+                System.getProperty("aws.crt.eventstream.benchmark.dispatcherThreads", "0"));
+        final String payloadSizes = System.getProperty("aws.crt.eventstream.benchmark.payloadSizes",
+                "64,1024,16384,262144");
+
+        try (ContinuationDispatcher dispatcher = dispatcherThreads > 0
+                        ? new ContinuationDispatcher(dispatcherThreads, connections * continuations) : null;
+                EventStreamLoadGenerator generator = new EventStreamLoadGenerator("127.0.0.1", threadCount,
+                        dispatcher)) {
+            for (String payloadSize : payloadSizes.split(",")) {
+                EventStreamLoadGenerator.Result result = generator.run(connections, continuations, messages,
+                        Integer.parseInt(payloadSize.trim()));
+
+                System.out.println(result);
+                System.out.print(result.latencyHistogram());
+                assertEquals(0, result.failures);
+            }
+        }
+    }
+}
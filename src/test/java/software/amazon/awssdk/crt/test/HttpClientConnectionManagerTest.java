@@ -248,6 +248,285 @@ public class HttpClientConnectionManagerTest extends HttpClientTestFixture  {
         CrtResource.waitForNoResources();
     }
 
+    @Test
+    public void testAcquireStream() throws Exception {
+        skipIfAndroid();
+        skipIfNetworkUnavailable();
+
+        URI uri = new URI(endpoint);
+
+        try (HttpClientConnectionManager connectionPool = createConnectionManager(uri, 1, 2)) {
+            HttpRequest request = createHttpRequest("GET", endpoint, path, EMPTY_BODY);
+            List<CompletableFuture<Integer>> statusFutures = new ArrayList<>();
+
+            for (int i = 0; i < NUM_REQUESTS / NUM_THREADS; i++) {
+                CompletableFuture<Integer> statusFuture = new CompletableFuture<>();
+                statusFutures.add(statusFuture);
+                AtomicInteger status = new AtomicInteger(0);
+
+                connectionPool.acquireStream(request, new HttpStreamBaseResponseHandler() {
+                    @Override
+                    public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                            HttpHeader[] nextHeaders) {
+                        status.set(responseStatusCode);
+                    }
+
+                    @Override
+                    public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                        stream.close();
+                        if (errorCode != CRT.AWS_CRT_SUCCESS) {
+                            statusFuture.completeExceptionally(new CrtRuntimeException(errorCode));
+                        } else {
+                            statusFuture.complete(status.get());
+                        }
+                    }
+                }).whenComplete((stream, throwable) -> {
+                    if (throwable != null) {
+                        statusFuture.completeExceptionally(throwable);
+                    }
+                });
+            }
+
+            /* More requests than connections, so they only all finish if completed streams return their connection */
+            for (CompletableFuture<Integer> statusFuture : statusFutures) {
+                Assert.assertEquals(EXPECTED_HTTP_STATUS, (int) statusFuture.get(60, TimeUnit.SECONDS));
+            }
+            Assert.assertEquals(0, connectionPool.getManagerMetrics().getPendingConcurrencyAcquires());
+        }
+
+        CrtResource.logNativeResources();
+        CrtResource.waitForNoResources();
+    }
+
+    @Test
+    public void testAcquireStreamPipelined() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+
+        final int numRequests = 8;
+        final int bodySize = 1024;
+
+        /* Slow responses keep the first request in flight while the others are queued up behind it */
+        try (MockHttpServer server = new MockHttpServer().withLatencyMs(100).withResponseBodySize(bodySize);
+                EventLoopGroup eventLoopGroup = new EventLoopGroup(1);
+                HostResolver resolver = new HostResolver(eventLoopGroup);
+                ClientBootstrap bootstrap = new ClientBootstrap(eventLoopGroup, resolver);
+                SocketOptions sockOpts = new SocketOptions()) {
+
+            HttpClientConnectionManagerOptions options = new HttpClientConnectionManagerOptions()
+                    .withClientBootstrap(bootstrap)
+                    .withSocketOptions(sockOpts)
+                    .withUri(server.getEndpoint())
+                    .withMaxConnections(1)
+                    .withMaxPipelinedRequestsPerConnection(4);
+
+            try (HttpClientConnectionManager connectionPool = HttpClientConnectionManager.create(options)) {
+                HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "localhost") };
+                HttpRequest request = new HttpRequest("GET", "/pipelined", headers, null);
+                List<CompletableFuture<Integer>> bodyFutures = new ArrayList<>();
+
+                for (int i = 0; i < numRequests; i++) {
+                    CompletableFuture<Integer> bodyFuture = new CompletableFuture<>();
+                    bodyFutures.add(bodyFuture);
+                    AtomicInteger status = new AtomicInteger(0);
+                    AtomicInteger bodyLength = new AtomicInteger(0);
+
+                    CompletableFuture<HttpStreamBase> streamFuture =
+                            connectionPool.acquireStream(request, new HttpStreamBaseResponseHandler() {
+                        @Override
+                        public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                                HttpHeader[] nextHeaders) {
+                            status.set(responseStatusCode);
+                        }
+
+                        @Override
+                        public int onResponseBody(HttpStreamBase stream, byte[] bodyBytesIn) {
+                            bodyLength.addAndGet(bodyBytesIn.length);
+                            return bodyBytesIn.length;
+                        }
+
+                        @Override
+                        public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                            stream.close();
+                            if (errorCode != CRT.AWS_CRT_SUCCESS || status.get() != EXPECTED_HTTP_STATUS) {
+                                bodyFuture.completeExceptionally(new CrtRuntimeException(errorCode));
+                            } else {
+                                bodyFuture.complete(bodyLength.get());
+                            }
+                        }
+                    });
+                    streamFuture.whenComplete((stream, throwable) -> {
+                        if (throwable != null) {
+                            bodyFuture.completeExceptionally(throwable);
+                        }
+                    });
+
+                    /* Requests only join a connection that is already carrying one, so let the first one get there */
+                    if (i == 0) {
+                        streamFuture.get(60, TimeUnit.SECONDS);
+                    }
+                }
+
+                /* The first response takes 100ms, so the others must be seen queued behind it before it arrives */
+                long maxPipelinedStreams = 0;
+                long deadline = System.currentTimeMillis() + 60000;
+                while (maxPipelinedStreams == 0 && !bodyFutures.get(0).isDone()
+                        && System.currentTimeMillis() < deadline) {
+                    maxPipelinedStreams = Math.max(maxPipelinedStreams,
+                            connectionPool.getManagerMetrics().getPipelinedStreams());
+                    Thread.sleep(1);
+                }
+                Assert.assertTrue(maxPipelinedStreams > 0);
+
+                for (CompletableFuture<Integer> bodyFuture : bodyFutures) {
+                    Assert.assertEquals(bodySize, (int) bodyFuture.get(60, TimeUnit.SECONDS));
+                }
+                Assert.assertEquals(numRequests, server.getRequestCount());
+                Assert.assertEquals(1, server.getConnectionCount());
+                /* The server saw requests arrive on the connection before earlier responses were written */
+                Assert.assertTrue(server.getMaxRequestsInFlightPerConnection() > 1);
+                Assert.assertTrue(server.getMaxRequestsInFlightPerConnection() <= 4);
+                Assert.assertEquals(0, connectionPool.getManagerMetrics().getPipelineFailures());
+            }
+        }
+
+        CrtResource.logNativeResources();
+        CrtResource.waitForNoResources();
+    }
+
+    @Test
+    public void testAdaptivePoolSizing() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+
+        final int numRequests = 40;
+
+        try (MockHttpServer server = new MockHttpServer().withLatencyMs(20).withResponseBodySize(1024);
+                EventLoopGroup eventLoopGroup = new EventLoopGroup(1);
+                HostResolver resolver = new HostResolver(eventLoopGroup);
+                ClientBootstrap bootstrap = new ClientBootstrap(eventLoopGroup, resolver);
+                SocketOptions sockOpts = new SocketOptions()) {
+            /* A target no pool can meet, so the limit grows while requests are held back */
+            HttpAdaptivePoolSizingOptions adaptiveOptions = new HttpAdaptivePoolSizingOptions();
+            adaptiveOptions.setMinConnections(1);
+            adaptiveOptions.setTargetAcquisitionLatencyInMilliseconds(1);
+
+            HttpClientConnectionManagerOptions options = new HttpClientConnectionManagerOptions()
+                    .withClientBootstrap(bootstrap)
+                    .withSocketOptions(sockOpts)
+                    .withUri(server.getEndpoint())
+                    .withMaxConnections(4)
+                    .withMaxConnectionIdleInMilliseconds(1000)
+                    .withAdaptivePoolSizingOptions(adaptiveOptions);
+
+            try (HttpClientConnectionManager connectionPool = HttpClientConnectionManager.create(options)) {
+                Assert.assertEquals(1, connectionPool.getManagerMetrics().getAdaptiveConnectionLimit());
+
+                HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "localhost") };
+                HttpRequest request = new HttpRequest("GET", "/adaptive", headers, null);
+                List<CompletableFuture<Integer>> statusFutures = new ArrayList<>();
+
+                for (int i = 0; i < numRequests; i++) {
+                    CompletableFuture<Integer> statusFuture = new CompletableFuture<>();
+                    statusFutures.add(statusFuture);
+                    AtomicInteger status = new AtomicInteger(0);
+
+                    connectionPool.acquireStream(request, new HttpStreamBaseResponseHandler() {
+                        @Override
+                        public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                                HttpHeader[] nextHeaders) {
+                            status.set(responseStatusCode);
+                        }
+
+                        @Override
+                        public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                            stream.close();
+                            if (errorCode != CRT.AWS_CRT_SUCCESS) {
+                                statusFuture.completeExceptionally(new CrtRuntimeException(errorCode));
+                            } else {
+                                statusFuture.complete(status.get());
+                            }
+                        }
+                    }).whenComplete((stream, throwable) -> {
+                        if (throwable != null) {
+                            statusFuture.completeExceptionally(throwable);
+                        }
+                    });
+                }
+
+                /* Requests beyond the limit are held back, until enough slow acquisitions have raised it */
+                long maxPending = 0;
+                long maxLimit = 0;
+                CompletableFuture<Void> allDone =
+                        CompletableFuture.allOf(statusFutures.toArray(new CompletableFuture<?>[0]));
+                long deadline = System.currentTimeMillis() + 60000;
+                while (!allDone.isDone() && System.currentTimeMillis() < deadline) {
+                    HttpManagerMetrics metrics = connectionPool.getManagerMetrics();
+                    Assert.assertTrue(metrics.getLeasedConcurrency() <= 4);
+                    Assert.assertTrue(metrics.getAdaptiveConnectionLimit() <= 4);
+                    maxPending = Math.max(maxPending, metrics.getPendingConcurrencyAcquires());
+                    maxLimit = Math.max(maxLimit, metrics.getAdaptiveConnectionLimit());
+                    Thread.sleep(1);
+                }
+                Assert.assertTrue(maxPending > 0);
+                Assert.assertTrue(maxLimit > 1);
+
+                for (CompletableFuture<Integer> statusFuture : statusFutures) {
+                    Assert.assertEquals(EXPECTED_HTTP_STATUS, (int) statusFuture.get(60, TimeUnit.SECONDS));
+                }
+                Assert.assertEquals(numRequests, server.getRequestCount());
+                Assert.assertEquals(0, connectionPool.getManagerMetrics().getPendingConcurrencyAcquires());
+            }
+        }
+
+        CrtResource.logNativeResources();
+        CrtResource.waitForNoResources();
+    }
+
+    @Test
+    public void testPrewarm() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+
+        try (MockHttpServer server = new MockHttpServer();
+                EventLoopGroup eventLoopGroup = new EventLoopGroup(1);
+                HostResolver resolver = new HostResolver(eventLoopGroup);
+                ClientBootstrap bootstrap = new ClientBootstrap(eventLoopGroup, resolver);
+                SocketOptions sockOpts = new SocketOptions()) {
+
+            HttpClientConnectionManagerOptions options = new HttpClientConnectionManagerOptions()
+                    .withClientBootstrap(bootstrap)
+                    .withSocketOptions(sockOpts)
+                    .withUri(server.getEndpoint())
+                    .withMaxConnections(4)
+                    .withPrewarmConnections(2);
+
+            try (HttpClientConnectionManager connectionPool = HttpClientConnectionManager.create(options)) {
+                connectionPool.getPrewarmFuture().get(60, TimeUnit.SECONDS);
+                Assert.assertEquals(2, connectionPool.getManagerMetrics().getAvailableConcurrency());
+
+                /* Capped at the pool's maximum, with the two already idle counting toward it */
+                connectionPool.prewarm(10).get(60, TimeUnit.SECONDS);
+                HttpManagerMetrics metrics = connectionPool.getManagerMetrics();
+                Assert.assertEquals(4, metrics.getAvailableConcurrency());
+                Assert.assertEquals(0, metrics.getLeasedConcurrency());
+
+                /* Leased connections are left alone, so prewarming while holding them can't wait on them */
+                try (HttpClientConnection first = connectionPool.acquireConnection().get(60, TimeUnit.SECONDS);
+                        HttpClientConnection second = connectionPool.acquireConnection().get(60, TimeUnit.SECONDS)) {
+                    connectionPool.prewarm(10).get(60, TimeUnit.SECONDS);
+                    metrics = connectionPool.getManagerMetrics();
+                    Assert.assertEquals(2, metrics.getLeasedConcurrency());
+                    Assert.assertEquals(2, metrics.getAvailableConcurrency());
+                    Assert.assertEquals(0, metrics.getPendingConcurrencyAcquires());
+                }
+            }
+        }
+
+        CrtResource.logNativeResources();
+        CrtResource.waitForNoResources();
+    }
+
     @Test
     public void testMaxParallelRequests() throws Exception {
         skipIfAndroid();
@@ -12,17 +12,30 @@ import org.junit.Test;
 import software.amazon.awssdk.crt.CrtResource;
 import software.amazon.awssdk.crt.http.HttpClientConnection;
 import software.amazon.awssdk.crt.http.HttpClientConnectionManager;
+import software.amazon.awssdk.crt.http.HttpClientConnectionManagerOptions;
 import software.amazon.awssdk.crt.http.HttpVersion;
 import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpHeadersView;
 import software.amazon.awssdk.crt.http.HttpRequest;
 import software.amazon.awssdk.crt.http.HttpRequestBodyStream;
+import software.amazon.awssdk.crt.http.HttpResponseBody;
+import software.amazon.awssdk.crt.http.HttpStreamBase;
+import software.amazon.awssdk.crt.http.HttpStreamBaseResponseHandler;
 import software.amazon.awssdk.crt.http.HttpStreamResponseHandler;
 import software.amazon.awssdk.crt.http.HttpStream;
+import software.amazon.awssdk.crt.io.ClientBootstrap;
+import software.amazon.awssdk.crt.io.EventLoopGroup;
+import software.amazon.awssdk.crt.io.HostResolver;
+import software.amazon.awssdk.crt.io.SocketOptions;
 
 import java.net.URI;
 import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
 
 public class HttpRequestResponseTest extends HttpRequestResponseFixture {
     // crt/aws-c-http/tests/mock_server includes a readme on how the server can be
@@ -336,4 +349,290 @@ public class HttpRequestResponseTest extends HttpRequestResponseFixture {
         }
     }
 
+    @Test
+    public void testHttpHeadersView() {
+        HttpHeader[] headers = new HttpHeader[] {
+            new HttpHeader("Content-Length", "1234"),
+            new HttpHeader("x-amz-request-id", "ABCDEF"),
+            new HttpHeader("Set-Cookie", "a=1"),
+            new HttpHeader("set-cookie", "b=2"),
+            new HttpHeader("x-empty", ""),
+        };
+        byte[] marshalled = HttpHeader.marshalHeadersForJni(Arrays.asList(headers));
+        ByteBuffer blob = ByteBuffer.allocateDirect(marshalled.length);
+        blob.put(marshalled);
+        blob.flip();
+
+        HttpHeadersView view = HttpHeadersView.fromMarshalledHeadersBlob(blob);
+        Assert.assertEquals(5, view.size());
+        Assert.assertEquals("x-amz-request-id", view.getName(1));
+        Assert.assertEquals("ABCDEF", view.getValue(1));
+        Assert.assertEquals("ABCDEF", view.getValue("X-Amz-Request-Id"));
+        Assert.assertEquals(1234, view.getLongValue("content-length", -1));
+        Assert.assertEquals(-1, view.getLongValue("x-amz-request-id", -1));
+        Assert.assertEquals(Arrays.asList("a=1", "b=2"), view.getValues("SET-COOKIE"));
+        Assert.assertEquals("", view.getValue("x-empty"));
+        Assert.assertTrue(view.contains("x-empty"));
+        Assert.assertFalse(view.contains("x-missing"));
+        Assert.assertNull(view.getValue("x-missing"));
+        Assert.assertEquals(0, blob.position());
+
+        HttpHeader[] decoded = view.toArray();
+        Assert.assertEquals(headers.length, decoded.length);
+        for (int i = 0; i < headers.length; ++i) {
+            Assert.assertEquals(headers[i].getName(), decoded[i].getName());
+            Assert.assertEquals(headers[i].getValue(), decoded[i].getValue());
+        }
+
+        view.close();
+        try {
+            view.getValue("content-length");
+            Assert.fail("a closed view must not read the blob");
+        } catch (IllegalStateException expected) {
+        }
+    }
+
+    @Test
+    public void testHttpHeadersViewDefaultCallback() {
+        HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Content-Length", "1234") };
+        byte[] marshalled = HttpHeader.marshalHeadersForJni(Arrays.asList(headers));
+        ByteBuffer blob = ByteBuffer.allocateDirect(marshalled.length);
+        blob.put(marshalled);
+        blob.flip();
+
+        List<HttpHeader[]> received = new ArrayList<>();
+        HttpStreamBaseResponseHandler handler = new HttpStreamBaseResponseHandler() {
+            @Override
+            public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                    HttpHeader[] nextHeaders) {
+                received.add(nextHeaders);
+            }
+
+            @Override
+            public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+            }
+        };
+
+        /* null headers must resolve to the array callback, the view callback has a name of its own */
+        handler.onResponseHeaders(null, 200, 0, null);
+        try (HttpHeadersView view = HttpHeadersView.fromMarshalledHeadersBlob(blob)) {
+            handler.onResponseHeadersView(null, 200, 0, view);
+        }
+
+        Assert.assertEquals(2, received.size());
+        Assert.assertNull(received.get(0));
+        Assert.assertEquals(1, received.get(1).length);
+        Assert.assertEquals("1234", received.get(1)[0].getValue());
+    }
+
+    @Test
+    public void testHttpDownloadRetainedBody() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+        URI uri = new URI("https://aws-crt-test-stuff.s3.amazonaws.com");
+        HttpRequest request = new HttpRequest("GET", "/http_test_doc.txt",
+                new HttpHeader[] { new HttpHeader("Host", uri.getHost()) }, null);
+
+        List<HttpResponseBody> retained = new ArrayList<>();
+        List<HttpResponseBody> callbackBodies = new ArrayList<>();
+        CompletableFuture<Integer> completed = new CompletableFuture<>();
+        HttpStreamBaseResponseHandler handler = new HttpStreamBaseResponseHandler() {
+            @Override
+            public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                    HttpHeader[] nextHeaders) {
+            }
+
+            @Override
+            public boolean useDirectResponseBody() {
+                return true;
+            }
+
+            @Override
+            public int onResponseBody(HttpStreamBase stream, HttpResponseBody body) {
+                Assert.assertTrue(body.getBuffer().isDirect());
+                HttpResponseBody kept = body.retain();
+                Assert.assertSame(kept, body.retain());
+                kept.release();
+                retained.add(kept);
+                callbackBodies.add(body);
+                return body.getBuffer().remaining();
+            }
+
+            @Override
+            public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                completed.complete(errorCode);
+            }
+        };
+
+        CompletableFuture<Void> shutdownComplete;
+        try (HttpClientConnectionManager connPool = createConnectionPoolManager(uri, HttpVersion.HTTP_1_1)) {
+            shutdownComplete = connPool.getShutdownCompleteFuture();
+            try (HttpClientConnection conn = connPool.acquireConnection().get(60, TimeUnit.SECONDS);
+                    HttpStreamBase stream = conn.makeRequest(request, handler)) {
+                stream.activate();
+                Assert.assertEquals(Integer.valueOf(0), completed.get(60, TimeUnit.SECONDS));
+            }
+        }
+        shutdownComplete.get(60, TimeUnit.SECONDS);
+
+        for (HttpResponseBody body : callbackBodies) {
+            try {
+                body.getBuffer();
+                Assert.fail("a callback body must not be readable after the callback");
+            } catch (IllegalStateException expected) {
+            }
+        }
+
+        int length = 0;
+        for (HttpResponseBody body : retained) {
+            length += body.getBuffer().remaining();
+        }
+        ByteBuffer downloaded = ByteBuffer.allocate(length);
+        for (HttpResponseBody body : retained) {
+            downloaded.put(body.getBuffer().duplicate());
+            body.release();
+        }
+        downloaded.flip();
+        Assert.assertEquals(TEST_DOC_SHA256, calculateBodyHash(downloaded));
+
+        CrtResource.waitForNoResources();
+    }
+
+    @Test
+    public void testHttpDownloadBodyWithoutOptIn() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+        URI uri = new URI("https://aws-crt-test-stuff.s3.amazonaws.com");
+        HttpRequest request = new HttpRequest("GET", "/http_test_doc.txt",
+                new HttpHeader[] { new HttpHeader("Host", uri.getHost()) }, null);
+
+        ByteBuffer downloaded = ByteBuffer.allocate(16 * 1024 * 1024);
+        CompletableFuture<Integer> completed = new CompletableFuture<>();
+        HttpStreamBaseResponseHandler handler = new HttpStreamBaseResponseHandler() {
+            @Override
+            public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                    HttpHeader[] nextHeaders) {
+            }
+
+            @Override
+            public int onResponseBody(HttpStreamBase stream, byte[] bodyBytesIn) {
+                downloaded.put(bodyBytesIn);
+                return bodyBytesIn.length;
+            }
+
+            @Override
+            public int onResponseBody(HttpStreamBase stream, HttpResponseBody body) {
+                throw new AssertionError("HttpResponseBody delivered to a handler that did not opt in");
+            }
+
+            @Override
+            public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                completed.complete(errorCode);
+            }
+        };
+
+        CompletableFuture<Void> shutdownComplete;
+        try (HttpClientConnectionManager connPool = createConnectionPoolManager(uri, HttpVersion.HTTP_1_1)) {
+            shutdownComplete = connPool.getShutdownCompleteFuture();
+            try (HttpClientConnection conn = connPool.acquireConnection().get(60, TimeUnit.SECONDS);
+                    HttpStreamBase stream = conn.makeRequest(request, handler)) {
+                stream.activate();
+                Assert.assertEquals(Integer.valueOf(0), completed.get(60, TimeUnit.SECONDS));
+            }
+        }
+        shutdownComplete.get(60, TimeUnit.SECONDS);
+
+        downloaded.flip();
+        Assert.assertEquals(TEST_DOC_SHA256, calculateBodyHash(downloaded));
+
+        CrtResource.waitForNoResources();
+    }
+
+    @Test
+    public void testRetainedBodyReleaseOnlyCreditsGrantedWindow() throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+
+        final int windowSize = 1024;
+        final int bodySize = 4 * windowSize;
+
+        try (MockHttpServer server = new MockHttpServer().withResponseBodySize(bodySize);
+                EventLoopGroup eventLoopGroup = new EventLoopGroup(1);
+                HostResolver resolver = new HostResolver(eventLoopGroup);
+                ClientBootstrap bootstrap = new ClientBootstrap(eventLoopGroup, resolver);
+                SocketOptions sockOpts = new SocketOptions()) {
+
+            HttpClientConnectionManagerOptions options = new HttpClientConnectionManagerOptions()
+                    .withClientBootstrap(bootstrap)
+                    .withSocketOptions(sockOpts)
+                    .withUri(server.getEndpoint())
+                    .withManualWindowManagement(true)
+                    .withWindowSize(windowSize);
+
+            HttpRequest request = new HttpRequest("GET", "/window",
+                    new HttpHeader[] { new HttpHeader("Host", "localhost") }, null);
+            List<HttpResponseBody> retained = new ArrayList<>();
+            AtomicInteger received = new AtomicInteger(0);
+            CompletableFuture<Void> windowFilled = new CompletableFuture<>();
+            CompletableFuture<Integer> completed = new CompletableFuture<>();
+            HttpStreamBaseResponseHandler handler = new HttpStreamBaseResponseHandler() {
+                @Override
+                public void onResponseHeaders(HttpStreamBase stream, int responseStatusCode, int blockType,
+                        HttpHeader[] nextHeaders) {
+                }
+
+                @Override
+                public boolean useDirectResponseBody() {
+                    return true;
+                }
+
+                /* Keeps every chunk and grants no window, the application opens it explicitly */
+                @Override
+                public int onResponseBody(HttpStreamBase stream, HttpResponseBody body) {
+                    synchronized (retained) {
+                        retained.add(body.retain());
+                    }
+                    if (received.addAndGet(body.getBuffer().remaining()) >= windowSize) {
+                        windowFilled.complete(null);
+                    }
+                    return 0;
+                }
+
+                @Override
+                public void onResponseComplete(HttpStreamBase stream, int errorCode) {
+                    completed.complete(errorCode);
+                }
+            };
+
+            try (HttpClientConnectionManager connPool = HttpClientConnectionManager.create(options);
+                    HttpClientConnection conn = connPool.acquireConnection().get(60, TimeUnit.SECONDS);
+                    HttpStreamBase stream = conn.makeRequest(request, handler)) {
+                stream.activate();
+                windowFilled.get(60, TimeUnit.SECONDS);
+
+                /* Nothing was held back from a 0 increment, so releasing must not open the window */
+                synchronized (retained) {
+                    for (HttpResponseBody body : retained) {
+                        body.release();
+                    }
+                    retained.clear();
+                }
+                Thread.sleep(500);
+                Assert.assertEquals(windowSize, received.get());
+                Assert.assertFalse(completed.isDone());
+
+                stream.incrementWindow(bodySize - windowSize);
+                Assert.assertEquals(Integer.valueOf(0), completed.get(60, TimeUnit.SECONDS));
+                Assert.assertEquals(bodySize, received.get());
+            }
+
+            synchronized (retained) {
+                for (HttpResponseBody body : retained) {
+                    body.release();
+                }
+            }
+        }
+
+        CrtResource.waitForNoResources();
+    }
 }
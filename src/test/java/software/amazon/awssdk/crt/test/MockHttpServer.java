@@ -0,0 +1,202 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import java.io.BufferedInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.net.URI;
+import java.nio.charset.StandardCharsets;
+import java.util.Locale;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Minimal HTTP/1.1 server on localhost, for connection manager tests that need to see what happens on the wire.
+ * <p>
+ * Every request gets a 200 response with a body of a fixed size, after a fixed latency. Requests are read as soon as
+ * they arrive, independently of the responses being written, so the server can see requests that a client
+ * pipelines on one connection while earlier responses are still pending. Request bodies are skipped.
+ * </p>
+ */
+public class MockHttpServer implements AutoCloseable {
+
+    private static final String END_OF_REQUEST = "";
+
+    private final ServerSocket serverSocket;
+    private final ExecutorService executor;
+
+    private volatile long latencyMs;
+    private volatile int responseBodySize;
+
+    private final AtomicInteger connectionCount = new AtomicInteger(0);
+    private final AtomicInteger requestCount = new AtomicInteger(0);
+    private final AtomicInteger maxRequestsInFlightPerConnection = new AtomicInteger(0);
+
+    /**
+     * Starts a server on an ephemeral localhost port
+     * @throws IOException if the server socket can't be opened
+     */
+    public MockHttpServer() throws IOException {
+        serverSocket = new ServerSocket(0, 0, InetAddress.getLoopbackAddress());
+        executor = Executors.newCachedThreadPool(runnable -> {
+            Thread thread = new Thread(runnable, "MockHttpServer");
+            thread.setDaemon(true);
+            return thread;
+        });
+        executor.execute(this::acceptConnections);
+    }
+
+    /**
+     * @return endpoint to point HttpClientConnectionManagerOptions.withUri() at
+     */
+    public URI getEndpoint() {
+        return URI.create(String.format("http://localhost:%d", serverSocket.getLocalPort()));
+    }
+
+    /**
+     * @param latencyMs delay between reading each request and writing its response, in milliseconds
+     * @return this server
+     */
+    public MockHttpServer withLatencyMs(long latencyMs) {
+        this.latencyMs = latencyMs;
+        return this;
+    }
+
+    /**
+     * @param responseBodySize size of every response body
+     * @return this server
+     */
+    public MockHttpServer withResponseBodySize(int responseBodySize) {
+        this.responseBodySize = responseBodySize;
+        return this;
+    }
+
+    /**
+     * @return number of connections accepted
+     */
+    public int getConnectionCount() {
+        return connectionCount.get();
+    }
+
+    /**
+     * @return number of requests received
+     */
+    public int getRequestCount() {
+        return requestCount.get();
+    }
+
+    /**
+     * @return the most requests that were received on one connection before all of their responses were written,
+     * above 1 only if a client pipelined requests
+     */
+    public int getMaxRequestsInFlightPerConnection() {
+        return maxRequestsInFlightPerConnection.get();
+    }
+
+    @Override
+    public void close() {
+        try {
+            serverSocket.close();
+        } catch (IOException ex) {
+            /* shutting down anyway */
+        }
+        executor.shutdownNow();
+    }
+
+    private void acceptConnections() {
+        while (!serverSocket.isClosed()) {
+            try {
+                Socket socket = serverSocket.accept();
+                connectionCount.incrementAndGet();
+                executor.execute(() -> serveConnection(socket));
+            } catch (IOException ex) {
+                return;
+            }
+        }
+    }
+
+    /* Reads requests on this thread and writes responses on another, so pipelined requests are seen right away */
+    private void serveConnection(Socket socket) {
+        BlockingQueue<String> pending = new LinkedBlockingQueue<>();
+        AtomicInteger inFlight = new AtomicInteger(0);
+        executor.execute(() -> writeResponses(socket, pending, inFlight));
+
+        try (InputStream in = new BufferedInputStream(socket.getInputStream())) {
+            while (true) {
+                String requestLine = readLine(in);
+                if (requestLine == null || requestLine.isEmpty()) {
+                    break;
+                }
+
+                long contentLength = 0;
+                String header;
+                while ((header = readLine(in)) != null && !header.isEmpty()) {
+                    int colon = header.indexOf(':');
+                    if (colon > 0 && header.substring(0, colon).trim().toLowerCase(Locale.ROOT)
+                            .equals("content-length")) {
+                        contentLength = Long.parseLong(header.substring(colon + 1).trim());
+                    }
+                }
+                while (contentLength > 0) {
+                    long skipped = in.skip(contentLength);
+                    if (skipped <= 0) {
+                        break;
+                    }
+                    contentLength -= skipped;
+                }
+
+                requestCount.incrementAndGet();
+                maxRequestsInFlightPerConnection.accumulateAndGet(inFlight.incrementAndGet(), Math::max);
+                pending.put(requestLine);
+            }
+        } catch (IOException | InterruptedException ex) {
+            /* connection closed */
+        } finally {
+            pending.offer(END_OF_REQUEST);
+        }
+    }
+
+    private void writeResponses(Socket socket, BlockingQueue<String> pending, AtomicInteger inFlight) {
+        try (Socket closing = socket; OutputStream out = socket.getOutputStream()) {
+            while (!END_OF_REQUEST.equals(pending.take())) {
+                if (latencyMs > 0) {
+                    Thread.sleep(latencyMs);
+                }
+
+                byte[] body = new byte[responseBodySize];
+                String head = String.format("HTTP/1.1 200 OK\r\nContent-Length: %d\r\n\r\n", body.length);
+                out.write(head.getBytes(StandardCharsets.US_ASCII));
+                out.write(body);
+                out.flush();
+                inFlight.decrementAndGet();
+            }
+        } catch (IOException | InterruptedException ex) {
+            /* connection closed */
+        }
+    }
+
+    private static String readLine(InputStream in) throws IOException {
+        ByteArrayOutputStream line = new ByteArrayOutputStream();
+        int c;
+        while ((c = in.read()) != -1) {
+            if (c == '\n') {
+                String result = line.toString(StandardCharsets.US_ASCII.name());
+                return result.endsWith("\r") ? result.substring(0, result.length() - 1) : result;
+            }
+            line.write(c);
+        }
+        return line.size() > 0 ? line.toString(StandardCharsets.US_ASCII.name()) : null;
+    }
+}
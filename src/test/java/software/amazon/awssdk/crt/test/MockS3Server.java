@@ -0,0 +1,562 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import com.sun.net.httpserver.Headers;
+import com.sun.net.httpserver.HttpExchange;
+import com.sun.net.httpserver.HttpServer;
+import com.sun.net.httpserver.HttpsConfigurator;
+import com.sun.net.httpserver.HttpsServer;
+
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.net.URI;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.security.KeyStore;
+import java.security.cert.Certificate;
+import java.util.ArrayList;
+import java.util.Base64;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.UUID;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+
+import javax.net.ssl.KeyManagerFactory;
+import javax.net.ssl.SSLContext;
+
+/**
+ * In-process S3 endpoint on localhost, for exercising S3Client without AWS endpoints or credentials.
+ * <p>
+ * Supports GetObject (with ranges), HeadObject, PutObject, CreateMultipartUpload, UploadPart,
+ * CompleteMultipartUpload and AbortMultipartUpload on a single, flat, in-memory bucket: the bucket in the Host header
+ * or path is ignored and signatures are not checked. Objects can be stored for real, or be synthetic (a size with
+ * generated content, see {@link #syntheticByte}) so multi-GB transfers don't need multi-GB heaps. Every response can
+ * be delayed by a fixed latency and bodies can be paced to a per-connection bandwidth.
+ * </p>
+ * <p>
+ * HTTPS uses a throwaway self-signed certificate for localhost, made with the JDK's keytool. Trust it via
+ * {@link #getCertificatePem()} and TlsContextOptions.withCertificateAuthority().
+ * </p>
+ */
+public class MockS3Server implements AutoCloseable {
+
+    private static final int WRITE_BLOCK_SIZE = 64 * 1024;
+    private static final String KEYSTORE_PASSWORD = "mock-s3-server";
+
+    private static class MockObject {
+        final byte[] data;
+        final long size;
+        final String etag;
+
+        MockObject(byte[] data, long size, String etag) {
+            this.data = data;
+            this.size = size;
+            this.etag = etag;
+        }
+    }
+
+    private static class MockUpload {
+        final String key;
+        final Map<Integer, MockObject> parts = new ConcurrentHashMap<>();
+
+        MockUpload(String key) {
+            this.key = key;
+        }
+    }
+
+    private final HttpServer server;
+    private final ExecutorService executor;
+    private final String certificatePem;
+    private final Map<String, MockObject> objects = new ConcurrentHashMap<>();
+    private final Map<String, MockUpload> uploads = new ConcurrentHashMap<>();
+    private final AtomicInteger etagCounter = new AtomicInteger(0);
+
+    private volatile long latencyMs;
+    private volatile long bandwidthBytesPerSecond;
+    private volatile boolean storeUploads = true;
+
+    private final Map<String, AtomicInteger> requestCounts = new ConcurrentHashMap<>();
+    private final AtomicLong bytesSent = new AtomicLong(0);
+    private final AtomicLong bytesReceived = new AtomicLong(0);
+
+    /**
+     * Starts a server on an ephemeral localhost port
+     * @param useTls whether to serve HTTPS, with a self-signed certificate, rather than HTTP
+     * @throws Exception if the server or its certificate can't be set up
+     */
+    public MockS3Server(boolean useTls) throws Exception {
+        InetSocketAddress address = new InetSocketAddress(InetAddress.getLoopbackAddress(), 0);
+        if (useTls) {
+            KeyStore keyStore = createSelfSignedKeyStore();
+            certificatePem = toPem(keyStore.getCertificate("mock-s3"));
+
+            KeyManagerFactory keyManagerFactory =
+                    KeyManagerFactory.getInstance(KeyManagerFactory.getDefaultAlgorithm());
+            keyManagerFactory.init(keyStore, KEYSTORE_PASSWORD.toCharArray());
+            SSLContext sslContext = SSLContext.getInstance("TLS");
+            sslContext.init(keyManagerFactory.getKeyManagers(), null, null);
+
+            HttpsServer httpsServer = HttpsServer.create(address, 0);
+            httpsServer.setHttpsConfigurator(new HttpsConfigurator(sslContext));
+            server = httpsServer;
+        } else {
+            certificatePem = null;
+            server = HttpServer.create(address, 0);
+        }
+
+        executor = Executors.newCachedThreadPool(runnable -> {
+            Thread thread = new Thread(runnable, "MockS3Server");
+            thread.setDaemon(true);
+            return thread;
+        });
+        server.setExecutor(executor);
+        server.createContext("/", this::handle);
+        server.start();
+    }
+
+    /**
+     * @return endpoint to point S3MetaRequestOptions.withEndpoint() at
+     */
+    public URI getEndpoint() {
+        String scheme = certificatePem != null ? "https" : "http";
+        return URI.create(String.format("%s://localhost:%d", scheme, getPort()));
+    }
+
+    /**
+     * @return port the server is listening on
+     */
+    public int getPort() {
+        return server.getAddress().getPort();
+    }
+
+    /**
+     * @return PEM of the self-signed certificate, or null when serving HTTP
+     */
+    public String getCertificatePem() {
+        return certificatePem;
+    }
+
+    /**
+     * @param latencyMs delay before every response, in milliseconds
+     * @return this server
+     */
+    public MockS3Server withLatencyMs(long latencyMs) {
+        this.latencyMs = latencyMs;
+        return this;
+    }
+
+    /**
+     * @param bandwidthBytesPerSecond rate each response body is sent at, or 0 for as fast as possible
+     * @return this server
+     */
+    public MockS3Server withBandwidthBytesPerSecond(long bandwidthBytesPerSecond) {
+        this.bandwidthBytesPerSecond = bandwidthBytesPerSecond;
+        return this;
+    }
+
+    /**
+     * @param storeUploads whether uploaded data is kept; when false uploads become synthetic objects of the same size
+     * @return this server
+     */
+    public MockS3Server withStoreUploads(boolean storeUploads) {
+        this.storeUploads = storeUploads;
+        return this;
+    }
+
+    /**
+     * @param key object key, without a leading '/'
+     * @param data object content
+     */
+    public void putObject(String key, byte[] data) {
+        objects.put(key, new MockObject(data, data.length, nextEtag()));
+    }
+
+    /**
+     * @param key object key, without a leading '/'
+     * @param size object size, its content is {@link #syntheticByte} of each offset
+     */
+    public void putSyntheticObject(String key, long size) {
+        objects.put(key, new MockObject(null, size, nextEtag()));
+    }
+
+    /**
+     * @param key object key, without a leading '/'
+     * @return the object's stored content, or null if it doesn't exist or is synthetic
+     */
+    public byte[] getObjectData(String key) {
+        MockObject object = objects.get(key);
+        return object != null ? object.data : null;
+    }
+
+    /**
+     * @param key object key, without a leading '/'
+     * @return the object's size, or -1 if it doesn't exist
+     */
+    public long getObjectSize(String key) {
+        MockObject object = objects.get(key);
+        return object != null ? object.size : -1;
+    }
+
+    /**
+     * @return number of multipart uploads created but neither completed nor aborted
+     */
+    public int getPendingUploadCount() {
+        return uploads.size();
+    }
+
+    /**
+     * @param operation operation name, e.g. "GetObject" or "UploadPart"
+     * @return number of requests received for the operation
+     */
+    public int getRequestCount(String operation) {
+        AtomicInteger count = requestCounts.get(operation);
+        return count != null ? count.get() : 0;
+    }
+
+    /**
+     * @return total response body bytes sent
+     */
+    public long getBytesSent() {
+        return bytesSent.get();
+    }
+
+    /**
+     * @return total request body bytes received
+     */
+    public long getBytesReceived() {
+        return bytesReceived.get();
+    }
+
+    /**
+     * Content of synthetic objects, a pattern that doesn't line up with power of two part sizes
+     * @param offset offset into the object
+     * @return the byte at that offset
+     */
+    public static byte syntheticByte(long offset) {
+        return (byte) (offset % 251);
+    }
+
+    @Override
+    public void close() {
+        server.stop(0);
+        executor.shutdownNow();
+    }
+
+    private String nextEtag() {
+        return String.format("\"%032x\"", etagCounter.incrementAndGet());
+    }
+
+    private void handle(HttpExchange exchange) throws IOException {
+        try {
+            if (latencyMs > 0) {
+                Thread.sleep(latencyMs);
+            }
+
+            String key = exchange.getRequestURI().getPath();
+            if (key.startsWith("/")) {
+                key = key.substring(1);
+            }
+            Map<String, String> query = parseQuery(exchange.getRequestURI().getRawQuery());
+            String method = exchange.getRequestMethod();
+
+            if ("GET".equals(method)) {
+                count("GetObject");
+                handleGet(exchange, key, true);
+            } else if ("HEAD".equals(method)) {
+                count("HeadObject");
+                handleGet(exchange, key, false);
+            } else if ("PUT".equals(method) && query.containsKey("uploadId")) {
+                count("UploadPart");
+                handleUploadPart(exchange, query);
+            } else if ("PUT".equals(method)) {
+                count("PutObject");
+                MockObject object = readObject(exchange);
+                objects.put(key, object);
+                exchange.getResponseHeaders().set("ETag", object.etag);
+                sendEmpty(exchange, 200);
+            } else if ("POST".equals(method) && query.containsKey("uploads")) {
+                count("CreateMultipartUpload");
+                String uploadId = UUID.randomUUID().toString();
+                uploads.put(uploadId, new MockUpload(key));
+                sendXml(exchange, 200, "<InitiateMultipartUploadResult><Bucket>mock</Bucket><Key>" + key
+                        + "</Key><UploadId>" + uploadId + "</UploadId></InitiateMultipartUploadResult>");
+            } else if ("POST".equals(method) && query.containsKey("uploadId")) {
+                count("CompleteMultipartUpload");
+                handleComplete(exchange, query.get("uploadId"));
+            } else if ("DELETE".equals(method) && query.containsKey("uploadId")) {
+                count("AbortMultipartUpload");
+                drain(exchange.getRequestBody());
+                if (uploads.remove(query.get("uploadId")) == null) {
+                    sendError(exchange, 404, "NoSuchUpload");
+                } else {
+                    sendEmpty(exchange, 204);
+                }
+            } else {
+                drain(exchange.getRequestBody());
+                sendError(exchange, 501, "NotImplemented");
+            }
+        } catch (InterruptedException ex) {
+            Thread.currentThread().interrupt();
+        } finally {
+            exchange.close();
+        }
+    }
+
+    private void count(String operation) {
+        requestCounts.computeIfAbsent(operation, name -> new AtomicInteger(0)).incrementAndGet();
+    }
+
+    private void handleGet(HttpExchange exchange, String key, boolean sendBody)
+            throws IOException, InterruptedException {
+        MockObject object = objects.get(key);
+        if (object == null) {
+            sendError(exchange, 404, "NoSuchKey");
+            return;
+        }
+
+        long start = 0;
+        long end = object.size - 1;
+        int status = 200;
+        String range = exchange.getRequestHeaders().getFirst("Range");
+        if (range != null && range.startsWith("bytes=")) {
+            String[] bounds = range.substring("bytes=".length()).split("-", 2);
+            if (bounds[0].isEmpty()) {
+                /* suffix range, the last N bytes */
+                start = Math.max(0, object.size - Long.parseLong(bounds[1]));
+            } else {
+                start = Long.parseLong(bounds[0]);
+                if (!bounds[1].isEmpty()) {
+                    end = Math.min(end, Long.parseLong(bounds[1]));
+                }
+            }
+            if (start >= object.size) {
+                exchange.getResponseHeaders().set("Content-Range", "bytes */" + object.size);
+                sendError(exchange, 416, "InvalidRange");
+                return;
+            }
+            status = 206;
+            exchange.getResponseHeaders().set("Content-Range",
+                    String.format("bytes %d-%d/%d", start, end, object.size));
+        }
+
+        long length = end - start + 1;
+        Headers headers = exchange.getResponseHeaders();
+        headers.set("ETag", object.etag);
+        headers.set("Accept-Ranges", "bytes");
+        headers.set("Content-Type", "binary/octet-stream");
+        if (!sendBody) {
+            headers.set("Content-Length", Long.toString(length));
+            exchange.sendResponseHeaders(status, -1);
+            return;
+        }
+
+        /* 0 would mean chunked to the JDK server, so empty bodies go as "no body" with an explicit length */
+        if (length == 0) {
+            headers.set("Content-Length", "0");
+            exchange.sendResponseHeaders(status, -1);
+            return;
+        }
+        exchange.sendResponseHeaders(status, length);
+        writeBody(exchange.getResponseBody(), object, start, length);
+    }
+
+    private void writeBody(OutputStream output, MockObject object, long start, long length)
+            throws IOException, InterruptedException {
+        byte[] block = new byte[(int) Math.min(WRITE_BLOCK_SIZE, length)];
+        long startNs = System.nanoTime();
+        long written = 0;
+        while (written < length) {
+            int blockLength = (int) Math.min(block.length, length - written);
+            if (object.data != null) {
+                System.arraycopy(object.data, (int) (start + written), block, 0, blockLength);
+            } else {
+                for (int i = 0; i < blockLength; ++i) {
+                    block[i] = syntheticByte(start + written + i);
+                }
+            }
+            output.write(block, 0, blockLength);
+            written += blockLength;
+            bytesSent.addAndGet(blockLength);
+
+            long bandwidth = bandwidthBytesPerSecond;
+            if (bandwidth > 0) {
+                long dueNs = startNs + written * TimeUnit.SECONDS.toNanos(1) / bandwidth;
+                long aheadNs = dueNs - System.nanoTime();
+                if (aheadNs > 0) {
+                    TimeUnit.NANOSECONDS.sleep(aheadNs);
+                }
+            }
+        }
+        output.close();
+    }
+
+    private void handleUploadPart(HttpExchange exchange, Map<String, String> query) throws IOException {
+        MockUpload upload = uploads.get(query.get("uploadId"));
+        if (upload == null) {
+            drain(exchange.getRequestBody());
+            sendError(exchange, 404, "NoSuchUpload");
+            return;
+        }
+
+        MockObject part = readObject(exchange);
+        upload.parts.put(Integer.parseInt(query.get("partNumber")), part);
+        exchange.getResponseHeaders().set("ETag", part.etag);
+        sendEmpty(exchange, 200);
+    }
+
+    private void handleComplete(HttpExchange exchange, String uploadId) throws IOException {
+        drain(exchange.getRequestBody());
+        MockUpload upload = uploads.remove(uploadId);
+        if (upload == null) {
+            sendError(exchange, 404, "NoSuchUpload");
+            return;
+        }
+
+        /* Parts are assembled in part number order, the part list in the request isn't checked */
+        List<MockObject> parts = new ArrayList<>(new TreeMap<>(upload.parts).values());
+        long size = 0;
+        boolean stored = true;
+        for (MockObject part : parts) {
+            size += part.size;
+            stored &= part.data != null;
+        }
+
+        byte[] data = null;
+        if (stored && size <= Integer.MAX_VALUE) {
+            data = new byte[(int) size];
+            int offset = 0;
+            for (MockObject part : parts) {
+                System.arraycopy(part.data, 0, data, offset, part.data.length);
+                offset += part.data.length;
+            }
+        }
+
+        String etag = String.format("\"%032x-%d\"", etagCounter.incrementAndGet(), parts.size());
+        objects.put(upload.key, new MockObject(data, size, etag));
+        sendXml(exchange, 200, "<CompleteMultipartUploadResult><Bucket>mock</Bucket><Key>" + upload.key
+                + "</Key><ETag>" + etag.replace("\"", "&quot;") + "</ETag></CompleteMultipartUploadResult>");
+    }
+
+    private MockObject readObject(HttpExchange exchange) throws IOException {
+        InputStream input = exchange.getRequestBody();
+        if (!storeUploads) {
+            long size = drain(input);
+            return new MockObject(null, size, nextEtag());
+        }
+
+        ByteArrayOutputStream data = new ByteArrayOutputStream();
+        byte[] block = new byte[WRITE_BLOCK_SIZE];
+        int read;
+        while ((read = input.read(block)) > 0) {
+            data.write(block, 0, read);
+        }
+        bytesReceived.addAndGet(data.size());
+        return new MockObject(data.toByteArray(), data.size(), nextEtag());
+    }
+
+    private long drain(InputStream input) throws IOException {
+        byte[] block = new byte[WRITE_BLOCK_SIZE];
+        long total = 0;
+        int read;
+        while ((read = input.read(block)) > 0) {
+            total += read;
+        }
+        bytesReceived.addAndGet(total);
+        return total;
+    }
+
+    private static void sendEmpty(HttpExchange exchange, int status) throws IOException {
+        if (status != 204) {
+            exchange.getResponseHeaders().set("Content-Length", "0");
+        }
+        exchange.sendResponseHeaders(status, -1);
+    }
+
+    private static void sendXml(HttpExchange exchange, int status, String body) throws IOException {
+        byte[] bytes = ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" + body).getBytes(StandardCharsets.UTF_8);
+        exchange.getResponseHeaders().set("Content-Type", "application/xml");
+        exchange.sendResponseHeaders(status, bytes.length);
+        try (OutputStream output = exchange.getResponseBody()) {
+            output.write(bytes);
+        }
+    }
+
+    private static void sendError(HttpExchange exchange, int status, String code) throws IOException {
+        if ("HEAD".equals(exchange.getRequestMethod())) {
+            sendEmpty(exchange, status);
+            return;
+        }
+        sendXml(exchange, status, "<Error><Code>" + code + "</Code><Message>" + code + "</Message></Error>");
+    }
+
+    private static Map<String, String> parseQuery(String rawQuery) {
+        Map<String, String> query = new HashMap<>();
+        if (rawQuery == null || rawQuery.isEmpty()) {
+            return query;
+        }
+        for (String param : rawQuery.split("&")) {
+            int equals = param.indexOf('=');
+            if (equals < 0) {
+                query.put(param, "");
+            } else {
+                query.put(param.substring(0, equals), param.substring(equals + 1));
+            }
+        }
+        return query;
+    }
+
+    private static KeyStore createSelfSignedKeyStore() throws Exception {
+        File keyStoreFile = File.createTempFile("mock-s3-server", ".p12");
+        /* keytool refuses to write over an existing file, even an empty one */
+        Files.delete(keyStoreFile.toPath());
+        try {
+            String keytool = System.getProperty("java.home") + File.separator + "bin" + File.separator + "keytool";
+            Process process = new ProcessBuilder(keytool, "-genkeypair", "-alias", "mock-s3", "-keyalg", "RSA",
+                    "-keysize", "2048", "-validity", "2", "-dname", "CN=localhost",
+                    "-ext", "SAN=dns:localhost,ip:127.0.0.1", "-storetype", "PKCS12",
+                    "-keystore", keyStoreFile.getAbsolutePath(), "-storepass", KEYSTORE_PASSWORD,
+                    "-keypass", KEYSTORE_PASSWORD).redirectErrorStream(true).start();
+            drainQuietly(process.getInputStream());
+            if (!process.waitFor(60, TimeUnit.SECONDS) || process.exitValue() != 0) {
+                throw new IOException("keytool failed to create a self-signed certificate");
+            }
+
+            KeyStore keyStore = KeyStore.getInstance("PKCS12");
+            try (InputStream input = new FileInputStream(keyStoreFile)) {
+                keyStore.load(input, KEYSTORE_PASSWORD.toCharArray());
+            }
+            return keyStore;
+        } finally {
+            Files.deleteIfExists(keyStoreFile.toPath());
+        }
+    }
+
+    private static void drainQuietly(InputStream input) throws IOException {
+        byte[] block = new byte[1024];
+        while (input.read(block) > 0) {
+        }
+    }
+
+    private static String toPem(Certificate certificate) throws Exception {
+        Base64.Encoder encoder = Base64.getMimeEncoder(64, "\n".getBytes(StandardCharsets.US_ASCII));
+        return "-----BEGIN CERTIFICATE-----\n" + encoder.encodeToString(certificate.getEncoded())
+                + "\n-----END CERTIFICATE-----\n";
+    }
+}
@@ -3780,4 +3780,94 @@ public class Mqtt5ClientTest extends Mqtt5ClientTestFixture {
 
         CrtResource.waitForNoResources();
     }
+
+    /**
+     * ============================================================
+     * Publish Batch Tests
+     * ============================================================
+     */
+
+    private void doPublishBatch_UC1Test() {
+        try (TlsContextOptions tlsOptions = TlsContextOptions.createWithMtlsFromPath(
+                AWS_TEST_MQTT5_IOT_CORE_RSA_CERT, AWS_TEST_MQTT5_IOT_CORE_RSA_KEY);
+             TlsContext tlsContext = new TlsContext(tlsOptions)) {
+
+            String testUUID = UUID.randomUUID().toString();
+            String testTopic = "test/MQTT5_PublishBatch_Java_" + testUUID;
+            final int messageCount = 50;
+
+            CompletableFuture<Void> allReceivedFuture = new CompletableFuture<>();
+            java.util.Set<String> receivedPayloads = java.util.concurrent.ConcurrentHashMap.newKeySet();
+
+            Mqtt5ClientOptionsBuilder clientBuilder = new Mqtt5ClientOptionsBuilder(AWS_TEST_MQTT5_IOT_CORE_HOST, 8883l);
+            LifecycleEvents_Futured events = new LifecycleEvents_Futured();
+            clientBuilder.withLifecycleEvents(events);
+            clientBuilder.withTlsContext(tlsContext);
+
+            ConnectPacketBuilder connectOptions = new ConnectPacketBuilder();
+            connectOptions.withClientId("test/MQTT5_PublishBatch_Java_" + testUUID);
+            clientBuilder.withConnectOptions(connectOptions.build());
+
+            clientBuilder.withPublishBatchEvents(new Mqtt5ClientOptions.PublishBatchEvents() {
+                @Override
+                public void onMessagesReceived(Mqtt5Client client, PublishBatch publishBatch) {
+                    for (int i = 0; i < publishBatch.size(); ++i) {
+                        if (!testTopic.equals(publishBatch.getTopic(i))) {
+                            allReceivedFuture.completeExceptionally(new Exception("Unexpected topic"));
+                            return;
+                        }
+                        PublishPacket packet = publishBatch.toPublishPacket(i);
+                        if (packet.getUserProperties() == null || packet.getUserProperties().size() != 1) {
+                            allReceivedFuture.completeExceptionally(new Exception("Missing user property"));
+                            return;
+                        }
+                        receivedPayloads.add(new String(publishBatch.getPayloadBytes(i)));
+                    }
+                    if (receivedPayloads.size() == messageCount) {
+                        allReceivedFuture.complete(null);
+                    }
+                }
+            });
+
+            try (Mqtt5Client client = new Mqtt5Client(clientBuilder.build())) {
+                client.start();
+                events.connectedFuture.get(OPERATION_TIMEOUT_TIME, TimeUnit.SECONDS);
+
+                SubscribePacketBuilder subscribeBuilder = new SubscribePacketBuilder(testTopic, QOS.AT_LEAST_ONCE);
+                client.subscribe(subscribeBuilder.build()).get(OPERATION_TIMEOUT_TIME, TimeUnit.SECONDS);
+
+                ArrayList<UserProperty> userProperties = new ArrayList<UserProperty>();
+                userProperties.add(new UserProperty("batch", "true"));
+
+                ArrayList<CompletableFuture<PublishResult>> publishFutures = new ArrayList<>();
+                for (int i = 0; i < messageCount; ++i) {
+                    QOS qos = (i % 2 == 0) ? QOS.AT_MOST_ONCE : QOS.AT_LEAST_ONCE;
+                    PublishPacketBuilder publishBuilder = new PublishPacketBuilder(testTopic, qos, ("message " + i).getBytes());
+                    publishBuilder.withUserProperties(userProperties);
+                    publishFutures.add(client.publish(publishBuilder.build()));
+                }
+                for (CompletableFuture<PublishResult> future : publishFutures) {
+                    future.get(OPERATION_TIMEOUT_TIME, TimeUnit.SECONDS);
+                }
+
+                allReceivedFuture.get(OPERATION_TIMEOUT_TIME, TimeUnit.SECONDS);
+                assertEquals(messageCount, receivedPayloads.size());
+
+                client.stop();
+                events.stopFuture.get(OPERATION_TIMEOUT_TIME, TimeUnit.SECONDS);
+            }
+        } catch (Exception ex) {
+            throw new RuntimeException(ex);
+        }
+    }
+
+    /* Publishes received in the same event loop tick are delivered together through PublishBatchEvents */
+    @Test
+    public void PublishBatch_UC1() throws Exception {
+        skipIfNetworkUnavailable();
+        Assume.assumeNotNull(AWS_TEST_MQTT5_IOT_CORE_HOST, AWS_TEST_MQTT5_IOT_CORE_RSA_CERT, AWS_TEST_MQTT5_IOT_CORE_RSA_KEY);
+        TestUtils.doRetryableTest(this::doPublishBatch_UC1Test, TestUtils::isRetryableTimeout, MAX_TEST_RETRIES, TEST_RETRY_SLEEP_MILLIS);
+
+        CrtResource.waitForNoResources();
+    }
 }
@@ -185,4 +185,59 @@ public class PublishTest extends MqttClientConnectionFixture {
 
         CrtResource.waitForNoResources();
     }
+
+    private void doBatchRoundTripTest() {
+        try (TlsContextOptions contextOptions = TlsContextOptions.createWithMtlsFromPath(
+                AWS_TEST_MQTT311_IOT_CORE_RSA_CERT,
+                AWS_TEST_MQTT311_IOT_CORE_RSA_KEY);
+             TlsContext context = new TlsContext(contextOptions)) {
+            connectDirect(
+                context,
+                AWS_TEST_MQTT311_IOT_CORE_HOST,
+                8883,
+                null,
+                null,
+                null,
+                true);
+            subscribe();
+
+            final int batchSize = 10;
+            ArrayList<MqttMessage> batch = new ArrayList<>();
+            for (int i = 0; i < batchSize; ++i) {
+                batch.add(new MqttMessage(TEST_TOPIC, (TEST_PAYLOAD + i).getBytes(), QualityOfService.AT_LEAST_ONCE));
+            }
+
+            short[] packetIds = connection.publishBatch(batch).get();
+            Assert.assertEquals(batchSize, packetIds.length);
+            for (short packetId : packetIds) {
+                Assert.assertNotEquals(0, packetId);
+            }
+
+            // test time out will break us out of this on failure
+            receivedLock.lock();
+            try {
+                while (receivedMessages.size() < batchSize) {
+                    receivedSignal.await();
+                }
+            } finally {
+                receivedLock.unlock();
+            }
+
+            disconnect();
+        } catch (Exception ex) {
+            throw new RuntimeException(ex);
+        } finally {
+            close();
+        }
+    }
+
+    @Test
+    public void testBatchRoundTrip() throws Exception {
+        skipIfNetworkUnavailable();
+        Assume.assumeNotNull(AWS_TEST_MQTT311_IOT_CORE_HOST, AWS_TEST_MQTT311_IOT_CORE_RSA_KEY, AWS_TEST_MQTT311_IOT_CORE_RSA_CERT);
+
+        TestUtils.doRetryableTest(this::doBatchRoundTripTest, TestUtils::isRetryableTimeout, MAX_TEST_RETRIES, TEST_RETRY_SLEEP_MILLIS);
+
+        CrtResource.waitForNoResources();
+    }
 };
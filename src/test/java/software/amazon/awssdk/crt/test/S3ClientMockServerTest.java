@@ -0,0 +1,175 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import org.junit.Assume;
+import org.junit.Test;
+
+import software.amazon.awssdk.crt.auth.credentials.StaticCredentialsProvider;
+import software.amazon.awssdk.crt.auth.signing.AwsSigningConfig;
+import software.amazon.awssdk.crt.io.ClientBootstrap;
+import software.amazon.awssdk.crt.io.EventLoopGroup;
+import software.amazon.awssdk.crt.io.HostResolver;
+import software.amazon.awssdk.crt.io.TlsContext;
+import software.amazon.awssdk.crt.io.TlsContextOptions;
+import software.amazon.awssdk.crt.s3.S3Client;
+import software.amazon.awssdk.crt.s3.S3ClientOptions;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * S3Client against a local {@link MockS3Server}, so it runs without AWS endpoints or credentials.
+ */
+public class S3ClientMockServerTest extends CrtTestFixture {
+
+    static final String REGION = "us-west-2";
+    static final long MB = 1024L * 1024L;
+
+    public S3ClientMockServerTest() {
+    }
+
+    private S3Client createS3Client(MockS3Server server, S3ClientOptions options, int numThreads) {
+        try (EventLoopGroup elg = new EventLoopGroup(0, numThreads);
+                HostResolver hostResolver = new HostResolver(elg);
+                ClientBootstrap clientBootstrap = new ClientBootstrap(elg, hostResolver);
+                StaticCredentialsProvider credentialsProvider =
+                        new StaticCredentialsProvider.StaticCredentialsProviderBuilder()
+                        .withAccessKeyId("mock-access-key".getBytes(StandardCharsets.UTF_8))
+                        .withSecretAccessKey("mock-secret-key".getBytes(StandardCharsets.UTF_8)).build();
+                AwsSigningConfig signingConfig = AwsSigningConfig.getDefaultS3SigningConfig(REGION,
+                        credentialsProvider)) {
+            options.withRegion(REGION).withClientBootstrap(clientBootstrap).withSigningConfig(signingConfig);
+            if (server.getCertificatePem() != null) {
+                try (TlsContextOptions tlsOptions = TlsContextOptions.createDefaultClient()
+                        .withCertificateAuthority(server.getCertificatePem());
+                        TlsContext tlsContext = new TlsContext(tlsOptions)) {
+                    options.withTlsContext(tlsContext);
+                    return new S3Client(options);
+                }
+            }
+            return new S3Client(options);
+        }
+    }
+
+    private MockS3Server createServer(boolean useTls) throws Exception {
+        skipIfAndroid();
+        skipIfLocalhostUnavailable();
+        try {
+            return new MockS3Server(useTls);
+        } catch (Exception ex) {
+            /* keytool may be missing from a bare JRE */
+            Assume.assumeNoException(ex);
+            throw ex;
+        }
+    }
+
+    @Test
+    public void testMockServerRangedGet() throws Exception {
+        try (MockS3Server server = createServer(false)) {
+            server.putSyntheticObject("get-20MB", 20 * MB);
+
+            S3ClientOptions options = new S3ClientOptions().withPartSize(8 * MB);
+            try (S3Client client = createS3Client(server, options, 1)) {
+                S3LoadGenerator.Result result = new S3LoadGenerator(client, server.getEndpoint())
+                        .runGets(Collections.singletonList("get-20MB"), 1, 1);
+
+                assertEquals(0, result.failures);
+                assertEquals(20 * MB, result.bytes);
+                /* 20MB in 8MB parts */
+                assertTrue(server.getRequestCount("GetObject") >= 3);
+            }
+        }
+    }
+
+    @Test
+    public void testMockServerMultipartUploadOverTls() throws Exception {
+        try (MockS3Server server = createServer(true)) {
+            S3ClientOptions options = new S3ClientOptions().withPartSize(5 * MB).withMultipartUploadThreshold(5 * MB);
+            try (S3Client client = createS3Client(server, options, 1)) {
+                long objectSize = 12 * MB + 123;
+                S3LoadGenerator.Result result = new S3LoadGenerator(client, server.getEndpoint())
+                        .runPuts(Collections.singletonList("put-12MB"), objectSize, 1, 1);
+
+                assertEquals(0, result.failures);
+                assertEquals(1, server.getRequestCount("CreateMultipartUpload"));
+                assertEquals(3, server.getRequestCount("UploadPart"));
+                assertEquals(1, server.getRequestCount("CompleteMultipartUpload"));
+                assertEquals(0, server.getPendingUploadCount());
+
+                byte[] uploaded = server.getObjectData("put-12MB");
+                assertEquals(objectSize, uploaded.length);
+                for (int i = 0; i < uploaded.length; ++i) {
+                    if (uploaded[i] != MockS3Server.syntheticByte(i)) {
+                        fail("uploaded data differs at offset " + i);
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Offline S3Client benchmark against the mock server. Configure with -D on the mvn command line, e.g.
+     * -Daws.crt.s3.mock.benchmark=1 -Daws.crt.memory.tracing=1 -Daws.crt.s3.mock.benchmark.memoryLimit=2147483648
+     */
+    @Test
+    public void benchmarkS3ClientMockServer() throws Exception {
+        Assume.assumeNotNull(System.getProperty("aws.crt.s3.mock.benchmark"));
+
+        final boolean useTls = Boolean.parseBoolean(System.getProperty("aws.crt.s3.mock.benchmark.tls", "false"));
+        final boolean upload = Boolean.parseBoolean(System.getProperty("aws.crt.s3.mock.benchmark.put", "false"));
+        final int threadCount = Integer.parseInt(System.getProperty("aws.crt.s3.mock.benchmark.threads", "0"));
+        final long objectSize = Long.parseLong(System.getProperty("aws.crt.s3.mock.benchmark.objectSize",
+                Long.toString(256 * MB)));
+        final int numObjects = Integer.parseInt(System.getProperty("aws.crt.s3.mock.benchmark.objects", "4"));
+        final int numTransfers = Integer.parseInt(System.getProperty("aws.crt.s3.mock.benchmark.transfers", "16"));
+        final int concurrentTransfers = Integer.parseInt(
+                System.getProperty("aws.crt.s3.mock.benchmark.concurrent", "8"));
+        final long partSize = Long.parseLong(System.getProperty("aws.crt.s3.mock.benchmark.partSize",
+                Long.toString(8 * MB)));
+        final long memoryLimit = Long.parseLong(System.getProperty("aws.crt.s3.mock.benchmark.memoryLimit", "0"));
+        final double throughputTargetGbps = Double.parseDouble(
+                System.getProperty("aws.crt.s3.mock.benchmark.gbps", "10"));
+        final long latencyMs = Long.parseLong(System.getProperty("aws.crt.s3.mock.benchmark.latencyMs", "0"));
+        final long bandwidth = Long.parseLong(System.getProperty("aws.crt.s3.mock.benchmark.bandwidth", "0"));
+
+        try (MockS3Server server = createServer(useTls)) {
+            server.withLatencyMs(latencyMs).withBandwidthBytesPerSecond(bandwidth).withStoreUploads(false);
+
+            List<String> keys = new ArrayList<>();
+            for (int i = 0; i < numObjects; ++i) {
+                String key = String.format("benchmark-%d", i);
+                server.putSyntheticObject(key, objectSize);
+                keys.add(key);
+            }
+
+            S3ClientOptions options = new S3ClientOptions().withPartSize(partSize)
+                    .withThroughputTargetGbps(throughputTargetGbps);
+            if (memoryLimit > 0) {
+                options.withMemoryLimitInBytes(memoryLimit);
+            }
+
+            try (S3Client client = createS3Client(server, options, threadCount)) {
+                S3LoadGenerator generator = new S3LoadGenerator(client, server.getEndpoint());
+                S3LoadGenerator.Result result = upload
+                        ? generator.runPuts(keys, objectSize, numTransfers, concurrentTransfers)
+                        : generator.runGets(keys, numTransfers, concurrentTransfers);
+
+                System.out.println(String.format("%s %s, part size %d, memory limit %d, latency %dms, bandwidth %d B/s",
+                        upload ? "PUT" : "GET", useTls ? "https" : "http", partSize, memoryLimit, latencyMs,
+                        bandwidth));
+                System.out.println(result);
+                assertEquals(0, result.failures);
+            }
+        }
+    }
+}
@@ -385,6 +385,64 @@ public class S3ClientTest extends CrtTestFixture {
         }
     }
 
+    @Test
+    public void testS3GetDirectResponseBody() {
+        skipIfAndroid();
+        skipIfNetworkUnavailable();
+        Assume.assumeTrue(hasAwsCredentials());
+        S3ClientOptions clientOptions = new S3ClientOptions().withRegion(REGION);
+        try (S3Client client = createS3Client(clientOptions)) {
+            CompletableFuture<Integer> onFinishedFuture = new CompletableFuture<>();
+            List<S3ResponseBody> retainedBodies = new ArrayList<>();
+            S3MetaRequestResponseHandler responseHandler = new S3MetaRequestResponseHandler() {
+
+                @Override
+                public int onResponseBody(S3ResponseBody body, long objectRangeStart, long objectRangeEnd) {
+                    Assert.assertTrue(body.getBuffer().isDirect());
+                    Assert.assertTrue(body.getBuffer().isReadOnly());
+                    Assert.assertEquals(objectRangeEnd - objectRangeStart, body.getBuffer().remaining());
+                    synchronized (retainedBodies) {
+                        retainedBodies.add(body.retain());
+                    }
+                    return 0;
+                }
+
+                @Override
+                public void onFinished(S3FinishedResponseContext context) {
+                    if (context.getErrorCode() != 0) {
+                        onFinishedFuture.completeExceptionally(makeExceptionFromFinishedResponseContext(context));
+                        return;
+                    }
+                    onFinishedFuture.complete(Integer.valueOf(context.getErrorCode()));
+                }
+            };
+
+            HttpHeader[] headers = { new HttpHeader("Host", ENDPOINT) };
+            HttpRequest httpRequest = new HttpRequest("GET", PRE_EXIST_1MB_PATH, headers, null);
+
+            S3MetaRequestOptions metaRequestOptions = new S3MetaRequestOptions()
+                    .withMetaRequestType(MetaRequestType.GET_OBJECT).withHttpRequest(httpRequest)
+                    .withResponseHandler(responseHandler)
+                    .withDirectResponseBody(true);
+
+            try (S3MetaRequest metaRequest = client.makeMetaRequest(metaRequestOptions)) {
+                Assert.assertEquals(Integer.valueOf(0), onFinishedFuture.get());
+            }
+
+            /* Retained bodies outlive the callback and the meta request */
+            long totalBytes = 0;
+            for (S3ResponseBody body : retainedBodies) {
+                Assert.assertTrue(body.isRetained());
+                totalBytes += body.getBuffer().remaining();
+                body.release();
+                assertThrows(IllegalStateException.class, () -> body.getBuffer());
+            }
+            Assert.assertEquals(1024 * 1024, totalBytes);
+        } catch (InterruptedException | ExecutionException ex) {
+            Assert.fail(ex.getMessage());
+        }
+    }
+
     @Test
     public void testS3GetWithResponseFilePath() {
         skipIfAndroid();
@@ -2153,6 +2211,130 @@ public class S3ClientTest extends CrtTestFixture {
         }
     }
 
+    /* Sum of heap bytes allocated by every live thread, or -1 if the JVM can't tell us */
+    private static long totalThreadAllocatedBytes() {
+        java.lang.management.ThreadMXBean threadBean = java.lang.management.ManagementFactory.getThreadMXBean();
+        if (!(threadBean instanceof com.sun.management.ThreadMXBean)) {
+            return -1;
+        }
+        com.sun.management.ThreadMXBean allocationBean = (com.sun.management.ThreadMXBean) threadBean;
+        if (!allocationBean.isThreadAllocatedMemorySupported() || !allocationBean.isThreadAllocatedMemoryEnabled()) {
+            return -1;
+        }
+        long total = 0;
+        for (long bytes : allocationBean.getThreadAllocatedBytes(allocationBean.getAllThreadIds())) {
+            if (bytes > 0) {
+                total += bytes;
+            }
+        }
+        return total;
+    }
+
+    private static long totalGcCount() {
+        long total = 0;
+        for (java.lang.management.GarbageCollectorMXBean gcBean : java.lang.management.ManagementFactory
+                .getGarbageCollectorMXBeans()) {
+            total += Math.max(0, gcBean.getCollectionCount());
+        }
+        return total;
+    }
+
+    /*
+     * Compares the byte[] body delivery against direct ByteBuffer delivery (withDirectResponseBody), reporting
+     * throughput and Java heap allocation for each. Uses the same client (and event loop threads) for both modes so
+     * per-thread allocation counters are comparable.
+     */
+    @Test
+    public void benchmarkS3GetDirectResponseBody() {
+        skipIfAndroid();
+        skipIfNetworkUnavailable();
+        Assume.assumeTrue(hasAwsCredentials());
+        Assume.assumeNotNull(System.getProperty("aws.crt.s3.benchmark"));
+
+        final int threadCount = Integer.parseInt(System.getProperty("aws.crt.s3.benchmark.threads", "0"));
+        final String region = System.getProperty("aws.crt.s3.benchmark.region", "us-west-2");
+        final String bucket = System.getProperty("aws.crt.s3.benchmark.bucket",
+                (region == "us-west-2") ? "aws-crt-canary-bucket" : String.format("aws-crt-canary-bucket-%s", region));
+        final String endpoint = System.getProperty("aws.crt.s3.benchmark.endpoint",
+                String.format("%s.s3.%s.amazonaws.com", bucket, region));
+        final String objectName = System.getProperty("aws.crt.s3.benchmark.object",
+                "crt-canary-obj-single-part-9223372036854775807");
+        final double expectedGbps = Double.parseDouble(System.getProperty("aws.crt.s3.benchmark.gbps", "10"));
+        final int numTransfers = Integer.parseInt(System.getProperty("aws.crt.s3.benchmark.transfers", "16"));
+        final int concurrentTransfers = Integer.parseInt(
+                System.getProperty("aws.crt.s3.benchmark.concurrent", "16"));
+
+        S3ClientOptions clientOptions = new S3ClientOptions().withRegion(region)
+                .withThroughputTargetGbps(expectedGbps);
+
+        try (S3Client client = createS3Client(clientOptions, threadCount)) {
+            HttpHeader[] headers = { new HttpHeader("Host", endpoint) };
+            HttpRequest httpRequest = new HttpRequest("GET", String.format("/%s", objectName), headers, null);
+
+            for (boolean directResponseBody : new boolean[] { false, true }) {
+                Semaphore concurrentSlots = new Semaphore(concurrentTransfers);
+                List<CompletableFuture<Void>> requestFutures = new LinkedList<>();
+                AtomicLong bytesReceived = new AtomicLong(0);
+
+                long allocatedBefore = totalThreadAllocatedBytes();
+                long gcCountBefore = totalGcCount();
+                long startNs = System.nanoTime();
+
+                for (int transferIdx = 0; transferIdx < numTransfers; ++transferIdx) {
+                    concurrentSlots.acquireUninterruptibly();
+
+                    CompletableFuture<Void> onFinishedFuture = new CompletableFuture<>();
+                    requestFutures.add(onFinishedFuture);
+
+                    S3MetaRequestResponseHandler responseHandler = new S3MetaRequestResponseHandler() {
+
+                        @Override
+                        public int onResponseBody(ByteBuffer bodyBytesIn, long objectRangeStart, long objectRangeEnd) {
+                            bytesReceived.addAndGet(bodyBytesIn.remaining());
+                            return 0;
+                        }
+
+                        @Override
+                        public void onFinished(S3FinishedResponseContext context) {
+                            concurrentSlots.release();
+                            if (context.getErrorCode() != 0) {
+                                onFinishedFuture
+                                        .completeExceptionally(makeExceptionFromFinishedResponseContext(context));
+                                return;
+                            }
+                            onFinishedFuture.complete(null);
+                        }
+                    };
+
+                    S3MetaRequestOptions metaRequestOptions = new S3MetaRequestOptions()
+                            .withMetaRequestType(MetaRequestType.GET_OBJECT).withHttpRequest(httpRequest)
+                            .withResponseHandler(responseHandler)
+                            .withDirectResponseBody(directResponseBody);
+
+                    try (S3MetaRequest metaRequest = client.makeMetaRequest(metaRequestOptions)) {
+
+                    }
+                }
+
+                CompletableFuture.allOf(requestFutures.toArray(new CompletableFuture[0])).join();
+
+                double seconds = (System.nanoTime() - startNs) / 1e9;
+                long allocatedAfter = totalThreadAllocatedBytes();
+                long gcCount = totalGcCount() - gcCountBefore;
+                double gbps = bytesReceived.get() * 8 / TransferStats.GBPS / seconds;
+
+                System.out.println(String.format("%s: %.3f Gbps over %.1fs, %d GCs",
+                        directResponseBody ? "direct ByteBuffer" : "byte[]", gbps, seconds, gcCount));
+                if (allocatedBefore >= 0 && allocatedAfter >= 0) {
+                    double allocatedMB = (allocatedAfter - allocatedBefore) / (1024.0 * 1024.0);
+                    System.out.println(String.format("    heap allocated: %.1f MB (%.1f MB/s, %.3f bytes per body byte)",
+                            allocatedMB, allocatedMB / seconds,
+                            (allocatedAfter - allocatedBefore) / (double) Math.max(1, bytesReceived.get())));
+                }
+            }
+        }
+    }
+
     @Test
     public void benchmarkS3Put() {
         skipIfAndroid();
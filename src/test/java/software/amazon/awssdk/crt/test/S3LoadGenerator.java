@@ -0,0 +1,288 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+package software.amazon.awssdk.crt.test;
+
+import software.amazon.awssdk.crt.CRT;
+import software.amazon.awssdk.crt.http.HttpHeader;
+import software.amazon.awssdk.crt.http.HttpRequest;
+import software.amazon.awssdk.crt.http.HttpRequestBodyStream;
+import software.amazon.awssdk.crt.s3.S3Client;
+import software.amazon.awssdk.crt.s3.S3FinishedResponseContext;
+import software.amazon.awssdk.crt.s3.S3MetaRequest;
+import software.amazon.awssdk.crt.s3.S3MetaRequestOptions;
+import software.amazon.awssdk.crt.s3.S3MetaRequestOptions.MetaRequestType;
+import software.amazon.awssdk.crt.s3.S3MetaRequestResponseHandler;
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.OperatingSystemMXBean;
+import java.net.URI;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.Semaphore;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * Drives an S3Client with a fixed number of concurrent GetObject or PutObject meta requests and reports throughput,
+ * peak native memory and CPU cost. Meant to be pointed at a {@link MockS3Server}, but works against any endpoint the
+ * client can sign for.
+ * <p>
+ * Native memory is sampled from CRT.nativeMemory(), which only reports anything with memory tracing enabled
+ * (-Daws.crt.memory.tracing=1 or 2). CPU time is the whole process's, so it includes the mock server when that runs
+ * in the same JVM.
+ * </p>
+ */
+public class S3LoadGenerator {
+
+    private static final double GB = 1000.0 * 1000.0 * 1000.0;
+    private static final long MEMORY_SAMPLE_INTERVAL_MS = 10;
+
+    /**
+     * Outcome of one run
+     */
+    public static class Result {
+        public final int transfers;
+        public final int failures;
+        public final long bytes;
+        public final double seconds;
+        /* -1 if the JVM can't report process CPU time */
+        public final double cpuSeconds;
+        /* 0 without memory tracing */
+        public final long peakNativeMemory;
+
+        Result(int transfers, int failures, long bytes, double seconds, double cpuSeconds, long peakNativeMemory) {
+            this.transfers = transfers;
+            this.failures = failures;
+            this.bytes = bytes;
+            this.seconds = seconds;
+            this.cpuSeconds = cpuSeconds;
+            this.peakNativeMemory = peakNativeMemory;
+        }
+
+        public double gigabytesPerSecond() {
+            return seconds > 0 ? bytes / GB / seconds : 0;
+        }
+
+        public double cpuSecondsPerGigabyte() {
+            return cpuSeconds >= 0 && bytes > 0 ? cpuSeconds / (bytes / GB) : -1;
+        }
+
+        @Override
+        public String toString() {
+            return String.format("%d/%d transfers ok, %.3f GB in %.2fs: %.3f GB/s, %.2f CPU s/GB, peak native %.1f MB",
+                    transfers - failures, transfers, bytes / GB, seconds, gigabytesPerSecond(),
+                    cpuSecondsPerGigabyte(), peakNativeMemory / (1024.0 * 1024.0));
+        }
+    }
+
+    private final S3Client client;
+    private final URI endpoint;
+
+    /**
+     * @param client client to drive, its options (part size, memory limit, ...) are what gets measured
+     * @param endpoint endpoint to send every meta request to
+     */
+    public S3LoadGenerator(S3Client client, URI endpoint) {
+        this.client = client;
+        this.endpoint = endpoint;
+    }
+
+    /**
+     * Downloads keys round-robin until transfers meta requests have completed
+     * @param keys object keys, without a leading '/'
+     * @param transfers number of meta requests to make
+     * @param concurrency maximum meta requests in flight
+     * @return the run's result
+     */
+    public Result runGets(List<String> keys, int transfers, int concurrency) {
+        return run(MetaRequestType.GET_OBJECT, keys, 0, transfers, concurrency);
+    }
+
+    /**
+     * Uploads generated objects to keys round-robin until transfers meta requests have completed
+     * @param keys object keys, without a leading '/'
+     * @param objectSize size of each uploaded object
+     * @param transfers number of meta requests to make
+     * @param concurrency maximum meta requests in flight
+     * @return the run's result
+     */
+    public Result runPuts(List<String> keys, long objectSize, int transfers, int concurrency) {
+        return run(MetaRequestType.PUT_OBJECT, keys, objectSize, transfers, concurrency);
+    }
+
+    private Result run(MetaRequestType type, List<String> keys, long objectSize, int transfers, int concurrency) {
+        AtomicLong bytes = new AtomicLong(0);
+        AtomicLong peakNativeMemory = new AtomicLong(CRT.nativeMemory());
+        AtomicInteger failures = new AtomicInteger(0);
+        Semaphore slots = new Semaphore(concurrency);
+        List<CompletableFuture<Void>> futures = new ArrayList<>(transfers);
+        /* Closing a meta request cancels it, so each one stays open until its transfer has finished */
+        List<S3MetaRequest> metaRequests = new ArrayList<>(transfers);
+        int closedCount = 0;
+
+        ScheduledExecutorService sampler = Executors.newSingleThreadScheduledExecutor(runnable -> {
+            Thread thread = new Thread(runnable, "S3LoadGenerator-memory");
+            thread.setDaemon(true);
+            return thread;
+        });
+        sampler.scheduleAtFixedRate(() -> peakNativeMemory.accumulateAndGet(CRT.nativeMemory(), Math::max), 0,
+                MEMORY_SAMPLE_INTERVAL_MS, TimeUnit.MILLISECONDS);
+
+        long cpuBefore = processCpuTimeNs();
+        long startNs = System.nanoTime();
+        try {
+            for (int i = 0; i < transfers; ++i) {
+                slots.acquireUninterruptibly();
+                CompletableFuture<Void> future = new CompletableFuture<>();
+                futures.add(future);
+
+                String key = keys.get(i % keys.size());
+                try {
+                    metaRequests.add(client.makeMetaRequest(
+                            createOptions(type, key, objectSize, bytes, slots, failures, future)));
+                } catch (RuntimeException ex) {
+                    metaRequests.add(null);
+                    slots.release();
+                    failures.incrementAndGet();
+                    future.complete(null);
+                }
+
+                /* Requests finish roughly in order, so close the finished ones at the front as we go */
+                while (closedCount < futures.size() && futures.get(closedCount).isDone()) {
+                    closeMetaRequest(metaRequests, closedCount++);
+                }
+            }
+
+            for (CompletableFuture<Void> future : futures) {
+                try {
+                    future.join();
+                } catch (CompletionException ex) {
+                    /* counted by the response handler */
+                }
+            }
+        } finally {
+            sampler.shutdownNow();
+            while (closedCount < metaRequests.size()) {
+                closeMetaRequest(metaRequests, closedCount++);
+            }
+        }
+
+        double seconds = (System.nanoTime() - startNs) / 1e9;
+        long cpuAfter = processCpuTimeNs();
+        double cpuSeconds = cpuBefore >= 0 && cpuAfter >= 0 ? (cpuAfter - cpuBefore) / 1e9 : -1;
+        peakNativeMemory.accumulateAndGet(CRT.nativeMemory(), Math::max);
+
+        return new Result(transfers, failures.get(), bytes.get(), seconds, cpuSeconds, peakNativeMemory.get());
+    }
+
+    private static void closeMetaRequest(List<S3MetaRequest> metaRequests, int index) {
+        S3MetaRequest metaRequest = metaRequests.set(index, null);
+        if (metaRequest != null) {
+            metaRequest.close();
+        }
+    }
+
+    private S3MetaRequestOptions createOptions(MetaRequestType type, String key, long objectSize, AtomicLong bytes,
+            Semaphore slots, AtomicInteger failures, CompletableFuture<Void> future) {
+
+        S3MetaRequestResponseHandler responseHandler = new S3MetaRequestResponseHandler() {
+            @Override
+            public int onResponseBody(ByteBuffer bodyBytesIn, long objectRangeStart, long objectRangeEnd) {
+                bytes.addAndGet(bodyBytesIn.remaining());
+                return 0;
+            }
+
+            @Override
+            public void onFinished(S3FinishedResponseContext context) {
+                slots.release();
+                if (context.getErrorCode() != 0) {
+                    failures.incrementAndGet();
+                    future.completeExceptionally(new RuntimeException(String.format(
+                            "error code %d (%s), response status %d", context.getErrorCode(),
+                            CRT.awsErrorName(context.getErrorCode()), context.getResponseStatus())));
+                    return;
+                }
+                if (type == MetaRequestType.PUT_OBJECT) {
+                    bytes.addAndGet(objectSize);
+                }
+                future.complete(null);
+            }
+        };
+
+        String host = endpoint.getPort() > 0 ? endpoint.getHost() + ":" + endpoint.getPort() : endpoint.getHost();
+        HttpRequest request;
+        if (type == MetaRequestType.PUT_OBJECT) {
+            HttpHeader[] headers = { new HttpHeader("Host", host),
+                    new HttpHeader("Content-Length", Long.toString(objectSize)) };
+            request = new HttpRequest("PUT", "/" + key, headers, new SyntheticBodyStream(objectSize));
+        } else {
+            HttpHeader[] headers = { new HttpHeader("Host", host) };
+            request = new HttpRequest("GET", "/" + key, headers, null);
+        }
+
+        return new S3MetaRequestOptions().withMetaRequestType(type).withHttpRequest(request)
+                .withResponseHandler(responseHandler).withEndpoint(endpoint);
+    }
+
+    private static long processCpuTimeNs() {
+        OperatingSystemMXBean osBean = ManagementFactory.getOperatingSystemMXBean();
+        if (osBean instanceof com.sun.management.OperatingSystemMXBean) {
+            return ((com.sun.management.OperatingSystemMXBean) osBean).getProcessCpuTime();
+        }
+        return -1;
+    }
+
+    /**
+     * Request body of MockS3Server.syntheticByte() content, so uploads can be checked against the server's objects
+     */
+    public static class SyntheticBodyStream implements HttpRequestBodyStream {
+        /* The content repeats every 251 bytes, so it can be copied out of one precomputed block */
+        private static final int PATTERN_PERIOD = 251;
+        private static final byte[] PATTERN = new byte[PATTERN_PERIOD * 256];
+
+        static {
+            for (int i = 0; i < PATTERN.length; ++i) {
+                PATTERN[i] = MockS3Server.syntheticByte(i);
+            }
+        }
+
+        private final long length;
+        private long position;
+
+        public SyntheticBodyStream(long length) {
+            this.length = length;
+        }
+
+        @Override
+        public boolean sendRequestBody(ByteBuffer bodyBytesOut) {
+            while (position < length && bodyBytesOut.hasRemaining()) {
+                int offset = (int) (position % PATTERN_PERIOD);
+                int count = (int) Math.min(Math.min(length - position, bodyBytesOut.remaining()),
+                        PATTERN.length - offset);
+                bodyBytesOut.put(PATTERN, offset, count);
+                position += count;
+            }
+            return position == length;
+        }
+
+        @Override
+        public boolean resetPosition() {
+            position = 0;
+            return true;
+        }
+
+        @Override
+        public long getLength() {
+            return length;
+        }
+    }
+}
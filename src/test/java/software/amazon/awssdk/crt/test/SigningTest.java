@@ -32,6 +32,7 @@ import software.amazon.awssdk.crt.auth.signing.AwsSigner;
 import software.amazon.awssdk.crt.auth.signing.AwsSigningConfig;
 import software.amazon.awssdk.crt.auth.signing.AwsSigningResult;
 import software.amazon.awssdk.crt.auth.signing.AwsSigningUtils;
+import software.amazon.awssdk.crt.auth.signing.ChunkSigner;
 import software.amazon.awssdk.crt.http.HttpHeader;
 import software.amazon.awssdk.crt.http.HttpRequest;
 import software.amazon.awssdk.crt.http.HttpRequestBodyStream;
@@ -671,6 +672,322 @@ public class SigningTest extends CrtTestFixture {
         assertTrue(Arrays.equals(signature, EXPECTED_FINAL_CHUNK_SIGNATURE));
     }
 
+    private AwsSigningConfig createSignNowTestSuiteConfig(AwsSigningConfig.AwsSignatureType signatureType)
+            throws Exception {
+        AwsSigningConfig config = new AwsSigningConfig();
+        config.setAlgorithm(AwsSigningConfig.AwsSigningAlgorithm.SIGV4);
+        config.setSignatureType(signatureType);
+        config.setRegion("us-east-1");
+        config.setService("service");
+        config.setTime(DATE_FORMAT.parse("2015-08-30T12:36:00Z").getTime());
+        config.setCredentials(new Credentials(TEST_ACCESS_KEY_ID, TEST_SECRET_ACCESS_KEY, null));
+        config.setUseDoubleUriEncode(true);
+        config.setShouldNormalizeUriPath(true);
+        config.setSignedBodyValue(AwsSigningConfig.AwsSignedBodyValue.EMPTY_SHA256);
+
+        return config;
+    }
+
+    private String findHeaderValue(HttpHeader[] headers, String name) {
+        for (HttpHeader header : headers) {
+            if (header.getName().equalsIgnoreCase(name)) {
+                return header.getValue();
+            }
+        }
+        return null;
+    }
+
+    @Test
+    public void testSignNowBasicSigv4Test() throws Exception {
+        HttpRequest request = createSigv4TestSuiteRequest();
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_HEADERS)) {
+            /* The second call is served from the signing key cache, and must agree with the first */
+            for (int i = 0; i < 2; ++i) {
+                HttpHeader[] addedHeaders = AwsSigner.signNow(request, config);
+
+                assertEquals(2, addedHeaders.length);
+                assertEquals("20150830T123600Z", findHeaderValue(addedHeaders, "X-Amz-Date"));
+                assertEquals("AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/service/aws4_request, "
+                        + "SignedHeaders=host;x-amz-date, "
+                        + "Signature=28038455d6de14eafc1f9222cf5aa6f1a96197d7deb8263271d420d138af7f11",
+                        findHeaderValue(addedHeaders, "Authorization"));
+            }
+        }
+
+        /* The request is left alone */
+        assertEquals(1, request.getHeaders().size());
+    }
+
+    @Test
+    public void testSignNowChunkedRequest() throws Exception {
+        HttpRequest request = createChunkedTestRequest();
+
+        try (AwsSigningConfig config = createChunkedRequestSigningConfig()) {
+            HttpHeader[] addedHeaders = AwsSigner.signNow(request, config);
+
+            assertEquals(AwsSigningConfig.AwsSignedBodyValue.STREAMING_AWS4_HMAC_SHA256_PAYLOAD,
+                    findHeaderValue(addedHeaders, "X-Amz-Content-Sha256"));
+            assertEquals(EXPECTED_CHUNK_REQUEST_AUTHORIZATION_HEADER, findHeaderValue(addedHeaders, "Authorization"));
+        }
+    }
+
+    @Test
+    public void testPresignNowMatchesAsyncSigner() throws Exception {
+        HttpRequest request = createSigv4TestSuiteRequest();
+        request.addHeader("SignMePlease", "yes oh yes");
+        request.addHeader("DoNotSignThis", "no oh no");
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS)) {
+            config.setShouldSignHeader(name -> !name.equalsIgnoreCase("DoNotSignThis"));
+            config.setExpirationInSeconds(60);
+
+            String addedParams = AwsSigner.presignNow(request, config);
+            assertTrue(addedParams.contains("X-Amz-SignedHeaders=host%3Bsignmeplease&"));
+
+            HttpRequest signedRequest = AwsSigner.signRequest(request, config).get();
+            List<String> expectedParams = new ArrayList<>(Arrays.asList(
+                    signedRequest.getEncodedPath().substring("/?".length()).split("&")));
+            expectedParams.remove("Param1=value1");
+
+            List<String> actualParams = new ArrayList<>(Arrays.asList(addedParams.split("&")));
+            expectedParams.sort(null);
+            actualParams.sort(null);
+            assertEquals(expectedParams, actualParams);
+        }
+    }
+
+    private static String createLargeSessionToken() {
+        StringBuilder token = new StringBuilder();
+        for (int i = 0; i < 64; ++i) {
+            token.append("FwoGZXIvYXdzE/sessiontoken+").append(i).append('=');
+        }
+        return token.toString();
+    }
+
+    @Test
+    public void testPresignNowWithSessionTokenAndLargeQueryMatchesAsyncSigner() throws Exception {
+        /* Both the query and the token outgrow the signer's initial scratch buffers */
+        StringBuilder path = new StringBuilder("/?");
+        List<String> originalParams = new ArrayList<>();
+        for (int i = 0; i < 200; ++i) {
+            String param = "param" + i + "=value" + i;
+            originalParams.add(param);
+            path.append(i > 0 ? "&" : "").append(param);
+        }
+
+        HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "example.amazonaws.com") };
+        HttpRequest request = new HttpRequest("GET", path.toString(), headers, null);
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS)) {
+            config.setCredentials(new Credentials(TEST_ACCESS_KEY_ID, TEST_SECRET_ACCESS_KEY,
+                    createLargeSessionToken().getBytes(StandardCharsets.UTF_8)));
+            config.setExpirationInSeconds(60);
+
+            String addedParams = AwsSigner.presignNow(request, config);
+            assertTrue(addedParams.contains("X-Amz-Security-Token="));
+
+            HttpRequest signedRequest = AwsSigner.signRequest(request, config).get();
+            List<String> expectedParams = new ArrayList<>(Arrays.asList(
+                    signedRequest.getEncodedPath().substring("/?".length()).split("&")));
+            expectedParams.removeAll(originalParams);
+
+            List<String> actualParams = new ArrayList<>(Arrays.asList(addedParams.split("&")));
+            expectedParams.sort(null);
+            actualParams.sort(null);
+            assertEquals(expectedParams, actualParams);
+        }
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testSignNowRequiresStaticCredentials() throws Exception {
+        try (StaticCredentialsProvider provider = new StaticCredentialsProvider.StaticCredentialsProviderBuilder()
+            .withAccessKeyId(TEST_ACCESS_KEY_ID)
+            .withSecretAccessKey(TEST_SECRET_ACCESS_KEY)
+            .build();
+            AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_HEADERS)) {
+            config.setCredentials(null);
+            config.setCredentialsProvider(provider);
+
+            AwsSigner.signNow(createSigv4TestSuiteRequest(), config);
+        }
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testSignNowRejectsUnhashedBody() throws Exception {
+        HttpRequest request = createSimpleRequest("https://www.example.com", "POST", "/derp", "<body>Hello</body>");
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_HEADERS)) {
+            config.setSignedBodyValue(null);
+
+            AwsSigner.signNow(request, config);
+        }
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testPresignNowRejectsSigningQueryParams() throws Exception {
+        HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "example.amazonaws.com") };
+        HttpRequest request = new HttpRequest("GET", "/?Param1=value1&X-Amz-Expires=86400", headers, null);
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS)) {
+            config.setExpirationInSeconds(60);
+
+            AwsSigner.presignNow(request, config);
+        }
+    }
+
+    private static List<String> sortedQueryParams(String query) {
+        List<String> params = new ArrayList<>(Arrays.asList(query.split("&")));
+        params.sort(null);
+        return params;
+    }
+
+    @Test
+    public void testPresignBatchMatchesAsyncSigner() throws Exception {
+        HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "example.amazonaws.com") };
+
+        List<String> paths = new ArrayList<>();
+        for (int i = 0; i < 2000; ++i) {
+            paths.add(i % 3 == 0 ? "/object-" + i + "?versionId=" + i : "/folder/object-" + i);
+        }
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS)) {
+            /* A session token makes every presigned path outgrow the signer's initial scratch buffers */
+            config.setCredentials(new Credentials(TEST_ACCESS_KEY_ID, TEST_SECRET_ACCESS_KEY,
+                    createLargeSessionToken().getBytes(StandardCharsets.UTF_8)));
+            config.setSignedBodyValue(AwsSigningConfig.AwsSignedBodyValue.UNSIGNED_PAYLOAD);
+            config.setExpirationInSeconds(3600);
+
+            String[] presignedPaths = AwsSigner.presignBatch(config, "GET", paths, headers);
+            assertEquals(paths.size(), presignedPaths.length);
+
+            for (int i = 0; i < paths.size(); i += 97) {
+                HttpRequest signedRequest =
+                        AwsSigner.signRequest(new HttpRequest("GET", paths.get(i), headers, null), config).get();
+                String expected = signedRequest.getEncodedPath();
+                String actual = presignedPaths[i];
+
+                int expectedQueryStart = expected.indexOf('?');
+                int actualQueryStart = actual.indexOf('?');
+                assertEquals(expected.substring(0, expectedQueryStart), actual.substring(0, actualQueryStart));
+                assertEquals(sortedQueryParams(expected.substring(expectedQueryStart + 1)),
+                        sortedQueryParams(actual.substring(actualQueryStart + 1)));
+            }
+        }
+    }
+
+    @Test
+    public void testPresignBatchEmpty() throws Exception {
+        HttpHeader[] headers = new HttpHeader[] { new HttpHeader("Host", "example.amazonaws.com") };
+
+        try (AwsSigningConfig config = createSignNowTestSuiteConfig(
+                AwsSigningConfig.AwsSignatureType.HTTP_REQUEST_VIA_QUERY_PARAMS)) {
+            assertEquals(0, AwsSigner.presignBatch(config, "GET", new ArrayList<String>(), headers).length);
+        }
+    }
+
+    @Test
+    public void testChunkSignerMatchesChunkedVectors() throws Exception {
+        try (AwsSigningConfig config = createChunkSigningConfig();
+                ChunkSigner signer = new ChunkSigner(config, EXPECTED_REQUEST_SIGNATURE)) {
+            ByteBuffer chunk1 = ByteBuffer.allocateDirect(CHUNK1_SIZE);
+            while (chunk1.hasRemaining()) {
+                chunk1.put((byte) 'a');
+            }
+            chunk1.flip();
+
+            byte[] chunk2 = new byte[CHUNK2_SIZE];
+            Arrays.fill(chunk2, (byte) 'a');
+
+            assertTrue(Arrays.equals(EXPECTED_FIRST_CHUNK_SIGNATURE, signer.signChunk(chunk1)));
+            assertEquals(0, chunk1.remaining());
+            assertTrue(Arrays.equals(EXPECTED_SECOND_CHUNK_SIGNATURE, signer.signChunk(ByteBuffer.wrap(chunk2))));
+            assertTrue(Arrays.equals(EXPECTED_FINAL_CHUNK_SIGNATURE, signer.signFinalChunk()));
+            assertTrue(Arrays.equals(EXPECTED_TRAILING_HEADERS_SIGNATURE,
+                    signer.signTrailingHeaders(createTrailingHeaders())));
+            assertTrue(Arrays.equals(EXPECTED_TRAILING_HEADERS_SIGNATURE, signer.getPreviousSignature()));
+        }
+    }
+
+    @Test
+    public void testChunkSignerWritesFramedBody() throws Exception {
+        byte[] chunk2 = new byte[CHUNK2_SIZE];
+        Arrays.fill(chunk2, (byte) 'a');
+        List<HttpHeader> trailingHeaders = createTrailingHeaders();
+
+        int bodyLength = ChunkSigner.getFramedChunkLength(CHUNK1_SIZE) + ChunkSigner.getFramedChunkLength(CHUNK2_SIZE)
+                + ChunkSigner.getFinalChunkLength(trailingHeaders);
+        ByteBuffer body = ByteBuffer.allocateDirect(bodyLength);
+
+        try (AwsSigningConfig config = createChunkSigningConfig();
+                ChunkSigner signer = new ChunkSigner(config, EXPECTED_REQUEST_SIGNATURE)) {
+            byte[] chunk1 = new byte[CHUNK1_SIZE];
+            Arrays.fill(chunk1, (byte) 'a');
+
+            assertEquals(ChunkSigner.getFramedChunkLength(CHUNK1_SIZE), signer.writeChunk(ByteBuffer.wrap(chunk1), body));
+            signer.writeChunk(ByteBuffer.wrap(chunk2), body);
+            signer.writeFinalChunk(trailingHeaders, body);
+        }
+        assertEquals(0, body.remaining());
+
+        body.flip();
+        byte[] bodyBytes = new byte[body.remaining()];
+        body.get(bodyBytes);
+        String framedBody = new String(bodyBytes, StandardCharsets.UTF_8);
+
+        String chunk1Header = "10000;chunk-signature="
+                + new String(EXPECTED_FIRST_CHUNK_SIGNATURE, StandardCharsets.UTF_8) + "\r\n";
+        assertTrue(framedBody.startsWith(chunk1Header));
+
+        int chunk2Start = chunk1Header.length() + CHUNK1_SIZE + 2;
+        String chunk2Header = "400;chunk-signature="
+                + new String(EXPECTED_SECOND_CHUNK_SIGNATURE, StandardCharsets.UTF_8) + "\r\n";
+        assertEquals(chunk2Header, framedBody.substring(chunk2Start, chunk2Start + chunk2Header.length()));
+
+        String ending = "0;chunk-signature=" + new String(EXPECTED_FINAL_CHUNK_SIGNATURE, StandardCharsets.UTF_8)
+                + "\r\nfirst:1st\r\nsecond:2nd\r\nthird:3rd\r\nx-amz-trailer-signature:"
+                + new String(EXPECTED_TRAILING_HEADERS_SIGNATURE, StandardCharsets.UTF_8) + "\r\n\r\n";
+        assertTrue(framedBody.endsWith("a\r\n" + ending));
+    }
+
+    @Test
+    public void testChunkSignerWritesTrailerNamesAsSigned() throws Exception {
+        List<HttpHeader> trailingHeaders = new ArrayList<HttpHeader>(Arrays.asList(new HttpHeader[] {
+                new HttpHeader("First", "1st"), new HttpHeader("", "skipped"), new HttpHeader("SECOND", "2nd"),
+                new HttpHeader("third", "3rd") }));
+        ByteBuffer body = ByteBuffer.allocateDirect(ChunkSigner.getFinalChunkLength(trailingHeaders));
+
+        try (AwsSigningConfig config = createChunkSigningConfig();
+                ChunkSigner signer = new ChunkSigner(config, EXPECTED_SECOND_CHUNK_SIGNATURE)) {
+            signer.writeFinalChunk(trailingHeaders, body);
+        }
+        assertEquals(0, body.remaining());
+
+        body.flip();
+        byte[] bodyBytes = new byte[body.remaining()];
+        body.get(bodyBytes);
+        String expected = "0;chunk-signature=" + new String(EXPECTED_FINAL_CHUNK_SIGNATURE, StandardCharsets.UTF_8)
+                + "\r\nfirst:1st\r\nsecond:2nd\r\nthird:3rd\r\nx-amz-trailer-signature:"
+                + new String(EXPECTED_TRAILING_HEADERS_SIGNATURE, StandardCharsets.UTF_8) + "\r\n\r\n";
+        assertEquals(expected, new String(bodyBytes, StandardCharsets.UTF_8));
+
+        List<HttpHeader> unnamedOnly = new ArrayList<HttpHeader>(Arrays.asList(new HttpHeader[] {
+                new HttpHeader("", "skipped") }));
+        assertEquals(ChunkSigner.getFramedChunkLength(0), ChunkSigner.getFinalChunkLength(unnamedOnly));
+        ByteBuffer emptyTrailerBody = ByteBuffer.allocateDirect(ChunkSigner.getFinalChunkLength(unnamedOnly));
+        try (AwsSigningConfig config = createChunkSigningConfig();
+                ChunkSigner signer = new ChunkSigner(config, EXPECTED_SECOND_CHUNK_SIGNATURE)) {
+            assertEquals(ChunkSigner.getFramedChunkLength(0), signer.writeFinalChunk(unnamedOnly, emptyTrailerBody));
+        }
+    }
+
     private static String CHUNKED_SIGV4A_CANONICAL_REQUEST = "PUT\n" +
             "/examplebucket/chunkObject.txt\n" +
             "\n" +
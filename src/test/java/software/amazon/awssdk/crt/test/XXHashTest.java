@@ -5,8 +5,21 @@
 
 package software.amazon.awssdk.crt.test;
 
+import org.junit.Assume;
 import org.junit.Test;
 import static org.junit.Assert.*;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Random;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+import software.amazon.awssdk.crt.checksums.CRC32C;
+import software.amazon.awssdk.crt.checksums.FileHash;
 import software.amazon.awssdk.crt.checksums.XXHash;
 
 public class XXHashTest extends CrtTestFixture {
@@ -70,4 +83,172 @@ public class XXHashTest extends CrtTestFixture {
             assertArrayEquals(out2, expected);
         }
     }
+
+    @Test
+    public void testHashFile() throws Exception {
+        /* not a multiple of the page size, so ranges start and end mid-page */
+        byte[] data = new byte[300_001];
+        new Random(7).nextBytes(data);
+        Path file = Files.createTempFile("xxhash-file", ".bin");
+        try {
+            Files.write(file, data);
+
+            assertArrayEquals(XXHash.computeXXHash64(data), FileHash.hashFile(FileHash.Algorithm.XXHASH64, file));
+            assertArrayEquals(XXHash.computeXXHash3_64(data, 42),
+                    FileHash.hashFile(FileHash.Algorithm.XXHASH3_64, file, 0, data.length, 42));
+
+            byte[] range = Arrays.copyOfRange(data, 4097, 250_000);
+            assertArrayEquals(XXHash.computeXXHash3_128(range),
+                    FileHash.hashFile(FileHash.Algorithm.XXHASH3_128, file, 4097, range.length));
+
+            CRC32C crc = new CRC32C();
+            crc.update(range);
+            byte[] crcDigest = FileHash.hashFile(FileHash.Algorithm.CRC32C, file, 4097, range.length);
+            assertEquals(crc.getValue(), ByteBuffer.wrap(crcDigest).getInt() & 0xffffffffL);
+
+            assertArrayEquals(XXHash.computeXXHash64(new byte[0]),
+                    FileHash.hashFile(FileHash.Algorithm.XXHASH64, file, data.length, 0));
+        } finally {
+            Files.delete(file);
+        }
+    }
+
+    @Test
+    public void testHashFileSegments() throws Exception {
+        byte[] data = new byte[1_000_000];
+        new Random(11).nextBytes(data);
+        int segmentSize = 65536;
+        Path file = Files.createTempFile("xxhash-segments", ".bin");
+        ExecutorService executor = Executors.newFixedThreadPool(4);
+        try {
+            Files.write(file, data);
+
+            byte[][] digests = FileHash.hashFileSegments(FileHash.Algorithm.XXHASH3_128, file, segmentSize, executor);
+            assertEquals((data.length + segmentSize - 1) / segmentSize, digests.length);
+            for (int i = 0; i < digests.length; ++i) {
+                int start = i * segmentSize;
+                byte[] segment = Arrays.copyOfRange(data, start, Math.min(start + segmentSize, data.length));
+                assertArrayEquals(XXHash.computeXXHash3_128(segment), digests[i]);
+            }
+        } finally {
+            executor.shutdown();
+            Files.delete(file);
+        }
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testHashFileRangeOutOfBounds() throws Exception {
+        Path file = Files.createTempFile("xxhash-bounds", ".bin");
+        try {
+            Files.write(file, new byte[16]);
+            FileHash.hashFile(FileHash.Algorithm.XXHASH64, file, 8, 9);
+        } finally {
+            Files.delete(file);
+        }
+    }
+
+    @Test
+    public void testHashUnreadableFileThrowsIOException() throws Exception {
+        Path file = Files.createTempFile("xxhash-unreadable", ".bin");
+        ExecutorService executor = Executors.newSingleThreadExecutor();
+        try {
+            Files.write(file, new byte[16]);
+            /* Root, and platforms without POSIX permissions, can still read it */
+            Assume.assumeTrue(file.toFile().setReadable(false, false));
+            Assume.assumeFalse(Files.isReadable(file));
+
+            try {
+                FileHash.hashFile(FileHash.Algorithm.XXHASH64, file);
+                fail("hashing an unreadable file should throw");
+            } catch (IOException ex) {
+                assertTrue(ex.getMessage().contains(file.toString()));
+            }
+
+            try {
+                FileHash.hashFileSegments(FileHash.Algorithm.XXHASH3_128, file, 8, executor);
+                fail("hashing segments of an unreadable file should throw");
+            } catch (IOException ex) {
+                assertTrue(ex.getMessage().contains(file.toString()));
+            }
+        } finally {
+            executor.shutdown();
+            file.toFile().setReadable(true, false);
+            Files.delete(file);
+        }
+    }
+
+    @Test
+    public void testXXHashResetAndDigestInto() {
+        byte[] input = "Hello world".getBytes();
+        byte[] expected64 = XXHash.computeXXHash64(input, 1234);
+        byte[] expected128 = XXHash.computeXXHash3_128(input, 99);
+
+        try (XXHash hash = XXHash.newXXHash64()) {
+            hash.update("something else".getBytes());
+            hash.reset(1234);
+            hash.update(input);
+            assertEquals(ByteBuffer.wrap(expected64).getLong(), hash.digestLong());
+
+            hash.reset(1234);
+            hash.update(input);
+            byte[] out = new byte[10];
+            assertEquals(8, hash.digest(out, 2));
+            assertArrayEquals(expected64, Arrays.copyOfRange(out, 2, 10));
+
+            hash.reset(1234);
+            hash.update(input);
+            ByteBuffer direct = ByteBuffer.allocateDirect(8);
+            hash.digest(direct);
+            assertFalse(direct.hasRemaining());
+            direct.flip();
+            assertEquals(ByteBuffer.wrap(expected64), direct);
+        }
+
+        try (XXHash hash = XXHash.newXXHash3_128(99)) {
+            hash.update(input);
+            hash.digest();
+            hash.reset();
+            hash.update(input);
+            long[] out = new long[2];
+            hash.digest128(out, 0);
+            ByteBuffer expected = ByteBuffer.wrap(expected128);
+            assertEquals(expected.getLong(), out[0]);
+            assertEquals(expected.getLong(), out[1]);
+        }
+    }
+
+    @Test
+    public void testXXHashBatch() {
+        byte[] data = new byte[10_000];
+        new Random(3).nextBytes(data);
+        int[] offsets = { 0, 17, 17, 5_000, 9_999 };
+        int[] lengths = { 16, 0, 1_000, 4_999, 1 };
+
+        long[] out64 = new long[offsets.length];
+        long[] out3_64 = new long[offsets.length];
+        long[] out128 = new long[offsets.length * 2];
+        long[] outDirect128 = new long[offsets.length * 2];
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data);
+        direct.flip();
+
+        XXHash.computeXXHash64Batch(data, offsets, lengths, 5, out64);
+        XXHash.computeXXHash3_64Batch(data, offsets, lengths, 5, out3_64);
+        XXHash.computeXXHash3_128Batch(data, offsets, lengths, 5, out128);
+        XXHash.computeXXHash3_128Batch(direct, offsets, lengths, 5, outDirect128);
+
+        for (int i = 0; i < offsets.length; ++i) {
+            byte[] slice = Arrays.copyOfRange(data, offsets[i], offsets[i] + lengths[i]);
+            assertEquals(ByteBuffer.wrap(XXHash.computeXXHash64(slice, 5)).getLong(), out64[i]);
+            assertEquals(ByteBuffer.wrap(XXHash.computeXXHash3_64(slice, 5)).getLong(), out3_64[i]);
+
+            ByteBuffer expected128 = ByteBuffer.wrap(XXHash.computeXXHash3_128(slice, 5));
+            long high = expected128.getLong();
+            long low = expected128.getLong();
+            assertEquals(high, out128[2 * i]);
+            assertEquals(low, out128[2 * i + 1]);
+            assertEquals(high, outDirect128[2 * i]);
+            assertEquals(low, outDirect128[2 * i + 1]);
+        }
+    }
 }